@@ -53,6 +53,9 @@ typedef enum
     SDL_BLENDMODE_MUL = 0x00000008,      /**< color multiply
                                               dstRGB = (srcRGB * dstRGB) + (dstRGB * (1-srcA))
                                               dstA = dstA */
+    SDL_BLENDMODE_BLEND_PREMULTIPLIED = 0x00000010, /**< premultiplied alpha blending
+                                                         dstRGBA = srcRGBA + (dstRGBA * (1-srcA)),
+                                                         the source color is already multiplied by its alpha */
     SDL_BLENDMODE_INVALID = 0x7FFFFFFF
 
     /* Additional custom blend modes can be returned by SDL_ComposeCustomBlendMode() */
@@ -1581,9 +1581,33 @@ extern "C" {
  *  if you do, you will call SDL_RenderFlush() before you do so any current
  *  batch goes to the GPU before your work begins. Not following this contract
  *  will result in undefined behavior.
+ *
+ *  Renderers created with SDL_CreateSoftwareRenderer() only batch when this
+ *  hint is "1". Their surface then has the rendering after SDL_RenderFlush(),
+ *  SDL_RenderReadPixels() or SDL_RenderPresent().
  */
 #define SDL_HINT_RENDER_BATCHING  "SDL_RENDER_BATCHING"
 
+/**
+ *  \brief  A variable controlling whether batched render commands may be reordered.
+ *
+ *  This variable can be set to the following values:
+ *
+ *    "0"     - Render commands are sent to the backend in the order they were issued (default)
+ *    "1"     - Draws that don't overlap may be sorted by texture and blend mode, and
+ *              adjacent compatible copies and geometry merged into a single draw
+ *
+ *  Draws that overlap are always kept in the order they were issued, so the
+ *  rendered image doesn't change. Draws are never moved across a change of
+ *  draw color, texture color or alpha mod, viewport, clip rect or target.
+ *  This only has an effect when batching is enabled, see SDL_HINT_RENDER_BATCHING.
+ *
+ *  This hint should be set before creating a renderer.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_REORDER_COMMANDS "SDL_RENDER_REORDER_COMMANDS"
+
 /**
  *  \brief  A variable controlling how the 2D render API renders lines
  *
@@ -1688,6 +1712,90 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling how much memory a renderer reserves up front for queued vertex data.
+ *
+ *  The value is a size in bytes. Reserving enough for a typical frame avoids
+ *  growing the buffer while the first frames are queued. The buffer still
+ *  grows when a frame needs more than this.
+ *
+ *  By default nothing is reserved and the buffer grows as needed.
+ *
+ *  This hint should be set before creating a renderer.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_VERTEX_BUFFER_SIZE "SDL_RENDER_VERTEX_BUFFER_SIZE"
+
+/**
+ *  \brief  A variable controlling when a renderer gives back vertex buffer memory it no longer needs.
+ *
+ *  The value is a number of frames. Once that many presented frames in a row
+ *  have used at most a quarter of the vertex buffer, it is shrunk to twice
+ *  the most vertex data any of those frames queued, rounded up to a power of
+ *  two of at least 2048 bytes. It never shrinks below
+ *  SDL_HINT_RENDER_VERTEX_BUFFER_SIZE.
+ *
+ *  By default this is "0", and the vertex buffer never shrinks.
+ *
+ *  This hint should be set before creating a renderer.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_VERTEX_BUFFER_SHRINK "SDL_RENDER_VERTEX_BUFFER_SHRINK"
+
+/**
+ *  \brief  A variable controlling whether the software renderer splits drawing across threads.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Commands are drawn one after another on the calling thread (default)
+ *    "1"       - The render target is split into bands of rows that are drawn in parallel
+ *
+ *  Each band draws the queued commands in order, so the output is identical
+ *  to drawing serially. Lines, scaled copies and rotated copies are still
+ *  drawn on the calling thread. The number of threads is controlled by
+ *  SDL_HINT_JOB_THREADS.
+ *
+ *  This hint is checked every time the software renderer flushes its commands.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_TILES "SDL_RENDER_SOFTWARE_TILES"
+
+/**
+ *  \brief  A variable controlling how many rotated copies the software renderer keeps around.
+ *
+ *  The value is a number of transformed surfaces. SDL_RenderCopyEx() with
+ *  the same texture contents, source rect, size, angle, center, flip and
+ *  modulation as a recent call reuses the transformed surface instead of
+ *  rotating the texture again. "0" disables the cache.
+ *
+ *  By default the last 16 transforms are kept, up to a few megabytes.
+ *
+ *  This hint should be set before creating a renderer.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_ROTATE_CACHE "SDL_RENDER_SOFTWARE_ROTATE_CACHE"
+
+/**
+ *  \brief  A variable controlling whether the software renderer only presents the parts of the window that changed.
+ *
+ *  The software renderer keeps track of the areas its commands draw to and
+ *  passes them to SDL_UpdateWindowSurfaceRects() on SDL_RenderPresent(), so
+ *  the video driver only copies the pixels that changed since the last frame.
+ *  Frames that clear the window or cover most of it update the whole window.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Always update the whole window
+ *    "1"       - Only update the parts of the window that changed (default)
+ *
+ *  This hint should be set before creating a renderer.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_DIRTY_RECTS "SDL_RENDER_SOFTWARE_DIRTY_RECTS"
+
 /**
  *  \brief  A variable controlling whether the Metal render driver select low power device over default one
  *
@@ -2698,6 +2806,79 @@ extern "C" {
  */
 #define SDL_HINT_SHUTDOWN_DBUS_ON_QUIT "SDL_SHUTDOWN_DBUS_ON_QUIT"
 
+/**
+ *  \brief  A variable controlling whether large software blits are split across threads.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Blits run on the calling thread (default)
+ *    "1"       - Large blits, fills, stretches and pixel conversions are split into bands of rows that run in parallel
+ *
+ *  Only operations on at least 256K pixels are split, smaller ones finish
+ *  before other threads would get going. Scaled blits, other than those
+ *  done by SDL_SoftStretch() and SDL_SoftStretchLinear(), and blits
+ *  between overlapping memory still run on the calling thread. The output
+ *  is identical either way. The number of threads is controlled by
+ *  SDL_HINT_JOB_THREADS.
+ *
+ *  This hint is checked every time a large blit runs.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_BLIT_THREADS "SDL_BLIT_THREADS"
+
+/**
+ *  \brief  A variable controlling how SDL_SoftStretchLinear() shrinks images a lot.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Bilinear filtering is used at every size (default)
+ *    "1"       - When both sides shrink by more than half, every destination pixel is the average of the source pixels it covers
+ *
+ *  Bilinear filtering reads 2x2 source pixels, so it skips some of them and
+ *  aliases when shrinking by more than half. Averaging them all looks
+ *  smoother but is slower, as every source pixel is read.
+ *
+ *  This also applies to textures scaled with SDL_ScaleModeLinear by the
+ *  software renderer. This hint is checked every time a stretch runs.
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_STRETCH_AREA_AVERAGE "SDL_STRETCH_AREA_AVERAGE"
+
+/**
+ *  \brief  A variable controlling how many threads SDL uses for internal data-parallel work.
+ *
+ *  Some internal operations, like large pixel conversions, can be split
+ *  across several threads. The value counts the calling thread, so "1"
+ *  runs everything serially on the thread that requested the work.
+ *
+ *  By default SDL uses one thread per CPU core, up to a limit.
+ *
+ *  This hint is checked the first time SDL needs a worker thread, and
+ *  again after SDL_Quit().
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_JOB_THREADS "SDL_JOB_THREADS"
+
+/**
+ *  \brief  A variable controlling whether RLE encoding of surfaces with per-pixel alpha merges nearby translucent runs.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Every run of translucent pixels is encoded separately
+ *    "1"       - Translucent runs a few pixels apart are encoded as one run (default)
+ *
+ *  The pixels in between are blended with the run, which leaves them as
+ *  they were: only opaque pixels, and fully transparent pixels when the
+ *  destination is RGB565, are merged. Blits give the same result either
+ *  way, merging trades a little memory for fewer runs to set up.
+ *
+ *  This hint is checked when a surface is RLE encoded, which happens the
+ *  first time it is blitted after SDL_SetSurfaceRLE().
+ *
+ *  This hint is available since SDL 2.32.0.
+ */
+#define SDL_HINT_RLE_MERGE_RUNS "SDL_RLE_MERGE_RUNS"
+
 
 /**
  *  \brief  An enumeration of hint priorities
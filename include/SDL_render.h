@@ -95,6 +95,53 @@ typedef struct SDL_Vertex
     SDL_FPoint tex_coord;       /**< Normalized texture coordinates, if needed */
 } SDL_Vertex;
 
+/**
+ * Counters describing the work a renderer did during one frame.
+ *
+ * \since This struct is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderGetStats
+ */
+typedef struct SDL_RenderStats
+{
+    /* Commands sent to the render backend, by type */
+    Uint32 set_viewport_commands;
+    Uint32 set_cliprect_commands;
+    Uint32 set_draw_color_commands;
+    Uint32 clear_commands;
+    Uint32 draw_points_commands;
+    Uint32 draw_lines_commands;
+    Uint32 fill_rects_commands;
+    Uint32 copy_commands;
+    Uint32 copy_ex_commands;
+    Uint32 geometry_commands;
+
+    /* Times the command queue was sent to the backend, and why */
+    Uint32 flushes;             /**< The total number of flushes */
+    Uint32 flushes_unbatched;   /**< Batching is disabled, commands are sent right away */
+    Uint32 flushes_texture;     /**< A texture used by queued commands was changed */
+    Uint32 flushes_target;      /**< The render target was changed */
+    Uint32 flushes_read_pixels; /**< SDL_RenderReadPixels() was called */
+    Uint32 flushes_explicit;    /**< SDL_RenderFlush() was called or the native API was accessed */
+    Uint32 flushes_present;     /**< SDL_RenderPresent() was called */
+
+    Uint32 vertex_bytes;            /**< The amount of vertex data queued */
+    Uint32 vertex_bytes_high_water; /**< The most vertex data queued between two flushes */
+    Uint32 vertex_bytes_peak;       /**< The most vertex data ever queued between two flushes */
+    Uint32 vertex_buffer_bytes;     /**< The memory currently allocated for vertex data */
+
+    Uint32 texture_uploads;      /**< The number of texture updates and unlocks */
+    Uint32 texture_upload_bytes; /**< The amount of pixel data uploaded to textures */
+
+    /* Rotated and flipped copies in the software renderer */
+    Uint32 copy_ex_cache_hits;   /**< Copies drawn from an already transformed surface */
+    Uint32 copy_ex_cache_misses; /**< Copies that had to be transformed */
+
+    /* Window updates by the software renderer */
+    Uint32 present_rects;  /**< The number of rects passed to the window, 0 for a full update */
+    Uint32 present_pixels; /**< The number of pixels updated on the window */
+} SDL_RenderStats;
+
 /**
  * The scaling mode for a texture.
  */
@@ -1592,6 +1639,38 @@ extern DECLSPEC int SDLCALL SDL_RenderCopyF(SDL_Renderer * renderer,
                                             const SDL_Rect * srcrect,
                                             const SDL_FRect * dstrect);
 
+/**
+ * Copy many portions of a texture to the current rendering target at
+ * subpixel precision in a single call.
+ *
+ * This draws the same thing as calling SDL_RenderCopyF() once for each
+ * sprite, but the sprites are queued together, which is much cheaper for
+ * particle systems, tile maps and other scenes that draw lots of small
+ * pieces of the same texture.
+ *
+ * If `colors` is not NULL, each sprite's color and alpha are multiplied by
+ * the texture's color and alpha modulation before drawing.
+ *
+ * \param renderer The renderer which should copy parts of a texture.
+ * \param texture The source texture.
+ * \param srcrects An array of `count` source rectangles, or NULL to use the
+ *                 entire texture for every sprite.
+ * \param dstrects An array of `count` destination rectangles.
+ * \param colors An array of `count` colors, or NULL.
+ * \param count The number of sprites.
+ * \return 0 on success, or -1 on error
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderCopyF
+ */
+extern DECLSPEC int SDLCALL SDL_RenderCopyBatchF(SDL_Renderer * renderer,
+                                                 SDL_Texture * texture,
+                                                 const SDL_Rect * srcrects,
+                                                 const SDL_FRect * dstrects,
+                                                 const SDL_Color * colors,
+                                                 int count);
+
 /**
  * Copy a portion of the source texture to the current rendering target, with
  * rotation and flipping, at subpixel precision.
@@ -1812,6 +1891,29 @@ extern DECLSPEC void SDLCALL SDL_DestroyRenderer(SDL_Renderer * renderer);
  */
 extern DECLSPEC int SDLCALL SDL_RenderFlush(SDL_Renderer * renderer);
 
+/**
+ * Get statistics about the work a renderer did during the last frame.
+ *
+ * The counters cover everything between the two most recent calls to
+ * SDL_RenderPresent(), so they can be used to catch frames that generate
+ * more draw calls or flushes than expected. Before the first present, all
+ * counters are zero.
+ *
+ * `vertex_bytes_peak` and `vertex_buffer_bytes` describe the renderer as a
+ * whole rather than one frame, they can be used to budget the memory set
+ * aside with SDL_HINT_RENDER_VERTEX_BUFFER_SIZE.
+ *
+ * \param renderer the rendering context
+ * \param stats an SDL_RenderStats structure filled in with the counters
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_RenderPresent
+ */
+extern DECLSPEC int SDLCALL SDL_RenderGetStats(SDL_Renderer * renderer, SDL_RenderStats * stats);
+
 
 /**
  * Bind an OpenGL/ES/ES2 texture to the current context.
@@ -54,6 +54,7 @@ extern "C" {
 #define SDL_RLEACCEL        0x00000002  /**< Surface is RLE encoded */
 #define SDL_DONTFREE        0x00000004  /**< Surface is referenced internally */
 #define SDL_SIMD_ALIGNED    0x00000008  /**< Surface uses aligned memory */
+#define SDL_SIMD_PITCH      0x00000010  /**< Surface rows start at SIMD aligned addresses */
 /* @} *//* Surface flags */
 
 /**
@@ -140,7 +141,8 @@ typedef enum
  * You can change this by calling SDL_SetSurfaceBlendMode() and selecting a
  * different `blendMode`.
  *
- * \param flags the flags are unused and should be set to 0
+ * \param flags 0, or SDL_SIMD_PITCH to pad every row to a multiple of
+ *              SDL_SIMDGetAlignment() bytes for faster blits
  * \param width the width of the surface
  * \param height the height of the surface
  * \param depth the depth of the surface in bits
@@ -171,7 +173,8 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_CreateRGBSurface
  * of providing pixel color masks, you provide it with a predefined format
  * from SDL_PixelFormatEnum.
  *
- * \param flags the flags are unused and should be set to 0
+ * \param flags 0, or SDL_SIMD_PITCH to pad every row to a multiple of
+ *              SDL_SIMDGetAlignment() bytes for faster blits
  * \param width the width of the surface
  * \param height the height of the surface
  * \param depth the depth of the surface in bits
@@ -661,8 +664,8 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_DuplicateSurface(SDL_Surface * surface)
  * \param src the existing SDL_Surface structure to convert
  * \param fmt the SDL_PixelFormat structure that the new surface is optimized
  *            for
- * \param flags the flags are unused and should be set to 0; this is a
- *              leftover from SDL 1.2's API
+ * \param flags 0, or SDL_SIMD_PITCH to pad every row of the new surface to
+ *              a multiple of SDL_SIMDGetAlignment() bytes
  * \returns the new SDL_Surface structure that is created or NULL if it fails;
  *          call SDL_GetError() for more information.
  *
@@ -686,8 +689,8 @@ extern DECLSPEC SDL_Surface *SDLCALL SDL_ConvertSurface
  * \param src the existing SDL_Surface structure to convert
  * \param pixel_format the SDL_PixelFormatEnum that the new surface is
  *                     optimized for
- * \param flags the flags are unused and should be set to 0; this is a
- *              leftover from SDL 1.2's API
+ * \param flags 0, or SDL_SIMD_PITCH to pad every row of the new surface to
+ *              a multiple of SDL_SIMDGetAlignment() bytes
  * \returns the new SDL_Surface structure that is created or NULL if it fails;
  *          call SDL_GetError() for more information.
  *
@@ -727,7 +730,10 @@ extern DECLSPEC int SDLCALL SDL_ConvertPixels(int width, int height,
  *
  * This is safe to use with src == dst, but not for other overlapping areas.
  *
- * This function is currently only implemented for SDL_PIXELFORMAT_ARGB8888.
+ * 32-bit formats with 8-bit channels and alpha, like SDL_PIXELFORMAT_ARGB8888
+ * and SDL_PIXELFORMAT_RGBA8888, are premultiplied directly. Other packed
+ * formats are converted through SDL_PIXELFORMAT_ARGB8888 as needed, indexed
+ * and YUV formats are not supported.
  *
  * \param width the width of the block to convert, in pixels
  * \param height the height of the block to convert, in pixels
@@ -748,6 +754,22 @@ extern DECLSPEC int SDLCALL SDL_PremultiplyAlpha(int width, int height,
                                                  Uint32 dst_format,
                                                  void * dst, int dst_pitch);
 
+/**
+ * Premultiply the alpha of the pixels of a surface in place.
+ *
+ * The result is meant to be blitted with SDL_BLENDMODE_BLEND_PREMULTIPLIED.
+ *
+ * \param surface the SDL_Surface structure to update
+ * \returns 0 on success or a negative error code on failure; call
+ *          SDL_GetError() for more information.
+ *
+ * \since This function is available since SDL 2.32.0.
+ *
+ * \sa SDL_PremultiplyAlpha
+ * \sa SDL_SetSurfaceBlendMode
+ */
+extern DECLSPEC int SDLCALL SDL_PremultiplySurfaceAlpha(SDL_Surface * surface);
+
 /**
  * Perform a fast fill of a rectangle with a specific color.
  *
@@ -205,6 +205,24 @@
 #error SDL_RENDER enabled without any backend drivers.
 #endif
 
+/* SDL_TARGETING() builds a single function for an instruction set the rest of
+   SDL isn't compiled for, so it can be picked at runtime after a CPU check. */
+#if defined(__clang__) || (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define SDL_HAS_TARGET_ATTRIBS
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#else
+#define SDL_TARGETING(x)
+#endif
+
+/* AVX2 code can be built, in SDL_TARGETING("avx2") functions, without -mavx2 */
+#if defined(HAVE_IMMINTRIN_H) && !defined(SDL_DISABLE_IMMINTRIN_H)
+#if defined(__AVX2__) || \
+    ((defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)) && \
+     (defined(SDL_HAS_TARGET_ATTRIBS) || (defined(_MSC_VER) && _MSC_VER >= 1700)))
+#define SDL_AVX2_INTRINSICS 1
+#endif
+#endif
+
 #include "SDL_assert.h"
 #include "SDL_log.h"
 
@@ -89,6 +89,10 @@ this should probably be removed at some point in the future.  --ryan. */
     SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_DST_COLOR, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
                           SDL_BLENDFACTOR_ZERO, SDL_BLENDFACTOR_ONE, SDL_BLENDOPERATION_ADD)
 
+#define SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL                                                              \
+    SDL_COMPOSE_BLENDMODE(SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD, \
+                          SDL_BLENDFACTOR_ONE, SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA, SDL_BLENDOPERATION_ADD)
+
 #ifndef SDL_RENDER_DISABLED
 static const SDL_RenderDriver *render_drivers[] = {
 #if SDL_VIDEO_RENDER_D3D
@@ -236,7 +240,292 @@ static SDL_INLINE void DebugLogRenderCommands(const SDL_RenderCommand *cmd)
 #endif
 }
 
-static int FlushRenderCommands(SDL_Renderer *renderer)
+/* How many draws we look at together when reordering, the cost of sorting is quadratic in this */
+#define SDL_REORDER_WINDOW 256
+
+static SDL_bool IsReorderableDrawCommand(const SDL_RenderCommand *cmd)
+{
+    switch (cmd->command) {
+    case SDL_RENDERCMD_DRAW_POINTS:
+    case SDL_RENDERCMD_DRAW_LINES:
+    case SDL_RENDERCMD_FILL_RECTS:
+    case SDL_RENDERCMD_COPY:
+    case SDL_RENDERCMD_COPY_EX:
+    case SDL_RENDERCMD_GEOMETRY:
+        return cmd->data.draw.bounds.w >= 0.0f;
+    default:
+        return SDL_FALSE;
+    }
+}
+
+static SDL_bool DrawCommandsOverlap(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    const SDL_FRect *A = &a->data.draw.bounds;
+    const SDL_FRect *B = &b->data.draw.bounds;
+
+    return (A->x < B->x + B->w && B->x < A->x + A->w &&
+            A->y < B->y + B->h && B->y < A->y + A->h);
+}
+
+static SDL_bool DrawCommandsShareState(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    return (a->command == b->command &&
+            a->data.draw.texture == b->data.draw.texture &&
+            a->data.draw.blend == b->data.draw.blend);
+}
+
+static SDL_bool CanMergeDrawCommands(const SDL_RenderCommand *a, const SDL_RenderCommand *b)
+{
+    if (a->command != SDL_RENDERCMD_COPY && a->command != SDL_RENDERCMD_GEOMETRY) {
+        return SDL_FALSE;
+    }
+    return (DrawCommandsShareState(a, b) &&
+            a->data.draw.r == b->data.draw.r &&
+            a->data.draw.g == b->data.draw.g &&
+            a->data.draw.b == b->data.draw.b &&
+            a->data.draw.a == b->data.draw.a &&
+            a->data.draw.vertex_end == b->data.draw.first);
+}
+
+/* Move the vertex data of a run of draws so it's laid out in the new draw order.
+   Backends combine adjacent compatible draws assuming their vertices are contiguous. */
+static SDL_bool RepackDrawCommandVertices(SDL_Renderer *renderer, SDL_RenderCommand **cmds, int count)
+{
+    size_t newfirst[SDL_REORDER_WINDOW];
+    size_t start = cmds[0]->data.draw.first;
+    size_t end = cmds[0]->data.draw.vertex_end;
+    size_t offset;
+    Uint8 *vertices = (Uint8 *)renderer->vertex_data;
+    Uint8 *scratch;
+    int i;
+
+    for (i = 1; i < count; ++i) {
+        start = SDL_min(start, cmds[i]->data.draw.first);
+        end = SDL_max(end, cmds[i]->data.draw.vertex_end);
+    }
+
+    offset = start;
+    for (i = 0; i < count; ++i) {
+        const size_t alignment = cmds[i]->data.draw.vertex_alignment;
+        if (alignment && (offset & (alignment - 1)) != 0) {
+            offset += alignment - (offset & (alignment - 1));
+        }
+        newfirst[i] = offset;
+        offset += cmds[i]->data.draw.vertex_end - cmds[i]->data.draw.first;
+    }
+    if (offset > end) {
+        return SDL_FALSE; /* the new order needs more alignment padding than we have room for. */
+    }
+
+    if (renderer->reorder_vertex_data_allocation < (end - start)) {
+        scratch = (Uint8 *)SDL_realloc(renderer->reorder_vertex_data, end - start);
+        if (!scratch) {
+            return SDL_FALSE;
+        }
+        renderer->reorder_vertex_data = scratch;
+        renderer->reorder_vertex_data_allocation = end - start;
+    }
+    scratch = (Uint8 *)renderer->reorder_vertex_data;
+    SDL_memcpy(scratch, vertices + start, end - start);
+
+    for (i = 0; i < count; ++i) {
+        SDL_RenderCommand *cmd = cmds[i];
+        const size_t size = cmd->data.draw.vertex_end - cmd->data.draw.first;
+        SDL_memcpy(vertices + newfirst[i], scratch + (cmd->data.draw.first - start), size);
+        cmd->data.draw.first = newfirst[i];
+        cmd->data.draw.vertex_end = newfirst[i] + size;
+    }
+    return SDL_TRUE;
+}
+
+/* Sort a run of draws so draws sharing a texture and blend mode end up next to
+   each other, without ever moving a draw past another one that it overlaps. */
+static void ReorderDrawCommands(SDL_Renderer *renderer, SDL_RenderCommand **cmds, int count)
+{
+    SDL_RenderCommand *sorted[SDL_REORDER_WINDOW];
+    int blockers[SDL_REORDER_WINDOW];
+    SDL_bool emitted[SDL_REORDER_WINDOW];
+    SDL_RenderCommand *last = NULL;
+    SDL_bool changed = SDL_FALSE;
+    int i, j, n;
+
+    for (i = 0; i < count; ++i) {
+        blockers[i] = 0;
+        emitted[i] = SDL_FALSE;
+        for (j = 0; j < i; ++j) {
+            if (DrawCommandsOverlap(cmds[i], cmds[j])) {
+                ++blockers[i];
+            }
+        }
+    }
+
+    for (n = 0; n < count; ++n) {
+        int pick = -1;
+
+        for (i = 0; i < count; ++i) {
+            if (emitted[i] || blockers[i] > 0) {
+                continue;
+            }
+            if (pick < 0) {
+                pick = i; /* the oldest draw that's free to go next */
+                if (!last) {
+                    break;
+                }
+            }
+            if (DrawCommandsShareState(last, cmds[i])) {
+                pick = i;
+                break;
+            }
+        }
+        SDL_assert(pick >= 0);
+
+        emitted[pick] = SDL_TRUE;
+        for (j = pick + 1; j < count; ++j) {
+            if (!emitted[j] && DrawCommandsOverlap(cmds[pick], cmds[j])) {
+                --blockers[j];
+            }
+        }
+        if (pick != n) {
+            changed = SDL_TRUE;
+        }
+        sorted[n] = last = cmds[pick];
+    }
+
+    if (changed && RepackDrawCommandVertices(renderer, sorted, count)) {
+        SDL_memcpy(cmds, sorted, count * sizeof(*cmds));
+    }
+
+    /* Fold adjacent compatible draws into a single one */
+    last = cmds[0];
+    for (i = 1; i < count; ++i) {
+        SDL_RenderCommand *cmd = cmds[i];
+        if (CanMergeDrawCommands(last, cmd)) {
+            last->data.draw.count += cmd->data.draw.count;
+            last->data.draw.vertex_end = cmd->data.draw.vertex_end;
+            cmd->command = SDL_RENDERCMD_NO_OP;
+        } else {
+            last = cmd;
+        }
+    }
+}
+
+static void ReorderRenderCommands(SDL_Renderer *renderer)
+{
+    SDL_RenderCommand *cmds[SDL_REORDER_WINDOW];
+    SDL_RenderCommand **link = &renderer->render_commands;
+    SDL_RenderCommand *cmd = renderer->render_commands;
+    SDL_RenderCommand *tail = NULL;
+
+    while (cmd) {
+        int count = 0;
+        int i;
+
+        /* Only runs of draws are reordered, any state change is a barrier */
+        if (!IsReorderableDrawCommand(cmd)) {
+            tail = cmd;
+            link = &cmd->next;
+            cmd = cmd->next;
+            continue;
+        }
+
+        while (cmd && count < SDL_REORDER_WINDOW && IsReorderableDrawCommand(cmd)) {
+            cmds[count++] = cmd;
+            cmd = cmd->next;
+        }
+
+        if (count > 1) {
+            ReorderDrawCommands(renderer, cmds, count);
+        }
+
+        *link = cmds[0];
+        for (i = 0; i < count - 1; ++i) {
+            cmds[i]->next = cmds[i + 1];
+        }
+        cmds[count - 1]->next = cmd;
+        tail = cmds[count - 1];
+        link = &tail->next;
+    }
+
+    renderer->render_commands_tail = tail;
+}
+
+/* Why the command queue is being sent to the backend, for SDL_RenderGetStats() */
+typedef enum
+{
+    SDL_RENDERFLUSH_UNBATCHED,
+    SDL_RENDERFLUSH_TEXTURE,
+    SDL_RENDERFLUSH_TARGET,
+    SDL_RENDERFLUSH_READ_PIXELS,
+    SDL_RENDERFLUSH_EXPLICIT,
+    SDL_RENDERFLUSH_PRESENT
+} SDL_RenderFlushCause;
+
+static void UpdateFlushStats(SDL_Renderer *renderer, SDL_RenderFlushCause cause)
+{
+    SDL_RenderStats *stats = &renderer->stats;
+    const SDL_RenderCommand *cmd;
+
+    for (cmd = renderer->render_commands; cmd; cmd = cmd->next) {
+        switch (cmd->command) {
+        case SDL_RENDERCMD_NO_OP:
+            break;
+        case SDL_RENDERCMD_SETVIEWPORT:
+            ++stats->set_viewport_commands;
+            break;
+        case SDL_RENDERCMD_SETCLIPRECT:
+            ++stats->set_cliprect_commands;
+            break;
+        case SDL_RENDERCMD_SETDRAWCOLOR:
+            ++stats->set_draw_color_commands;
+            break;
+        case SDL_RENDERCMD_CLEAR:
+            ++stats->clear_commands;
+            break;
+        case SDL_RENDERCMD_DRAW_POINTS:
+            ++stats->draw_points_commands;
+            break;
+        case SDL_RENDERCMD_DRAW_LINES:
+            ++stats->draw_lines_commands;
+            break;
+        case SDL_RENDERCMD_FILL_RECTS:
+            ++stats->fill_rects_commands;
+            break;
+        case SDL_RENDERCMD_COPY:
+            ++stats->copy_commands;
+            break;
+        case SDL_RENDERCMD_COPY_EX:
+            ++stats->copy_ex_commands;
+            break;
+        case SDL_RENDERCMD_GEOMETRY:
+            ++stats->geometry_commands;
+            break;
+        }
+    }
+
+    ++stats->flushes;
+    switch (cause) {
+    case SDL_RENDERFLUSH_UNBATCHED:
+        ++stats->flushes_unbatched;
+        break;
+    case SDL_RENDERFLUSH_TEXTURE:
+        ++stats->flushes_texture;
+        break;
+    case SDL_RENDERFLUSH_TARGET:
+        ++stats->flushes_target;
+        break;
+    case SDL_RENDERFLUSH_READ_PIXELS:
+        ++stats->flushes_read_pixels;
+        break;
+    case SDL_RENDERFLUSH_EXPLICIT:
+        ++stats->flushes_explicit;
+        break;
+    case SDL_RENDERFLUSH_PRESENT:
+        ++stats->flushes_present;
+        break;
+    }
+}
+
+static int FlushRenderCommands(SDL_Renderer *renderer, SDL_RenderFlushCause cause)
 {
     int retval;
 
@@ -247,10 +536,21 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
         return 0;
     }
 
+    if (renderer->reorder_commands) {
+        ReorderRenderCommands(renderer);
+    }
+
+    UpdateFlushStats(renderer, cause);
+
     DebugLogRenderCommands(renderer->render_commands);
 
     retval = renderer->RunCommandQueue(renderer, renderer->render_commands, renderer->vertex_data, renderer->vertex_data_used);
 
+    if (renderer->target) {
+        /* We just drew into it */
+        ++renderer->target->version;
+    }
+
     /* Move the whole render command queue to the unused pool so we can reuse them next time. */
     if (renderer->render_commands_tail) {
         renderer->render_commands_tail->next = renderer->render_commands_pool;
@@ -266,24 +566,53 @@ static int FlushRenderCommands(SDL_Renderer *renderer)
     return retval;
 }
 
+static void NoteTextureUpdate(SDL_Texture *texture, const SDL_Rect *rect)
+{
+    SDL_RenderStats *stats = &texture->renderer->stats;
+    Uint32 size;
+
+    ++texture->version;
+
+    switch (texture->format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        /* A full resolution Y plane and two quarter resolution chroma planes */
+        size = (Uint32)(rect->w * rect->h + 2 * (((rect->w + 1) / 2) * ((rect->h + 1) / 2)));
+        break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        /* The same planes with 16-bit samples */
+        size = (Uint32)(2 * (rect->w * rect->h + 2 * (((rect->w + 1) / 2) * ((rect->h + 1) / 2))));
+        break;
+    default:
+        size = (Uint32)(rect->w * rect->h * SDL_BYTESPERPIXEL(texture->format));
+        break;
+    }
+
+    ++stats->texture_uploads;
+    stats->texture_upload_bytes += size;
+}
+
 static int FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
 {
     SDL_Renderer *renderer = texture->renderer;
     if (texture->last_command_generation == renderer->render_command_generation) {
         /* the current command queue depends on this texture, flush the queue now before it changes */
-        return FlushRenderCommands(renderer);
+        return FlushRenderCommands(renderer, SDL_RENDERFLUSH_TEXTURE);
     }
     return 0;
 }
 
 static SDL_INLINE int FlushRenderCommandsIfNotBatching(SDL_Renderer *renderer)
 {
-    return renderer->batching ? 0 : FlushRenderCommands(renderer);
+    return renderer->batching ? 0 : FlushRenderCommands(renderer, SDL_RENDERFLUSH_UNBATCHED);
 }
 
 int SDL_RenderFlush(SDL_Renderer *renderer)
 {
-    return FlushRenderCommands(renderer);
+    return FlushRenderCommands(renderer, SDL_RENDERFLUSH_EXPLICIT);
 }
 
 void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes, const size_t alignment, size_t *offset)
@@ -317,10 +646,76 @@ void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t numbytes,
     }
 
     renderer->vertex_data_used += aligner + numbytes;
+    renderer->vertex_data_max_alignment = SDL_max(renderer->vertex_data_max_alignment, alignment);
+
+    renderer->vertex_data_peak = SDL_max(renderer->vertex_data_peak, renderer->vertex_data_used);
+
+    renderer->stats.vertex_bytes += (Uint32)numbytes;
+    renderer->stats.vertex_bytes_high_water = SDL_max(renderer->stats.vertex_bytes_high_water, (Uint32)renderer->vertex_data_used);
 
     return ((Uint8 *)renderer->vertex_data) + aligned;
 }
 
+static void InitRenderVertexBuffers(SDL_Renderer *renderer)
+{
+    const char *hint;
+
+    hint = SDL_GetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SHRINK);
+    if (hint) {
+        renderer->vertex_data_shrink_frames = SDL_max(SDL_atoi(hint), 0);
+    }
+
+    hint = SDL_GetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SIZE);
+    if (hint) {
+        renderer->vertex_data_reserved = (size_t)SDL_strtoul(hint, NULL, 0);
+    }
+    if (renderer->vertex_data_reserved > 0) {
+        /* If this fails, the buffer will be allocated when it's needed */
+        renderer->vertex_data = SDL_malloc(renderer->vertex_data_reserved);
+        if (renderer->vertex_data) {
+            renderer->vertex_data_allocation = renderer->vertex_data_reserved;
+        }
+    }
+}
+
+/* Called once per presented frame, with the most vertex data that frame queued at once */
+static void ShrinkRenderVertexBuffer(SDL_Renderer *renderer, size_t high_water)
+{
+    size_t newsize;
+
+    if (renderer->vertex_data_shrink_frames <= 0 || renderer->vertex_data_used > 0) {
+        return;
+    }
+
+    if (high_water > renderer->vertex_data_allocation / 4) {
+        renderer->vertex_data_idle_frames = 0;
+        renderer->vertex_data_idle_high_water = 0;
+        return;
+    }
+    renderer->vertex_data_idle_high_water = SDL_max(renderer->vertex_data_idle_high_water, high_water);
+    if (++renderer->vertex_data_idle_frames < renderer->vertex_data_shrink_frames) {
+        return;
+    }
+
+    /* Keep room for twice what the idle frames used, in SDL_AllocateRenderVertices() growth steps */
+    newsize = 2048;
+    while (newsize < 2 * renderer->vertex_data_idle_high_water) {
+        newsize *= 2;
+    }
+    newsize = SDL_max(newsize, renderer->vertex_data_reserved);
+
+    if (renderer->vertex_data && newsize < renderer->vertex_data_allocation) {
+        void *ptr = SDL_realloc(renderer->vertex_data, newsize);
+        if (ptr) {
+            renderer->vertex_data = ptr;
+            renderer->vertex_data_allocation = newsize;
+        }
+    }
+
+    renderer->vertex_data_idle_frames = 0;
+    renderer->vertex_data_idle_high_water = 0;
+}
+
 static SDL_RenderCommand *AllocateRenderCommand(SDL_Renderer *renderer)
 {
     SDL_RenderCommand *retval = NULL;
@@ -444,21 +839,75 @@ static int QueueCmdClear(SDL_Renderer *renderer)
     return 0;
 }
 
-static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtype, SDL_Texture *texture)
+/* Tell the reorder pass which area of the viewport a successfully queued draw can touch */
+static void SetDrawCommandBounds(SDL_Renderer *renderer, SDL_RenderCommand *cmd, float minx, float miny, float maxx, float maxy)
 {
-    SDL_RenderCommand *cmd = NULL;
-    int retval = 0;
-    SDL_Color *color;
-    SDL_BlendMode blendMode;
+    /* Be generous, backends round coordinates and lines have width */
+    const float margin = 2.0f;
 
-    if (texture) {
-        color = &texture->color;
-        blendMode = texture->blendMode;
-    } else {
-        color = &renderer->color;
-        blendMode = renderer->blendMode;
+    if (renderer->vertex_data_used == cmd->data.draw.vertex_end) {
+        return; /* the backend didn't queue any vertices, keep this draw where it is. */
+    }
+    if (!(minx <= maxx && miny <= maxy)) {
+        return; /* nothing to draw, or NaN coordinates. */
+    }
+
+    cmd->data.draw.bounds.x = minx - margin;
+    cmd->data.draw.bounds.y = miny - margin;
+    cmd->data.draw.bounds.w = (maxx - minx) + 2.0f * margin;
+    cmd->data.draw.bounds.h = (maxy - miny) + 2.0f * margin;
+    cmd->data.draw.vertex_end = renderer->vertex_data_used;
+    cmd->data.draw.vertex_alignment = renderer->vertex_data_max_alignment;
+}
+
+static void SetDrawCommandPointBounds(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const SDL_FPoint *points, const int count)
+{
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (count <= 0) {
+        return;
     }
 
+    minx = maxx = points[0].x;
+    miny = maxy = points[0].y;
+    for (i = 1; i < count; ++i) {
+        minx = SDL_min(minx, points[i].x);
+        miny = SDL_min(miny, points[i].y);
+        maxx = SDL_max(maxx, points[i].x);
+        maxy = SDL_max(maxy, points[i].y);
+    }
+    SetDrawCommandBounds(renderer, cmd, minx, miny, maxx, maxy);
+}
+
+static void SetDrawCommandRectBounds(SDL_Renderer *renderer, SDL_RenderCommand *cmd, const SDL_FRect *rects, const int count)
+{
+    float minx, miny, maxx, maxy;
+    int i;
+
+    if (count <= 0) {
+        return;
+    }
+
+    minx = rects[0].x;
+    miny = rects[0].y;
+    maxx = rects[0].x + rects[0].w;
+    maxy = rects[0].y + rects[0].h;
+    for (i = 1; i < count; ++i) {
+        minx = SDL_min(minx, rects[i].x);
+        miny = SDL_min(miny, rects[i].y);
+        maxx = SDL_max(maxx, rects[i].x + rects[i].w);
+        maxy = SDL_max(maxy, rects[i].y + rects[i].h);
+    }
+    SetDrawCommandBounds(renderer, cmd, minx, miny, maxx, maxy);
+}
+
+static SDL_RenderCommand *PrepQueueCmdDrawColor(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtype, SDL_Texture *texture,
+                                                 SDL_Color *color, SDL_BlendMode blendMode)
+{
+    SDL_RenderCommand *cmd = NULL;
+    int retval = 0;
+
     if (cmdtype != SDL_RENDERCMD_GEOMETRY) {
         /* !!! FIXME: drop this draw if viewport w or h is zero. */
         retval = QueueCmdSetDrawColor(renderer, color);
@@ -485,11 +934,24 @@ static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_Ren
             cmd->data.draw.a = color->a;
             cmd->data.draw.blend = blendMode;
             cmd->data.draw.texture = texture;
+            cmd->data.draw.bounds.w = -1.0f; /* unknown until the draw is queued */
+            cmd->data.draw.vertex_end = renderer->vertex_data_used;
+            cmd->data.draw.vertex_alignment = 0;
+            renderer->vertex_data_max_alignment = 0;
         }
     }
     return cmd;
 }
 
+static SDL_RenderCommand *PrepQueueCmdDraw(SDL_Renderer *renderer, const SDL_RenderCommandType cmdtype, SDL_Texture *texture)
+{
+    if (texture) {
+        return PrepQueueCmdDrawColor(renderer, cmdtype, texture, &texture->color, texture->blendMode);
+    } else {
+        return PrepQueueCmdDrawColor(renderer, cmdtype, texture, &renderer->color, renderer->blendMode);
+    }
+}
+
 static int QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points, const int count)
 {
     SDL_RenderCommand *cmd = PrepQueueCmdDraw(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL);
@@ -498,6 +960,8 @@ static int QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint *points,
         retval = renderer->QueueDrawPoints(renderer, cmd, points, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            SetDrawCommandPointBounds(renderer, cmd, points, count);
         }
     }
     return retval;
@@ -511,6 +975,8 @@ static int QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint *points, c
         retval = renderer->QueueDrawLines(renderer, cmd, points, count);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            SetDrawCommandPointBounds(renderer, cmd, points, count);
         }
     }
     return retval;
@@ -586,6 +1052,10 @@ static int QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect *rects, con
                 cmd->command = SDL_RENDERCMD_NO_OP;
             }
         }
+
+        if (retval == 0 && renderer->reorder_commands) {
+            SetDrawCommandRectBounds(renderer, cmd, rects, count);
+        }
     }
     return retval;
 }
@@ -598,11 +1068,79 @@ static int QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture *texture, const SDL_
         retval = renderer->QueueCopy(renderer, cmd, texture, srcrect, dstrect);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            SetDrawCommandRectBounds(renderer, cmd, dstrect, 1);
         }
     }
     return retval;
 }
 
+/* Queue several copies that share a color as few commands as possible */
+static int QueueCmdCopies(SDL_Renderer *renderer, SDL_Texture *texture, SDL_Color *color,
+                          const SDL_Rect *srcrects, const SDL_FRect *dstrects, const int count)
+{
+    SDL_RenderCommand *cmd = NULL;
+    SDL_RenderCommand next;
+    float minx = 0.0f, miny = 0.0f, maxx = 0.0f, maxy = 0.0f;
+    size_t alignment;
+    int retval = 0;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_FRect *dstrect = &dstrects[i];
+        const size_t used = renderer->vertex_data_used;
+
+        if (cmd) {
+            /* The backend only fills in where the vertices went, so we let it
+               queue into a scratch command and extend the real one. */
+            SDL_zero(next);
+            retval = renderer->QueueCopy(renderer, &next, texture, &srcrects[i], dstrect);
+            if (retval < 0) {
+                break;
+            }
+            if (next.data.draw.first == used) {
+                cmd->data.draw.count += next.data.draw.count;
+                minx = SDL_min(minx, dstrect->x);
+                miny = SDL_min(miny, dstrect->y);
+                maxx = SDL_max(maxx, dstrect->x + dstrect->w);
+                maxy = SDL_max(maxy, dstrect->y + dstrect->h);
+                continue;
+            }
+        }
+
+        if (cmd && renderer->reorder_commands) {
+            SetDrawCommandBounds(renderer, cmd, minx, miny, maxx, maxy);
+        }
+        alignment = renderer->vertex_data_max_alignment;
+        cmd = PrepQueueCmdDrawColor(renderer, SDL_RENDERCMD_COPY, texture, color, texture->blendMode);
+        if (!cmd) {
+            return -1;
+        }
+        if (i == 0) {
+            retval = renderer->QueueCopy(renderer, cmd, texture, &srcrects[i], dstrect);
+            if (retval < 0) {
+                cmd->command = SDL_RENDERCMD_NO_OP;
+                return retval;
+            }
+        } else {
+            /* The vertices were already queued, after some alignment padding */
+            cmd->data.draw.first = next.data.draw.first;
+            cmd->data.draw.count = next.data.draw.count;
+            cmd->data.draw.vertex_end = used;
+            renderer->vertex_data_max_alignment = alignment;
+        }
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
+    }
+
+    if (cmd && renderer->reorder_commands) {
+        SetDrawCommandBounds(renderer, cmd, minx, miny, maxx, maxy);
+    }
+    return retval;
+}
+
 static int QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
                           const SDL_Rect *srcquad, const SDL_FRect *dstrect,
                           const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip, float scale_x, float scale_y)
@@ -613,6 +1151,19 @@ static int QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
         retval = renderer->QueueCopyEx(renderer, cmd, texture, srcquad, dstrect, angle, center, flip, scale_x, scale_y);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands) {
+            /* Whatever the angle, the rotated rect stays within reach of the rotation center */
+            const float cx = dstrect->x + center->x;
+            const float cy = dstrect->y + center->y;
+            const float dx = SDL_max(center->x, dstrect->w - center->x);
+            const float dy = SDL_max(center->y, dstrect->h - center->y);
+            const float radius = SDL_sqrtf(dx * dx + dy * dy);
+            const float x1 = (cx - radius) * scale_x;
+            const float y1 = (cy - radius) * scale_y;
+            const float x2 = (cx + radius) * scale_x;
+            const float y2 = (cy + radius) * scale_y;
+
+            SetDrawCommandBounds(renderer, cmd, SDL_min(x1, x2), SDL_min(y1, y2), SDL_max(x1, x2), SDL_max(y1, y2));
         }
     }
     return retval;
@@ -637,6 +1188,22 @@ static int QueueCmdGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
                                          scale_x, scale_y);
         if (retval < 0) {
             cmd->command = SDL_RENDERCMD_NO_OP;
+        } else if (renderer->reorder_commands && num_vertices > 0) {
+            float minx, miny, maxx, maxy;
+            int i;
+
+            minx = maxx = xy[0] * scale_x;
+            miny = maxy = xy[1] * scale_y;
+            for (i = 1; i < num_vertices; ++i) {
+                const float *v = (const float *)((const Uint8 *)xy + i * xy_stride);
+                const float x = v[0] * scale_x;
+                const float y = v[1] * scale_y;
+                minx = SDL_min(minx, x);
+                miny = SDL_min(miny, y);
+                maxx = SDL_max(maxx, x);
+                maxy = SDL_max(maxy, y);
+            }
+            SetDrawCommandBounds(renderer, cmd, minx, miny, maxx, maxy);
         }
     }
     return retval;
@@ -1055,6 +1622,8 @@ SDL_Renderer *SDL_CreateRenderer(SDL_Window *window, int index, Uint32 flags)
     }
 
     renderer->batching = batching;
+    renderer->reorder_commands = batching && SDL_GetHintBoolean(SDL_HINT_RENDER_REORDER_COMMANDS, SDL_FALSE);
+    InitRenderVertexBuffers(renderer);
     renderer->magic = &renderer_magic;
     renderer->window = window;
     renderer->target_mutex = SDL_CreateMutex();
@@ -1143,6 +1712,10 @@ SDL_Renderer *SDL_CreateSoftwareRenderer(SDL_Surface *surface)
         /* Software renderer always uses line method, for speed */
         renderer->line_method = SDL_RENDERLINEMETHOD_LINES;
 
+        /* Drawing shows up on the surface right away, unless the app asks for batching */
+        renderer->batching = SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE);
+        renderer->reorder_commands = renderer->batching && SDL_GetHintBoolean(SDL_HINT_RENDER_REORDER_COMMANDS, SDL_FALSE);
+
         SDL_RenderSetViewport(renderer, NULL);
     }
     return renderer;
@@ -1677,6 +2250,15 @@ static int SDL_UpdateTextureYUV(SDL_Texture *texture, const SDL_Rect *rect,
     SDL_Texture *native = texture->native;
     SDL_Rect full_rect;
 
+    if (!native) {
+        /* The renderer converts the planes itself when it draws them */
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
+        NoteTextureUpdate(texture, rect);
+        return SDL_SW_UpdateYUVTexture(texture->yuv, rect, pixels, pitch);
+    }
+
     if (SDL_SW_UpdateYUVTexture(texture->yuv, rect, pixels, pitch) < 0) {
         return -1;
     }
@@ -1794,6 +2376,7 @@ int SDL_UpdateTexture(SDL_Texture *texture, const SDL_Rect *rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        NoteTextureUpdate(texture, &real_rect);
         return renderer->UpdateTexture(renderer, texture, &real_rect, pixels, pitch);
     }
 }
@@ -1807,6 +2390,14 @@ static int SDL_UpdateTextureYUVPlanar(SDL_Texture *texture, const SDL_Rect *rect
     SDL_Texture *native = texture->native;
     SDL_Rect full_rect;
 
+    if (!native) {
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
+        NoteTextureUpdate(texture, rect);
+        return SDL_SW_UpdateYUVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
+    }
+
     if (SDL_SW_UpdateYUVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch) < 0) {
         return -1;
     }
@@ -1857,6 +2448,14 @@ static int SDL_UpdateTextureNVPlanar(SDL_Texture *texture, const SDL_Rect *rect,
     SDL_Texture *native = texture->native;
     SDL_Rect full_rect;
 
+    if (!native) {
+        if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
+            return -1;
+        }
+        NoteTextureUpdate(texture, rect);
+        return SDL_SW_UpdateNVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, UVplane, UVpitch);
+    }
+
     if (SDL_SW_UpdateNVTexturePlanar(texture->yuv, rect, Yplane, Ypitch, UVplane, UVpitch) < 0) {
         return -1;
     }
@@ -1959,6 +2558,7 @@ int SDL_UpdateYUVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
+            NoteTextureUpdate(texture, &real_rect);
             return renderer->UpdateTextureYUV(renderer, texture, &real_rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
         } else {
             return SDL_Unsupported();
@@ -2019,6 +2619,7 @@ int SDL_UpdateNVTexture(SDL_Texture *texture, const SDL_Rect *rect,
             if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
                 return -1;
             }
+            NoteTextureUpdate(texture, &real_rect);
             return renderer->UpdateTextureNV(renderer, texture, &real_rect, Yplane, Ypitch, UVplane, UVpitch);
         } else {
             return SDL_Unsupported();
@@ -2083,6 +2684,7 @@ int SDL_LockTexture(SDL_Texture *texture, const SDL_Rect *rect,
         if (FlushRenderCommandsIfTextureNeeded(texture) < 0) {
             return -1;
         }
+        texture->locked_rect = *rect; /* counted as an upload when unlocked */
         return renderer->LockTexture(renderer, texture, rect, pixels, pitch);
     }
 }
@@ -2135,6 +2737,11 @@ static void SDL_UnlockTextureYUV(SDL_Texture *texture)
     rect.w = texture->w;
     rect.h = texture->h;
 
+    if (!native) {
+        NoteTextureUpdate(texture, &rect);
+        return;
+    }
+
     if (SDL_LockTexture(native, &rect, &native_pixels, &native_pitch) < 0) {
         return;
     }
@@ -2180,6 +2787,7 @@ void SDL_UnlockTexture(SDL_Texture *texture)
         SDL_UnlockTextureNative(texture);
     } else {
         SDL_Renderer *renderer = texture->renderer;
+        NoteTextureUpdate(texture, &texture->locked_rect);
         renderer->UnlockTexture(renderer, texture);
     }
 
@@ -2221,7 +2829,7 @@ int SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         return 0;
     }
 
-    FlushRenderCommands(renderer); /* time to send everything to the GPU! */
+    FlushRenderCommands(renderer, SDL_RENDERFLUSH_TARGET); /* time to send everything to the GPU! */
 
     SDL_LockMutex(renderer->target_mutex);
 
@@ -3512,6 +4120,220 @@ int SDL_RenderCopyF(SDL_Renderer *renderer, SDL_Texture *texture,
     return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
 }
 
+typedef struct
+{
+    float x, y;
+    float u, v;
+    SDL_Color color;
+} SDL_BatchVertex;
+
+static void *GetRenderBatchData(SDL_Renderer *renderer, size_t size)
+{
+    if (renderer->batch_data_allocation < size) {
+        void *ptr = SDL_realloc(renderer->batch_data, size);
+        if (!ptr) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->batch_data = ptr;
+        renderer->batch_data_allocation = size;
+    }
+    return renderer->batch_data;
+}
+
+static void ModulateBatchColor(SDL_Color *color, const SDL_Color *texture_color, const SDL_Color *sprite_color)
+{
+    if (sprite_color) {
+        color->r = (Uint8)(((int)texture_color->r * sprite_color->r) / 255);
+        color->g = (Uint8)(((int)texture_color->g * sprite_color->g) / 255);
+        color->b = (Uint8)(((int)texture_color->b * sprite_color->b) / 255);
+        color->a = (Uint8)(((int)texture_color->a * sprite_color->a) / 255);
+    } else {
+        *color = *texture_color;
+    }
+}
+
+/* Clip a sprite to the texture and the viewport, returns SDL_FALSE if it isn't visible */
+static SDL_bool GetBatchSpriteRects(SDL_Texture *texture, const SDL_FRect *viewport,
+                                    const SDL_Rect *srcrect, const SDL_FRect *dstrect,
+                                    SDL_Rect *real_srcrect)
+{
+    real_srcrect->x = 0;
+    real_srcrect->y = 0;
+    real_srcrect->w = texture->w;
+    real_srcrect->h = texture->h;
+    if (srcrect) {
+        if (!SDL_IntersectRect(srcrect, real_srcrect, real_srcrect)) {
+            return SDL_FALSE;
+        }
+    }
+    return SDL_HasIntersectionF(dstrect, viewport);
+}
+
+static int RenderCopyBatchGeometry(SDL_Renderer *renderer, SDL_Texture *texture,
+                                   const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                                   const SDL_Color *colors, int count)
+{
+    const size_t vertices_size = 4 * count * sizeof(SDL_BatchVertex);
+    SDL_BatchVertex *vertices;
+    int *indices;
+    SDL_FRect viewport;
+    int i, j, num_sprites = 0;
+
+    vertices = (SDL_BatchVertex *)GetRenderBatchData(renderer, vertices_size + 6 * count * sizeof(int));
+    if (!vertices) {
+        return -1;
+    }
+    indices = (int *)((Uint8 *)vertices + vertices_size);
+
+    RenderGetViewportSize(renderer, &viewport);
+
+    for (i = 0; i < count; ++i) {
+        const SDL_FRect *dstrect = &dstrects[i];
+        SDL_BatchVertex *vertex = &vertices[4 * num_sprites];
+        SDL_Rect real_srcrect;
+        SDL_Color color;
+        float minu, minv, maxu, maxv;
+
+        if (!GetBatchSpriteRects(texture, &viewport, srcrects ? &srcrects[i] : NULL, dstrect, &real_srcrect)) {
+            continue;
+        }
+
+        minu = (float)(real_srcrect.x) / (float)texture->w;
+        minv = (float)(real_srcrect.y) / (float)texture->h;
+        maxu = (float)(real_srcrect.x + real_srcrect.w) / (float)texture->w;
+        maxv = (float)(real_srcrect.y + real_srcrect.h) / (float)texture->h;
+        ModulateBatchColor(&color, &texture->color, colors ? &colors[i] : NULL);
+
+        vertex[0].x = dstrect->x;
+        vertex[0].y = dstrect->y;
+        vertex[0].u = minu;
+        vertex[0].v = minv;
+        vertex[1].x = dstrect->x + dstrect->w;
+        vertex[1].y = dstrect->y;
+        vertex[1].u = maxu;
+        vertex[1].v = minv;
+        vertex[2].x = dstrect->x + dstrect->w;
+        vertex[2].y = dstrect->y + dstrect->h;
+        vertex[2].u = maxu;
+        vertex[2].v = maxv;
+        vertex[3].x = dstrect->x;
+        vertex[3].y = dstrect->y + dstrect->h;
+        vertex[3].u = minu;
+        vertex[3].v = maxv;
+        for (j = 0; j < 4; ++j) {
+            vertex[j].color = color;
+        }
+        for (j = 0; j < 6; ++j) {
+            indices[6 * num_sprites + j] = 4 * num_sprites + renderer->rect_index_order[j];
+        }
+        ++num_sprites;
+    }
+
+    if (num_sprites == 0) {
+        return 0;
+    }
+    return QueueCmdGeometry(renderer, texture,
+                            &vertices->x, sizeof(*vertices), &vertices->color, sizeof(*vertices), &vertices->u, sizeof(*vertices),
+                            4 * num_sprites,
+                            indices, 6 * num_sprites, sizeof(int),
+                            renderer->scale.x, renderer->scale.y);
+}
+
+static int RenderCopyBatchCopies(SDL_Renderer *renderer, SDL_Texture *texture,
+                                 const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                                 const SDL_Color *colors, int count)
+{
+    const size_t srcrects_size = count * sizeof(SDL_Rect);
+    SDL_Rect *real_srcrects;
+    SDL_FRect *real_dstrects;
+    SDL_FRect viewport;
+    SDL_Color color, run_color;
+    int i, run = 0;
+
+    real_srcrects = (SDL_Rect *)GetRenderBatchData(renderer, srcrects_size + count * sizeof(SDL_FRect));
+    if (!real_srcrects) {
+        return -1;
+    }
+    real_dstrects = (SDL_FRect *)((Uint8 *)real_srcrects + srcrects_size);
+
+    RenderGetViewportSize(renderer, &viewport);
+    SDL_zero(run_color);
+
+    for (i = 0; i < count; ++i) {
+        const SDL_FRect *dstrect = &dstrects[i];
+
+        if (!GetBatchSpriteRects(texture, &viewport, srcrects ? &srcrects[i] : NULL, dstrect, &real_srcrects[run])) {
+            continue;
+        }
+
+        /* Copies with the same color go into the same command */
+        ModulateBatchColor(&color, &texture->color, colors ? &colors[i] : NULL);
+        if (run > 0 && SDL_memcmp(&color, &run_color, sizeof(color)) != 0) {
+            if (QueueCmdCopies(renderer, texture, &run_color, real_srcrects, real_dstrects, run) < 0) {
+                return -1;
+            }
+            real_srcrects[0] = real_srcrects[run];
+            run = 0;
+        }
+        run_color = color;
+
+        real_dstrects[run].x = dstrect->x * renderer->scale.x;
+        real_dstrects[run].y = dstrect->y * renderer->scale.y;
+        real_dstrects[run].w = dstrect->w * renderer->scale.x;
+        real_dstrects[run].h = dstrect->h * renderer->scale.y;
+        ++run;
+    }
+
+    if (run > 0) {
+        return QueueCmdCopies(renderer, texture, &run_color, real_srcrects, real_dstrects, run);
+    }
+    return 0;
+}
+
+int SDL_RenderCopyBatchF(SDL_Renderer *renderer, SDL_Texture *texture,
+                         const SDL_Rect *srcrects, const SDL_FRect *dstrects,
+                         const SDL_Color *colors, int count)
+{
+    int retval;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!dstrects) {
+        return SDL_InvalidParamError("dstrects");
+    }
+    if (count < 0) {
+        return SDL_InvalidParamError("count");
+    }
+    if (count == 0) {
+        return 0;
+    }
+
+#if DONT_DRAW_WHILE_HIDDEN
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+#endif
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+
+    texture->last_command_generation = renderer->render_command_generation;
+
+    if (renderer->QueueCopy) {
+        retval = RenderCopyBatchCopies(renderer, texture, srcrects, dstrects, colors, count);
+    } else {
+        retval = RenderCopyBatchGeometry(renderer, texture, srcrects, dstrects, colors, count);
+    }
+    return retval < 0 ? retval : FlushRenderCommandsIfNotBatching(renderer);
+}
+
 int SDL_RenderCopyEx(SDL_Renderer *renderer, SDL_Texture *texture,
                      const SDL_Rect *srcrect, const SDL_Rect *dstrect,
                      const double angle, const SDL_Point *center, const SDL_RendererFlip flip)
@@ -4197,7 +5019,7 @@ int SDL_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
         return SDL_Unsupported();
     }
 
-    FlushRenderCommands(renderer); /* we need to render before we read the results. */
+    FlushRenderCommands(renderer, SDL_RENDERFLUSH_READ_PIXELS); /* we need to render before we read the results. */
 
     if (!format) {
         if (!renderer->target) {
@@ -4261,7 +5083,7 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
 
     CHECK_RENDERER_MAGIC(renderer, );
 
-    FlushRenderCommands(renderer); /* time to send everything to the GPU! */
+    FlushRenderCommands(renderer, SDL_RENDERFLUSH_PRESENT); /* time to send everything to the GPU! */
 
 #if DONT_DRAW_WHILE_HIDDEN
     /* Don't present while we're hidden */
@@ -4273,12 +5095,31 @@ void SDL_RenderPresent(SDL_Renderer *renderer)
         presented = SDL_FALSE;
     }
 
+    ShrinkRenderVertexBuffer(renderer, renderer->stats.vertex_bytes_high_water);
+
+    /* This frame is done, start counting the next one */
+    renderer->stats.vertex_bytes_peak = (Uint32)renderer->vertex_data_peak;
+    renderer->stats.vertex_buffer_bytes = (Uint32)renderer->vertex_data_allocation;
+    renderer->last_stats = renderer->stats;
+    SDL_zero(renderer->stats);
+
     if (renderer->simulate_vsync ||
         (!presented && renderer->wanted_vsync)) {
         SDL_RenderSimulateVSync(renderer);
     }
 }
 
+int SDL_RenderGetStats(SDL_Renderer *renderer, SDL_RenderStats *stats)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!stats) {
+        return SDL_InvalidParamError("stats");
+    }
+    *stats = renderer->last_stats;
+    return 0;
+}
+
 void SDL_DestroyTexture(SDL_Texture *texture)
 {
     SDL_Renderer *renderer;
@@ -4347,6 +5188,8 @@ void SDL_DestroyRenderer(SDL_Renderer *renderer)
     }
 
     SDL_free(renderer->vertex_data);
+    SDL_free(renderer->reorder_vertex_data);
+    SDL_free(renderer->batch_data);
 
     /* Free existing textures for this renderer */
     while (renderer->textures) {
@@ -4408,7 +5251,7 @@ void *SDL_RenderGetMetalLayer(SDL_Renderer *renderer)
     CHECK_RENDERER_MAGIC(renderer, NULL);
 
     if (renderer->GetMetalLayer) {
-        FlushRenderCommands(renderer); /* in case the app is going to mess with it. */
+        FlushRenderCommands(renderer, SDL_RENDERFLUSH_EXPLICIT); /* in case the app is going to mess with it. */
         return renderer->GetMetalLayer(renderer);
     }
     return NULL;
@@ -4419,7 +5262,7 @@ void *SDL_RenderGetMetalCommandEncoder(SDL_Renderer *renderer)
     CHECK_RENDERER_MAGIC(renderer, NULL);
 
     if (renderer->GetMetalCommandEncoder) {
-        FlushRenderCommands(renderer); /* in case the app is going to mess with it. */
+        FlushRenderCommands(renderer, SDL_RENDERFLUSH_EXPLICIT); /* in case the app is going to mess with it. */
         return renderer->GetMetalCommandEncoder(renderer);
     }
     return NULL;
@@ -4442,6 +5285,9 @@ static SDL_BlendMode SDL_GetShortBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL_FULL) {
         return SDL_BLENDMODE_MUL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+    }
     return blendMode;
 }
 
@@ -4462,6 +5308,9 @@ static SDL_BlendMode SDL_GetLongBlendMode(SDL_BlendMode blendMode)
     if (blendMode == SDL_BLENDMODE_MUL) {
         return SDL_BLENDMODE_MUL_FULL;
     }
+    if (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) {
+        return SDL_BLENDMODE_BLEND_PREMULTIPLIED_FULL;
+    }
     return blendMode;
 }
 
@@ -65,13 +65,14 @@ struct SDL_Texture
 
     /* Support for formats not supported directly by the renderer */
     SDL_Texture *native;
-    SDL_SW_YUVTexture *yuv;
+    SDL_SW_YUVTexture *yuv; /**< Renderers that convert YUV as they draw keep this without a native texture */
     void *pixels;
     int pitch;
     SDL_Rect locked_rect;
     SDL_Surface *locked_surface; /**< Locked region exposed as a SDL surface */
 
     Uint32 last_command_generation; /* last command queue generation this texture was in. */
+    Uint32 version;                 /* changes whenever the texture contents may have changed */
 
     void *driverdata; /**< Driver specific texture representation */
     void *userdata;
@@ -117,6 +118,9 @@ typedef struct SDL_RenderCommand
             Uint8 r, g, b, a;
             SDL_BlendMode blend;
             SDL_Texture *texture;
+            SDL_FRect bounds;        /* area this draw can touch, relative to the viewport. Unknown if w < 0. */
+            size_t vertex_end;       /* end of this draw's vertex data */
+            size_t vertex_alignment; /* alignment the backend requested for the vertex data */
         } draw;
         struct
         {
@@ -278,9 +282,28 @@ struct SDL_Renderer
     SDL_bool viewport_queued;
     SDL_bool cliprect_queued;
 
+    /* Whether non-overlapping draws may be sorted and merged before they're flushed */
+    SDL_bool reorder_commands;
+
     void *vertex_data;
     size_t vertex_data_used;
     size_t vertex_data_allocation;
+    size_t vertex_data_max_alignment;
+    size_t vertex_data_peak;
+
+    size_t vertex_data_reserved; /* never shrink the vertex arena below this */
+    int vertex_data_shrink_frames;
+    int vertex_data_idle_frames;
+    size_t vertex_data_idle_high_water;
+
+    void *reorder_vertex_data;
+    size_t reorder_vertex_data_allocation;
+
+    void *batch_data;
+    size_t batch_data_allocation;
+
+    SDL_RenderStats stats;      /* counters for the frame being rendered */
+    SDL_RenderStats last_stats; /* counters for the last presented frame */
 
     void *driverdata;
 };
@@ -324,6 +347,7 @@ extern void *SDL_AllocateRenderVertices(SDL_Renderer *renderer, const size_t num
 
 extern int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
 extern int SDL_PrivateUpperBlitScaled(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode);
+extern int SDL_PrivateBlitScaledLinearRows(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect, const SDL_Rect *cliprect);
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
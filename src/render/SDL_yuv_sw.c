@@ -40,6 +40,8 @@ SDL_SW_YUVTexture *SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     case SDL_PIXELFORMAT_YVYU:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         break;
     default:
         SDL_SetError("Unsupported YUV format");
@@ -97,6 +99,14 @@ SDL_SW_YUVTexture *SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         break;
 
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        swdata->pitches[0] = 2 * w;
+        swdata->pitches[1] = 2 * (2 * ((w + 1) / 2));
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        break;
+
     default:
         SDL_assert(0 && "We should never get here (caught above)");
         break;
@@ -215,7 +225,34 @@ int SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
                 dst += 2 * ((swdata->w + 1) / 2);
             }
         }
-    }
+    } break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+    {
+        Uint8 *src, *dst;
+        int row;
+        size_t length;
+
+        /* Copy the Y plane */
+        src = (Uint8 *)pixels;
+        dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x * 2;
+        length = (size_t)rect->w * 2;
+        for (row = 0; row < rect->h; ++row) {
+            SDL_memcpy(dst, src, length);
+            src += pitch;
+            dst += swdata->pitches[0];
+        }
+
+        /* Copy the U/V plane, laid out like the one of NV12 with 16-bit samples */
+        src = (Uint8 *)pixels + rect->h * pitch;
+        dst = swdata->planes[1] + rect->y / 2 * swdata->pitches[1] + 4 * (rect->x / 2);
+        length = 4 * (((size_t)rect->w + 1) / 2);
+        for (row = 0; row < (rect->h + 1) / 2; ++row) {
+            SDL_memcpy(dst, src, length);
+            src += 2 * (2 * ((pitch / 2 + 1) / 2));
+            dst += swdata->pitches[1];
+        }
+    } break;
     }
     return 0;
 }
@@ -316,8 +353,10 @@ int SDL_SW_LockYUVTexture(SDL_SW_YUVTexture *swdata, const SDL_Rect *rect,
     case SDL_PIXELFORMAT_IYUV:
     case SDL_PIXELFORMAT_NV12:
     case SDL_PIXELFORMAT_NV21:
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
         if (rect && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w || rect->h != swdata->h)) {
-            return SDL_SetError("YV12, IYUV, NV12, NV21 textures only support full surface locks");
+            return SDL_SetError("YV12, IYUV, NV12, NV21, P010, P016 textures only support full surface locks");
         }
         break;
     }
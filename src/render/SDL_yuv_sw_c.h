@@ -42,6 +42,9 @@ struct SDL_SW_YUVTexture
     /* This is a temporary surface in case we have to stretch copy */
     SDL_Surface *stretch;
     SDL_Surface *display;
+
+    /* The texture version last converted to RGB by a renderer drawing from the planes */
+    Uint32 rgb_version;
 };
 
 typedef struct SDL_SW_YUVTexture SDL_SW_YUVTexture;
@@ -840,10 +840,15 @@ PSL1GHT_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *ve
             }
 
             case SDL_RENDERCMD_COPY: {
+                const size_t count = cmd->data.draw.count;
                 const size_t first = cmd->data.draw.first;
                 PSL1GHT_CopyData *copyData = (PSL1GHT_CopyData *) (((Uint8 *) vertices) + first);
+                size_t i;
 
-                PSL1GHT_RenderCopy(renderer, cmd->data.draw.texture, &copyData->srcRect, &copyData->dstRect);
+                /* Several copies of the same texture may have been combined into one command */
+                for (i = 0; i < count; i++, copyData++) {
+                    PSL1GHT_RenderCopy(renderer, cmd->data.draw.texture, &copyData->srcRect, &copyData->dstRect);
+                }
                 break;
             }
 
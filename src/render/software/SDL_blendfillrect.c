@@ -34,6 +34,9 @@ static int SDL_BlendFillRect_RGB555(SDL_Surface *dst, const SDL_Rect *rect,
     case SDL_BLENDMODE_BLEND:
         FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB555);
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_CLAMPED_RGB555);
+        break;
     case SDL_BLENDMODE_ADD:
         FILLRECT(Uint16, DRAW_SETPIXEL_ADD_RGB555);
         break;
@@ -59,6 +62,9 @@ static int SDL_BlendFillRect_RGB565(SDL_Surface *dst, const SDL_Rect *rect,
     case SDL_BLENDMODE_BLEND:
         FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB565);
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_CLAMPED_RGB565);
+        break;
     case SDL_BLENDMODE_ADD:
         FILLRECT(Uint16, DRAW_SETPIXEL_ADD_RGB565);
         break;
@@ -84,6 +90,9 @@ static int SDL_BlendFillRect_RGB888(SDL_Surface *dst, const SDL_Rect *rect,
     case SDL_BLENDMODE_BLEND:
         FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGB888);
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_CLAMPED_RGB888);
+        break;
     case SDL_BLENDMODE_ADD:
         FILLRECT(Uint32, DRAW_SETPIXEL_ADD_RGB888);
         break;
@@ -109,6 +118,9 @@ static int SDL_BlendFillRect_ARGB8888(SDL_Surface *dst, const SDL_Rect *rect,
     case SDL_BLENDMODE_BLEND:
         FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_ARGB8888);
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_CLAMPED_ARGB8888);
+        break;
     case SDL_BLENDMODE_ADD:
         FILLRECT(Uint32, DRAW_SETPIXEL_ADD_ARGB8888);
         break;
@@ -137,6 +149,9 @@ static int SDL_BlendFillRect_RGB(SDL_Surface *dst, const SDL_Rect *rect,
         case SDL_BLENDMODE_BLEND:
             FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_RGB);
             break;
+        case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+            FILLRECT(Uint16, DRAW_SETPIXEL_BLEND_CLAMPED_RGB);
+            break;
         case SDL_BLENDMODE_ADD:
             FILLRECT(Uint16, DRAW_SETPIXEL_ADD_RGB);
             break;
@@ -156,6 +171,9 @@ static int SDL_BlendFillRect_RGB(SDL_Surface *dst, const SDL_Rect *rect,
         case SDL_BLENDMODE_BLEND:
             FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGB);
             break;
+        case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+            FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_CLAMPED_RGB);
+            break;
         case SDL_BLENDMODE_ADD:
             FILLRECT(Uint32, DRAW_SETPIXEL_ADD_RGB);
             break;
@@ -187,6 +205,9 @@ static int SDL_BlendFillRect_RGBA(SDL_Surface *dst, const SDL_Rect *rect,
         case SDL_BLENDMODE_BLEND:
             FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_RGBA);
             break;
+        case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+            FILLRECT(Uint32, DRAW_SETPIXEL_BLEND_CLAMPED_RGBA);
+            break;
         case SDL_BLENDMODE_ADD:
             FILLRECT(Uint32, DRAW_SETPIXEL_ADD_RGBA);
             break;
@@ -34,6 +34,8 @@
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
 #include "SDL_triangle.h"
+#include "../../thread/SDL_jobs_c.h"
+#include "../../video/SDL_yuv_c.h"
 
 /* SDL surface based renderer implementation */
 
@@ -44,10 +46,45 @@ typedef struct
     SDL_bool surface_cliprect_dirty;
 } SW_DrawStateCache;
 
+struct SW_TiledDraw;
+struct SW_TileItem;
+struct SW_RotatedSurface;
+
+/* YUV textures keep an RGB copy in this format for the draws that can't convert as they go */
+#define SW_YUV_RGB_FORMAT SDL_PIXELFORMAT_ARGB8888
+
+/* Changes covering more of the window than this are presented as a full update */
+#define SW_MAX_DIRTY_RECTS    16
+#define SW_DIRTY_FULL_PERCENT 75
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Scratch space for tile-parallel rendering */
+    struct SW_TiledDraw *tiled_draws;
+    SDL_Surface **tiled_textures;
+    int tiled_draws_allocation;
+    struct SW_TileItem *tile_items;
+    int tile_items_allocation;
+    int *tile_item_ends;
+    int tile_item_ends_allocation;
+
+    /* Recently rotated copies, and scratch surfaces for rotating */
+    struct SW_RotatedSurface *rotate_cache;
+    int rotate_cache_size;
+    int rotate_cache_count;
+    size_t rotate_cache_bytes;
+    Uint32 rotate_cache_clock;
+    SDL_Surface *scratch_scaled;
+    SDL_Surface *scratch_mask;
+
+    /* Parts of the window surface drawn since the last present */
+    SDL_bool dirty_rects_enabled;
+    SDL_bool dirty_full;
+    SDL_Rect dirty_rects[SW_MAX_DIRTY_RECTS];
+    int num_dirty_rects;
 } SW_RenderData;
 
 static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
@@ -61,6 +98,8 @@ static SDL_Surface *SW_ActivateRenderer(SDL_Renderer *renderer)
         SDL_Surface *surface = SDL_GetWindowSurface(renderer->window);
         if (surface) {
             data->surface = data->window = surface;
+            /* Nothing on a new window surface has been presented yet */
+            data->dirty_full = SDL_TRUE;
         }
     }
     return data->surface;
@@ -70,12 +109,28 @@ static void SW_WindowEvent(SDL_Renderer *renderer, const SDL_WindowEvent *event)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
 
-    if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
-        data->surface = NULL;
-        data->window = NULL;
+    switch (event->event) {
+        case SDL_WINDOWEVENT_SIZE_CHANGED:
+            data->surface = NULL;
+            data->window = NULL;
+            break;
+        case SDL_WINDOWEVENT_EXPOSED:
+        case SDL_WINDOWEVENT_SHOWN:
+        case SDL_WINDOWEVENT_RESTORED:
+            /* The system may have lost what was presented, so present the whole surface again */
+            data->dirty_full = SDL_TRUE;
+            break;
+        default:
+            break;
     }
 }
 
+static SDL_bool SW_SupportsBlendMode(SDL_Renderer *renderer, SDL_BlendMode blendMode)
+{
+    /* The surface blitters and drawing primitives handle this one besides the required modes */
+    return (blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED) ? SDL_TRUE : SDL_FALSE;
+}
+
 static int SW_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
 {
     SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
@@ -100,15 +155,27 @@ static int SW_GetOutputSize(SDL_Renderer *renderer, int *w, int *h)
 
 static int SW_CreateTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
+    Uint32 format = texture->format;
     int bpp;
     Uint32 Rmask, Gmask, Bmask, Amask;
 
-    if (!SDL_PixelFormatEnumToMasks(texture->format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
+#if SDL_HAVE_YUV
+    if (SDL_ISPIXELFORMAT_FOURCC(format)) {
+        texture->yuv = SDL_SW_CreateYUVTexture(format, texture->w, texture->h);
+        if (!texture->yuv) {
+            return -1;
+        }
+        format = SW_YUV_RGB_FORMAT;
+    }
+#endif
+
+    if (!SDL_PixelFormatEnumToMasks(format, &bpp, &Rmask, &Gmask, &Bmask, &Amask)) {
         return SDL_SetError("Unknown texture format");
     }
 
+    /* Aligned rows let the blitters use aligned vector loads and stores */
     texture->driverdata =
-        SDL_CreateRGBSurface(0, texture->w, texture->h, bpp, Rmask, Gmask,
+        SDL_CreateRGBSurface(SDL_SIMD_PITCH, texture->w, texture->h, bpp, Rmask, Gmask,
                              Bmask, Amask);
     SDL_SetSurfaceColorMod(texture->driverdata, texture->color.r, texture->color.g, texture->color.b);
     SDL_SetSurfaceAlphaMod(texture->driverdata, texture->color.a);
@@ -309,29 +376,164 @@ static int Blit_to_Screen(SDL_Surface *src, SDL_Rect *srcrect, SDL_Surface *surf
     return retval;
 }
 
-static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
-                           const SDL_Rect *srcrect, const SDL_Rect *final_rect,
-                           const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip, float scale_x, float scale_y)
+/* Rotated copy cache
+ *
+ * Rotating a texture allocates and fills several surfaces, so the result of
+ * a transform is kept for a while and reused when the same texture contents
+ * are drawn with the same transform again, like a rotated HUD element that
+ * is redrawn every frame.
+ */
+
+#define SW_ROTATE_CACHE_DEFAULT_SIZE 16
+#define SW_ROTATE_CACHE_MAX_BYTES    (8 * 1024 * 1024)
+
+typedef struct SW_RotatedSurface
+{
+    /* What was transformed */
+    SDL_Texture *texture;
+    Uint32 version;
+    SDL_Rect srcrect;
+    int w, h;
+    double angle;
+    SDL_FPoint center;
+    SDL_RendererFlip flip;
+    SDL_ScaleMode scale_mode;
+    SDL_BlendMode blend_mode;
+    SDL_Color color; /* the modulation, if it was applied before the rotation */
+
+    /* The result */
+    SDL_Surface *rotated;
+    SDL_Surface *mask; /* the rotated mask used with the NONE blend mode */
+    SDL_Rect rect_dest;
+    size_t size;
+    Uint32 last_used;
+} SW_RotatedSurface;
+
+static SDL_bool SW_RotatedSurfaceMatches(const SW_RotatedSurface *a, const SW_RotatedSurface *b)
+{
+    return a->texture == b->texture && a->version == b->version &&
+           a->srcrect.x == b->srcrect.x && a->srcrect.y == b->srcrect.y &&
+           a->srcrect.w == b->srcrect.w && a->srcrect.h == b->srcrect.h &&
+           a->w == b->w && a->h == b->h && a->angle == b->angle &&
+           a->center.x == b->center.x && a->center.y == b->center.y &&
+           a->flip == b->flip && a->scale_mode == b->scale_mode && a->blend_mode == b->blend_mode &&
+           a->color.r == b->color.r && a->color.g == b->color.g &&
+           a->color.b == b->color.b && a->color.a == b->color.a;
+}
+
+static SW_RotatedSurface *SW_GetRotatedSurface(SW_RenderData *data, const SW_RotatedSurface *key)
+{
+    int i;
+
+    for (i = 0; i < data->rotate_cache_count; ++i) {
+        SW_RotatedSurface *entry = &data->rotate_cache[i];
+        if (SW_RotatedSurfaceMatches(entry, key)) {
+            entry->last_used = ++data->rotate_cache_clock;
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void SW_RemoveRotatedSurface(SW_RenderData *data, int index)
+{
+    SW_RotatedSurface *entry = &data->rotate_cache[index];
+
+    SDL_FreeSurface(entry->rotated);
+    SDL_FreeSurface(entry->mask);
+    data->rotate_cache_bytes -= entry->size;
+    data->rotate_cache[index] = data->rotate_cache[--data->rotate_cache_count];
+}
+
+/* Returns the cache entry that took ownership of the surfaces, or NULL if they weren't cached */
+static SW_RotatedSurface *SW_CacheRotatedSurface(SW_RenderData *data, const SW_RotatedSurface *key,
+                                                 SDL_Surface *rotated, SDL_Surface *mask, const SDL_Rect *rect_dest)
+{
+    SW_RotatedSurface *entry;
+    size_t size = (size_t)rotated->h * rotated->pitch;
+
+    if (mask) {
+        size += (size_t)mask->h * mask->pitch;
+    }
+
+    /* Don't let a single large transform flush everything else */
+    if (data->rotate_cache_size <= 0 || size > SW_ROTATE_CACHE_MAX_BYTES / 2) {
+        return NULL;
+    }
+
+    while (data->rotate_cache_count > 0 &&
+           (data->rotate_cache_count >= data->rotate_cache_size ||
+            data->rotate_cache_bytes + size > SW_ROTATE_CACHE_MAX_BYTES)) {
+        int i, oldest = 0;
+
+        for (i = 1; i < data->rotate_cache_count; ++i) {
+            if (data->rotate_cache[i].last_used < data->rotate_cache[oldest].last_used) {
+                oldest = i;
+            }
+        }
+        SW_RemoveRotatedSurface(data, oldest);
+    }
+
+    if (!data->rotate_cache) {
+        data->rotate_cache = (SW_RotatedSurface *)SDL_malloc(data->rotate_cache_size * sizeof(*data->rotate_cache));
+        if (!data->rotate_cache) {
+            return NULL;
+        }
+    }
+
+    entry = &data->rotate_cache[data->rotate_cache_count++];
+    *entry = *key;
+    entry->rotated = rotated;
+    entry->mask = mask;
+    entry->rect_dest = *rect_dest;
+    entry->size = size;
+    entry->last_used = ++data->rotate_cache_clock;
+    data->rotate_cache_bytes += size;
+    return entry;
+}
+
+static void SW_InvalidateRotatedSurfaces(SW_RenderData *data, SDL_Texture *texture)
+{
+    int i = 0;
+
+    while (i < data->rotate_cache_count) {
+        if (!texture || data->rotate_cache[i].texture == texture) {
+            SW_RemoveRotatedSurface(data, i);
+        } else {
+            ++i;
+        }
+    }
+}
+
+/* Scratch surfaces are kept between calls, rotating sprites of the same size doesn't allocate */
+static SDL_Surface *SW_GetScratchSurface(SDL_Surface **scratch, int w, int h)
+{
+    if (*scratch && ((*scratch)->w != w || (*scratch)->h != h)) {
+        SDL_FreeSurface(*scratch);
+        *scratch = NULL;
+    }
+    if (!*scratch) {
+        *scratch = SDL_CreateRGBSurface(0, w, h, 32, 0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+    }
+    return *scratch;
+}
+
+/* Scale, crop and modulate the source as needed, then rotate it and the mask for the NONE blend mode */
+static int SW_RotateSurface(SW_RenderData *data, SDL_Texture *texture, const SDL_Rect *srcrect, const SDL_Rect *final_rect,
+                            const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip,
+                            SDL_bool blitRequired, SDL_bool applyModulation, SDL_bool needMask,
+                            SDL_Surface **rotated, SDL_Surface **mask_rotated, SDL_Rect *rect_dest)
 {
     SDL_Surface *src = (SDL_Surface *)texture->driverdata;
-    SDL_Rect tmp_rect;
-    SDL_Surface *src_clone, *src_rotated, *src_scaled;
-    SDL_Surface *mask = NULL, *mask_rotated = NULL;
-    int retval = 0;
+    SDL_Surface *src_clone, *src_scaled = NULL;
+    SDL_Surface *mask = NULL;
     SDL_BlendMode blendmode;
     Uint8 alphaMod, rMod, gMod, bMod;
-    int applyModulation = SDL_FALSE;
-    int blitRequired = SDL_FALSE;
-    int isOpaque = SDL_FALSE;
-
-    if (!surface) {
-        return -1;
-    }
+    double cangle, sangle;
+    int retval = 0;
 
-    tmp_rect.x = 0;
-    tmp_rect.y = 0;
-    tmp_rect.w = final_rect->w;
-    tmp_rect.h = final_rect->h;
+    *rotated = NULL;
+    *mask_rotated = NULL;
 
     /* It is possible to encounter an RLE encoded surface here and locking it is
      * necessary because this code is going to access the pixel buffer directly.
@@ -357,39 +559,16 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
     SDL_GetSurfaceAlphaMod(src, &alphaMod);
     SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
 
-    /* SDLgfx_rotateSurface only accepts 32-bit surfaces with a 8888 layout. Everything else has to be converted. */
-    if (src->format->BitsPerPixel != 32 || SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888 || !src->format->Amask) {
-        blitRequired = SDL_TRUE;
-    }
-
-    /* If scaling and cropping is necessary, it has to be taken care of before the rotation. */
-    if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
-        blitRequired = SDL_TRUE;
-    }
-
-    /* srcrect is not selecting the whole src surface, so cropping is needed */
-    if (!(srcrect->w == src->w && srcrect->h == src->h && srcrect->x == 0 && srcrect->y == 0)) {
-        blitRequired = SDL_TRUE;
-    }
-
-    /* The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes. */
-    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (alphaMod & rMod & gMod & bMod) != 255) {
-        applyModulation = SDL_TRUE;
+    if (applyModulation) {
         SDL_SetSurfaceAlphaMod(src_clone, alphaMod);
         SDL_SetSurfaceColorMod(src_clone, rMod, gMod, bMod);
     }
 
-    /* Opaque surfaces are much easier to handle with the NONE blend mode. */
-    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
-        isOpaque = SDL_TRUE;
-    }
-
     /* The NONE blend mode requires a mask for non-opaque surfaces. This mask will be used
      * to clear the pixels in the destination surface. The other steps are explained below.
      */
-    if (blendmode == SDL_BLENDMODE_NONE && !isOpaque) {
-        mask = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
-                                    0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+    if (needMask) {
+        mask = SW_GetScratchSurface(&data->scratch_mask, final_rect->w, final_rect->h);
         if (!mask) {
             retval = -1;
         } else {
@@ -401,118 +580,204 @@ static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Tex
      * or modulation is required. It's possible to use the source surface directly otherwise.
      */
     if (!retval && (blitRequired || applyModulation)) {
-        SDL_Rect scale_rect = tmp_rect;
-        src_scaled = SDL_CreateRGBSurface(0, final_rect->w, final_rect->h, 32,
-                                          0x00ff0000, 0x0000ff00, 0x000000ff, 0xff000000);
+        SDL_Rect scale_rect;
+        scale_rect.x = 0;
+        scale_rect.y = 0;
+        scale_rect.w = final_rect->w;
+        scale_rect.h = final_rect->h;
+        src_scaled = SW_GetScratchSurface(&data->scratch_scaled, final_rect->w, final_rect->h);
         if (!src_scaled) {
             retval = -1;
         } else {
             SDL_SetSurfaceBlendMode(src_clone, SDL_BLENDMODE_NONE);
             retval = SDL_PrivateUpperBlitScaled(src_clone, srcrect, src_scaled, &scale_rect, texture->scaleMode);
-            SDL_FreeSurface(src_clone);
-            src_clone = src_scaled;
-            src_scaled = NULL;
         }
     }
 
-    /* SDLgfx_rotateSurface is going to make decisions depending on the blend mode. */
-    SDL_SetSurfaceBlendMode(src_clone, blendmode);
-
     if (!retval) {
-        SDL_Rect rect_dest;
-        double cangle, sangle;
-
-        SDLgfx_rotozoomSurfaceSizeTrig(tmp_rect.w, tmp_rect.h, angle, center,
-                                       &rect_dest, &cangle, &sangle);
-        src_rotated = SDLgfx_rotateSurface(src_clone, angle,
-                                           (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
-                                           &rect_dest, cangle, sangle, center);
-        if (!src_rotated) {
+        SDL_Surface *input = src_scaled ? src_scaled : src_clone;
+
+        /* SDLgfx_rotateSurface is going to make decisions depending on the blend mode. */
+        SDL_SetSurfaceBlendMode(input, blendmode);
+
+        SDLgfx_rotozoomSurfaceSizeTrig(final_rect->w, final_rect->h, angle, center,
+                                       rect_dest, &cangle, &sangle);
+        *rotated = SDLgfx_rotateSurface(input, angle,
+                                        (texture->scaleMode == SDL_ScaleModeNearest) ? 0 : 1, flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL,
+                                        rect_dest, cangle, sangle, center);
+        if (!*rotated) {
             retval = -1;
         }
         if (!retval && mask) {
             /* The mask needed for the NONE blend mode gets rotated with the same parameters. */
-            mask_rotated = SDLgfx_rotateSurface(mask, angle,
-                                                SDL_FALSE, 0, 0,
-                                                &rect_dest, cangle, sangle, center);
-            if (!mask_rotated) {
+            *mask_rotated = SDLgfx_rotateSurface(mask, angle,
+                                                 SDL_FALSE, 0, 0,
+                                                 rect_dest, cangle, sangle, center);
+            if (!*mask_rotated) {
+                SDL_FreeSurface(*rotated);
+                *rotated = NULL;
                 retval = -1;
             }
         }
-        if (!retval) {
+    }
+
+    if (SDL_MUSTLOCK(src)) {
+        SDL_UnlockSurface(src);
+    }
+    SDL_FreeSurface(src_clone);
+    return retval;
+}
+
+static int SW_RenderCopyEx(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Texture *texture,
+                           const SDL_Rect *srcrect, const SDL_Rect *final_rect,
+                           const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip, float scale_x, float scale_y)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
+    SDL_Surface *src = (SDL_Surface *)texture->driverdata;
+    SDL_Rect tmp_rect, rect_dest;
+    SDL_Surface *src_rotated = NULL, *mask_rotated = NULL;
+    SW_RotatedSurface key;
+    SW_RotatedSurface *cached;
+    int retval = 0;
+    SDL_BlendMode blendmode;
+    Uint8 alphaMod, rMod, gMod, bMod;
+    int applyModulation = SDL_FALSE;
+    int blitRequired = SDL_FALSE;
+    int isOpaque = SDL_FALSE;
+
+    if (!surface) {
+        return -1;
+    }
+
+    SDL_GetSurfaceBlendMode(src, &blendmode);
+    SDL_GetSurfaceAlphaMod(src, &alphaMod);
+    SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
 
-            tmp_rect.x = final_rect->x + rect_dest.x;
-            tmp_rect.y = final_rect->y + rect_dest.y;
-            tmp_rect.w = rect_dest.w;
-            tmp_rect.h = rect_dest.h;
+    /* SDLgfx_rotateSurface only accepts 32-bit surfaces with a 8888 layout. Everything else has to be converted. */
+    if (src->format->BitsPerPixel != 32 || SDL_PIXELLAYOUT(src->format->format) != SDL_PACKEDLAYOUT_8888 || !src->format->Amask) {
+        blitRequired = SDL_TRUE;
+    }
+
+    /* If scaling and cropping is necessary, it has to be taken care of before the rotation. */
+    if (!(srcrect->w == final_rect->w && srcrect->h == final_rect->h && srcrect->x == 0 && srcrect->y == 0)) {
+        blitRequired = SDL_TRUE;
+    }
+
+    /* srcrect is not selecting the whole src surface, so cropping is needed */
+    if (!(srcrect->w == src->w && srcrect->h == src->h && srcrect->x == 0 && srcrect->y == 0)) {
+        blitRequired = SDL_TRUE;
+    }
+
+    /* The color and alpha modulation has to be applied before the rotation when using the NONE, MOD or MUL blend modes. */
+    if ((blendmode == SDL_BLENDMODE_NONE || blendmode == SDL_BLENDMODE_MOD || blendmode == SDL_BLENDMODE_MUL) && (alphaMod & rMod & gMod & bMod) != 255) {
+        applyModulation = SDL_TRUE;
+    }
+
+    /* Opaque surfaces are much easier to handle with the NONE blend mode. */
+    if (blendmode == SDL_BLENDMODE_NONE && !src->format->Amask && alphaMod == 255) {
+        isOpaque = SDL_TRUE;
+    }
 
-            /* The NONE blend mode needs some special care with non-opaque surfaces.
-             * Other blend modes or opaque surfaces can be blitted directly.
+    /* Everything that goes into the transformed surfaces */
+    SDL_zero(key);
+    key.texture = texture;
+    key.version = texture->version;
+    key.srcrect = *srcrect;
+    key.w = final_rect->w;
+    key.h = final_rect->h;
+    key.angle = angle;
+    key.center = *center;
+    key.flip = flip;
+    key.scale_mode = texture->scaleMode;
+    key.blend_mode = blendmode;
+    key.color.r = applyModulation ? rMod : 255;
+    key.color.g = applyModulation ? gMod : 255;
+    key.color.b = applyModulation ? bMod : 255;
+    key.color.a = applyModulation ? alphaMod : 255;
+
+    cached = SW_GetRotatedSurface(data, &key);
+    if (cached) {
+        ++renderer->stats.copy_ex_cache_hits;
+        src_rotated = cached->rotated;
+        mask_rotated = cached->mask;
+        rect_dest = cached->rect_dest;
+    } else {
+        ++renderer->stats.copy_ex_cache_misses;
+        retval = SW_RotateSurface(data, texture, srcrect, final_rect, angle, center, flip,
+                                  blitRequired, applyModulation, (blendmode == SDL_BLENDMODE_NONE && !isOpaque),
+                                  &src_rotated, &mask_rotated, &rect_dest);
+        if (!retval) {
+            cached = SW_CacheRotatedSurface(data, &key, src_rotated, mask_rotated, &rect_dest);
+        }
+    }
+
+    if (!retval) {
+        tmp_rect.x = final_rect->x + rect_dest.x;
+        tmp_rect.y = final_rect->y + rect_dest.y;
+        tmp_rect.w = rect_dest.w;
+        tmp_rect.h = rect_dest.h;
+
+        /* The NONE blend mode needs some special care with non-opaque surfaces.
+         * Other blend modes or opaque surfaces can be blitted directly.
+         */
+        if (blendmode != SDL_BLENDMODE_NONE || isOpaque) {
+            if (applyModulation == SDL_FALSE) {
+                /* If the modulation wasn't already applied, make it happen now. */
+                SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
+                SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
+            } else if (cached) {
+                /* A cached surface may still carry the modulation of an earlier copy */
+                SDL_SetSurfaceAlphaMod(src_rotated, 255);
+                SDL_SetSurfaceColorMod(src_rotated, 255, 255, 255);
+            }
+            /* Renderer scaling, if needed */
+            retval = Blit_to_Screen(src_rotated, NULL, surface, &tmp_rect, scale_x, scale_y, texture->scaleMode);
+        } else {
+            /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
+             * First, the area where the rotated pixels will be blitted to get set to zero.
+             * This is accomplished by simply blitting a mask with the NONE blend mode.
+             * The colorkey set by the rotate function will discard the correct pixels.
              */
-            if (blendmode != SDL_BLENDMODE_NONE || isOpaque) {
-                if (applyModulation == SDL_FALSE) {
-                    /* If the modulation wasn't already applied, make it happen now. */
-                    SDL_SetSurfaceAlphaMod(src_rotated, alphaMod);
-                    SDL_SetSurfaceColorMod(src_rotated, rMod, gMod, bMod);
-                }
-                /* Renderer scaling, if needed */
-                retval = Blit_to_Screen(src_rotated, NULL, surface, &tmp_rect, scale_x, scale_y, texture->scaleMode);
-            } else {
-                /* The NONE blend mode requires three steps to get the pixels onto the destination surface.
-                 * First, the area where the rotated pixels will be blitted to get set to zero.
-                 * This is accomplished by simply blitting a mask with the NONE blend mode.
-                 * The colorkey set by the rotate function will discard the correct pixels.
+            SDL_Rect mask_rect = tmp_rect;
+            SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
+            /* Renderer scaling, if needed */
+            retval = Blit_to_Screen(mask_rotated, NULL, surface, &mask_rect, scale_x, scale_y, texture->scaleMode);
+            if (!retval) {
+                /* The next step copies the alpha value. This is done with the BLEND blend mode and
+                 * by modulating the source colors with 0. Since the destination is all zeros, this
+                 * will effectively set the destination alpha to the source alpha.
                  */
-                SDL_Rect mask_rect = tmp_rect;
-                SDL_SetSurfaceBlendMode(mask_rotated, SDL_BLENDMODE_NONE);
+                SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
+                mask_rect = tmp_rect;
                 /* Renderer scaling, if needed */
-                retval = Blit_to_Screen(mask_rotated, NULL, surface, &mask_rect, scale_x, scale_y, texture->scaleMode);
+                retval = Blit_to_Screen(src_rotated, NULL, surface, &mask_rect, scale_x, scale_y, texture->scaleMode);
                 if (!retval) {
-                    /* The next step copies the alpha value. This is done with the BLEND blend mode and
-                     * by modulating the source colors with 0. Since the destination is all zeros, this
-                     * will effectively set the destination alpha to the source alpha.
+                    /* The last step gets the color values in place. The ADD blend mode simply adds them to
+                     * the destination (where the color values are all zero). However, because the ADD blend
+                     * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
+                     * to be created. This makes all source pixels opaque and the colors get copied correctly.
                      */
-                    SDL_SetSurfaceColorMod(src_rotated, 0, 0, 0);
-                    mask_rect = tmp_rect;
-                    /* Renderer scaling, if needed */
-                    retval = Blit_to_Screen(src_rotated, NULL, surface, &mask_rect, scale_x, scale_y, texture->scaleMode);
-                    if (!retval) {
-                        /* The last step gets the color values in place. The ADD blend mode simply adds them to
-                         * the destination (where the color values are all zero). However, because the ADD blend
-                         * mode modulates the colors with the alpha channel, a surface without an alpha mask needs
-                         * to be created. This makes all source pixels opaque and the colors get copied correctly.
-                         */
-                        SDL_Surface *src_rotated_rgb;
-                        src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
-                                                                   src_rotated->format->BitsPerPixel, src_rotated->pitch,
-                                                                   src_rotated->format->Rmask, src_rotated->format->Gmask,
-                                                                   src_rotated->format->Bmask, 0);
-                        if (!src_rotated_rgb) {
-                            retval = -1;
-                        } else {
-                            SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
-                            /* Renderer scaling, if needed */
-                            retval = Blit_to_Screen(src_rotated_rgb, NULL, surface, &tmp_rect, scale_x, scale_y, texture->scaleMode);
-                            SDL_FreeSurface(src_rotated_rgb);
-                        }
+                    SDL_Surface *src_rotated_rgb;
+                    src_rotated_rgb = SDL_CreateRGBSurfaceFrom(src_rotated->pixels, src_rotated->w, src_rotated->h,
+                                                               src_rotated->format->BitsPerPixel, src_rotated->pitch,
+                                                               src_rotated->format->Rmask, src_rotated->format->Gmask,
+                                                               src_rotated->format->Bmask, 0);
+                    if (!src_rotated_rgb) {
+                        retval = -1;
+                    } else {
+                        SDL_SetSurfaceBlendMode(src_rotated_rgb, SDL_BLENDMODE_ADD);
+                        /* Renderer scaling, if needed */
+                        retval = Blit_to_Screen(src_rotated_rgb, NULL, surface, &tmp_rect, scale_x, scale_y, texture->scaleMode);
+                        SDL_FreeSurface(src_rotated_rgb);
                     }
                 }
-                SDL_FreeSurface(mask_rotated);
-            }
-            if (src_rotated) {
-                SDL_FreeSurface(src_rotated);
             }
         }
     }
 
-    if (SDL_MUSTLOCK(src)) {
-        SDL_UnlockSurface(src);
-    }
-    if (mask) {
-        SDL_FreeSurface(mask);
-    }
-    if (src_clone) {
-        SDL_FreeSurface(src_clone);
+    if (!cached) {
+        SDL_FreeSurface(mask_rotated);
+        SDL_FreeSurface(src_rotated);
     }
     return retval;
 }
@@ -613,6 +878,14 @@ static int SW_QueueGeometry(SDL_Renderer *renderer, SDL_RenderCommand *cmd, SDL_
     return 0;
 }
 
+static void SetCopyState(SDL_Surface *surface, const SDL_RenderCommand *cmd)
+{
+    /* !!! FIXME: we can probably avoid some of these calls. */
+    SDL_SetSurfaceColorMod(surface, cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b);
+    SDL_SetSurfaceAlphaMod(surface, cmd->data.draw.a);
+    SDL_SetSurfaceBlendMode(surface, cmd->data.draw.blend);
+}
+
 static void PrepTextureForCopy(const SDL_RenderCommand *cmd)
 {
     const Uint8 r = cmd->data.draw.r;
@@ -624,16 +897,127 @@ static void PrepTextureForCopy(const SDL_RenderCommand *cmd)
     SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
     const SDL_bool colormod = ((r & g & b) != 0xFF);
     const SDL_bool alphamod = (a != 0xFF);
-    const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL));
+    const SDL_bool blending = ((blend == SDL_BLENDMODE_ADD) || (blend == SDL_BLENDMODE_MOD) || (blend == SDL_BLENDMODE_MUL) ||
+                               (blend == SDL_BLENDMODE_BLEND_PREMULTIPLIED));
 
     if (colormod || alphamod || blending) {
         SDL_SetSurfaceRLE(surface, 0);
     }
 
-    /* !!! FIXME: we can probably avoid some of these calls. */
-    SDL_SetSurfaceColorMod(surface, r, g, b);
-    SDL_SetSurfaceAlphaMod(surface, a);
-    SDL_SetSurfaceBlendMode(surface, blend);
+    SetCopyState(surface, cmd);
+}
+
+/* Brings the RGB copy of a YUV texture up to date, for draws that don't read the planes */
+static void SW_ConvertYUVTexture(SDL_Texture *texture)
+{
+#if SDL_HAVE_YUV
+    SDL_SW_YUVTexture *swdata = texture->yuv;
+
+    if (swdata && swdata->rgb_version != texture->version) {
+        SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
+        SDL_Rect rect;
+
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = texture->w;
+        rect.h = texture->h;
+        if (SDL_SW_CopyYUVToRGB(swdata, &rect, surface->format->format, rect.w, rect.h,
+                                surface->pixels, surface->pitch) == 0) {
+            swdata->rgb_version = texture->version;
+        }
+    }
+#endif
+}
+
+/* Converts just the pixels a copy of a YUV texture shows, straight onto the target, instead of
+ * converting the whole texture and then stretching it. That works for opaque copies that don't
+ * magnify the texture and aren't clipped, the others go through the RGB copy.
+ */
+static SDL_bool SW_RenderCopyYUV(SDL_Surface *surface, const SDL_RenderCommand *cmd, const SDL_Rect *srcrect, const SDL_Rect *dstrect)
+{
+#if SDL_HAVE_YUV
+    SDL_Texture *texture = cmd->data.draw.texture;
+    SDL_SW_YUVTexture *swdata = texture->yuv;
+    SDL_Rect clipped;
+    Uint8 *pixels;
+
+    if (!swdata || cmd->data.draw.blend != SDL_BLENDMODE_NONE ||
+        (cmd->data.draw.r & cmd->data.draw.g & cmd->data.draw.b & cmd->data.draw.a) != 0xFF ||
+        texture->scaleMode != SDL_ScaleModeNearest || SDL_MUSTLOCK(surface) || !surface->pixels) {
+        return SDL_FALSE;
+    }
+    if ((Sint64)dstrect->w * dstrect->h > (Sint64)srcrect->w * srcrect->h) {
+        /* Magnifying converts fewer pixels through the RGB copy */
+        return SDL_FALSE;
+    }
+    if (!SDL_IntersectRect(dstrect, &surface->clip_rect, &clipped) || !SDL_RectEquals(&clipped, dstrect)) {
+        return SDL_FALSE;
+    }
+
+    pixels = (Uint8 *)surface->pixels + (size_t)dstrect->y * surface->pitch + (size_t)dstrect->x * surface->format->BytesPerPixel;
+    return SDL_StretchPixels_YUV_to_RGB(swdata->w, swdata->h, swdata->format, swdata->planes[0], swdata->pitches[0],
+                                        srcrect, dstrect->w, dstrect->h, surface->format->format, pixels, surface->pitch);
+#else
+    return SDL_FALSE;
+#endif
+}
+
+static void SW_RenderCopy(SDL_Surface *surface, SDL_Surface *src, SDL_ScaleMode scaleMode, const SDL_Rect *srcrect, SDL_Rect *dstrect)
+{
+
+    if (srcrect->w == dstrect->w && srcrect->h == dstrect->h) {
+        SDL_BlitSurface(src, srcrect, surface, dstrect);
+    } else {
+        /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
+         * to avoid potentially frequent RLE encoding/decoding.
+         */
+        SDL_SetSurfaceRLE(surface, 0);
+
+        /* Prevent to do scaling + clipping on viewport boundaries as it may lose proportion */
+        if ((dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) &&
+            scaleMode != SDL_ScaleModeNearest && src->format->BytesPerPixel == 4 && src->format->format != SDL_PIXELFORMAT_ARGB2101010 &&
+            dstrect->w <= SDL_MAX_UINT16 && dstrect->h <= SDL_MAX_UINT16) {
+            /* Filtered scaling can draw the visible part of the whole scaled image directly */
+            SDL_PrivateBlitScaledLinearRows(src, srcrect, surface, dstrect, NULL);
+        } else if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
+            SDL_Surface *tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, src->format->format);
+            /* Scale to an intermediate surface, then blit */
+            if (tmp) {
+                SDL_Rect r;
+                SDL_BlendMode blendmode;
+                Uint8 alphaMod, rMod, gMod, bMod;
+
+                SDL_GetSurfaceBlendMode(src, &blendmode);
+                SDL_GetSurfaceAlphaMod(src, &alphaMod);
+                SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
+
+                r.x = 0;
+                r.y = 0;
+                r.w = dstrect->w;
+                r.h = dstrect->h;
+
+                SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+                SDL_SetSurfaceColorMod(src, 255, 255, 255);
+                SDL_SetSurfaceAlphaMod(src, 255);
+
+                SDL_PrivateUpperBlitScaled(src, srcrect, tmp, &r, scaleMode);
+
+                SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
+                SDL_SetSurfaceAlphaMod(tmp, alphaMod);
+                SDL_SetSurfaceBlendMode(tmp, blendmode);
+
+                SDL_BlitSurface(tmp, NULL, surface, dstrect);
+                SDL_FreeSurface(tmp);
+
+                /* Put the modulation back, there may be more copies of 'src' in this command */
+                SDL_SetSurfaceColorMod(src, rMod, gMod, bMod);
+                SDL_SetSurfaceAlphaMod(src, alphaMod);
+                SDL_SetSurfaceBlendMode(src, blendmode);
+            }
+        } else {
+            SDL_PrivateUpperBlitScaled(src, srcrect, surface, dstrect, scaleMode);
+        }
+    }
 }
 
 static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
@@ -658,266 +1042,839 @@ static void SetDrawState(SDL_Surface *surface, SW_DrawStateCache *drawstate)
     }
 }
 
-static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+/* Move the vertices of a draw command into the viewport */
+static void ApplyViewport(const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *viewport)
 {
-    SDL_Surface *surface = SW_ActivateRenderer(renderer);
-    SW_DrawStateCache drawstate;
+    void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+    const int count = (int)cmd->data.draw.count;
+    int i;
 
-    if (!surface) {
-        return -1;
+    if (!viewport || (!viewport->x && !viewport->y)) {
+        return;
     }
 
-    drawstate.viewport = NULL;
-    drawstate.cliprect = NULL;
-    drawstate.surface_cliprect_dirty = SDL_TRUE;
-
-    while (cmd) {
-        switch (cmd->command) {
-            case SDL_RENDERCMD_SETDRAWCOLOR: {
-                break;  /* Not used in this backend. */
-            }
-
-            case SDL_RENDERCMD_SETVIEWPORT: {
-                drawstate.viewport = &cmd->data.viewport.rect;
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            SDL_Point *points = (SDL_Point *)verts;
+            for (i = 0; i < count; i++) {
+                points[i].x += viewport->x;
+                points[i].y += viewport->y;
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_SETCLIPRECT: {
-                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+        case SDL_RENDERCMD_FILL_RECTS: {
+            SDL_Rect *rects = (SDL_Rect *)verts;
+            for (i = 0; i < count; i++) {
+                rects[i].x += viewport->x;
+                rects[i].y += viewport->y;
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_CLEAR: {
-                const Uint8 r = cmd->data.color.r;
-                const Uint8 g = cmd->data.color.g;
-                const Uint8 b = cmd->data.color.b;
-                const Uint8 a = cmd->data.color.a;
-                /* By definition the clear ignores the clip rect */
-                SDL_SetClipRect(surface, NULL);
-                SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, r, g, b, a));
-                drawstate.surface_cliprect_dirty = SDL_TRUE;
-                break;
+        case SDL_RENDERCMD_COPY: {
+            /* Source and destination rects are interleaved */
+            SDL_Rect *rects = (SDL_Rect *)verts;
+            for (i = 0; i < count; i++, rects += 2) {
+                rects[1].x += viewport->x;
+                rects[1].y += viewport->y;
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_DRAW_POINTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+        case SDL_RENDERCMD_COPY_EX: {
+            CopyExData *copydata = (CopyExData *)verts;
+            copydata->dstrect.x += viewport->x;
+            copydata->dstrect.y += viewport->y;
+            break;
+        }
 
-                /* Apply viewport */
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    int i;
-                    for (i = 0; i < count; i++) {
-                        verts[i].x += drawstate.viewport->x;
-                        verts[i].y += drawstate.viewport->y;
-                    }
+        case SDL_RENDERCMD_GEOMETRY: {
+            SDL_Point vp;
+            vp.x = viewport->x;
+            vp.y = viewport->y;
+            trianglepoint_2_fixedpoint(&vp);
+            if (cmd->data.draw.texture) {
+                GeometryCopyData *ptr = (GeometryCopyData *)verts;
+                for (i = 0; i < count; i++) {
+                    ptr[i].dst.x += vp.x;
+                    ptr[i].dst.y += vp.y;
                 }
-
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawPoints(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendPoints(surface, verts, count, blend, r, g, b, a);
+            } else {
+                GeometryFillData *ptr = (GeometryFillData *)verts;
+                for (i = 0; i < count; i++) {
+                    ptr[i].dst.x += vp.x;
+                    ptr[i].dst.y += vp.y;
                 }
-                break;
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_DRAW_LINES: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                SDL_Point *verts = (SDL_Point *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+        default:
+            break;
+    }
+}
 
-                /* Apply viewport */
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    int i;
-                    for (i = 0; i < count; i++) {
-                        verts[i].x += drawstate.viewport->x;
-                        verts[i].y += drawstate.viewport->y;
-                    }
-                }
+/* Dirty rectangle tracking
+ *
+ * Draws to the window surface record the area they can touch, so that
+ * SW_RenderPresent() only sends the changed parts of the window. Nearby
+ * areas are merged, and the result is a conservative cover of the changes:
+ * a pixel may be presented without having changed, but never the opposite.
+ */
 
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_DrawLines(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendLines(surface, verts, count, blend, r, g, b, a);
-                }
-                break;
-            }
+/* Returns the part of the clip rect that a draw command with its vertices in the viewport can touch */
+static SDL_bool GetDrawBounds(const SDL_RenderCommand *cmd, void *vertices, const SDL_Rect *cliprect, SDL_Rect *bounds)
+{
+    void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+    const int count = (int)cmd->data.draw.count;
+    int min_x = SDL_MAX_SINT32, min_y = SDL_MAX_SINT32;
+    int max_x = SDL_MIN_SINT32, max_y = SDL_MIN_SINT32;
+    int i;
 
-            case SDL_RENDERCMD_FILL_RECTS: {
-                const Uint8 r = cmd->data.draw.r;
-                const Uint8 g = cmd->data.draw.g;
-                const Uint8 b = cmd->data.draw.b;
-                const Uint8 a = cmd->data.draw.a;
-                const int count = (int) cmd->data.draw.count;
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_BlendMode blend = cmd->data.draw.blend;
-                SetDrawState(surface, &drawstate);
+#define SW_EXTEND_BOUNDS(x0, y0, x1, y1) \
+    min_x = SDL_min(min_x, x0);          \
+    min_y = SDL_min(min_y, y0);          \
+    max_x = SDL_max(max_x, x1);          \
+    max_y = SDL_max(max_y, y1)
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_DRAW_LINES: {
+            const SDL_Point *points = (const SDL_Point *)verts;
+            for (i = 0; i < count; i++) {
+                SW_EXTEND_BOUNDS(points[i].x, points[i].y, points[i].x, points[i].y);
+            }
+            break;
+        }
 
-                /* Apply viewport */
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    int i;
-                    for (i = 0; i < count; i++) {
-                        verts[i].x += drawstate.viewport->x;
-                        verts[i].y += drawstate.viewport->y;
-                    }
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const SDL_Rect *rects = (const SDL_Rect *)verts;
+            for (i = 0; i < count; i++) {
+                if (!SDL_RectEmpty(&rects[i])) {
+                    SW_EXTEND_BOUNDS(rects[i].x, rects[i].y, rects[i].x + rects[i].w - 1, rects[i].y + rects[i].h - 1);
                 }
+            }
+            break;
+        }
 
-                if (blend == SDL_BLENDMODE_NONE) {
-                    SDL_FillRects(surface, verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
-                } else {
-                    SDL_BlendFillRects(surface, verts, count, blend, r, g, b, a);
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *rects = (const SDL_Rect *)verts;
+            for (i = 0; i < count; i++, rects += 2) {
+                if (!SDL_RectEmpty(&rects[1])) {
+                    SW_EXTEND_BOUNDS(rects[1].x, rects[1].y, rects[1].x + rects[1].w - 1, rects[1].y + rects[1].h - 1);
                 }
-                break;
             }
+            break;
+        }
 
-            case SDL_RENDERCMD_COPY: {
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const SDL_Rect *srcrect = verts;
-                SDL_Rect *dstrect = verts + 1;
-                SDL_Texture *texture = cmd->data.draw.texture;
-                SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+        case SDL_RENDERCMD_GEOMETRY: {
+            /* Pixels are drawn if their center is inside, the vertices are in fixed point */
+            if (cmd->data.draw.texture) {
+                const GeometryCopyData *ptr = (const GeometryCopyData *)verts;
+                for (i = 0; i < count; i++) {
+                    SW_EXTEND_BOUNDS(ptr[i].dst.x >> FP_BITS, ptr[i].dst.y >> FP_BITS, ptr[i].dst.x >> FP_BITS, ptr[i].dst.y >> FP_BITS);
+                }
+            } else {
+                const GeometryFillData *ptr = (const GeometryFillData *)verts;
+                for (i = 0; i < count; i++) {
+                    SW_EXTEND_BOUNDS(ptr[i].dst.x >> FP_BITS, ptr[i].dst.y >> FP_BITS, ptr[i].dst.x >> FP_BITS, ptr[i].dst.y >> FP_BITS);
+                }
+            }
+            break;
+        }
 
-                SetDrawState(surface, &drawstate);
+        default:
+            /* Rotated copies can land anywhere in the clip rect */
+            *bounds = *cliprect;
+            return !SDL_RectEmpty(bounds);
+    }
+#undef SW_EXTEND_BOUNDS
+
+    /* Clip first, so the size can't overflow */
+    min_x = SDL_max(min_x, cliprect->x);
+    min_y = SDL_max(min_y, cliprect->y);
+    max_x = SDL_min(max_x, cliprect->x + cliprect->w - 1);
+    max_y = SDL_min(max_y, cliprect->y + cliprect->h - 1);
+    if (min_x > max_x || min_y > max_y) {
+        return SDL_FALSE;
+    }
+    bounds->x = min_x;
+    bounds->y = min_y;
+    bounds->w = max_x - min_x + 1;
+    bounds->h = max_y - min_y + 1;
+    return SDL_TRUE;
+}
+
+static void SW_AddDirtyRect(SW_RenderData *data, const SDL_Rect *rect)
+{
+    Sint64 best_growth = -1;
+    int i, best = 0;
+
+    for (i = 0; i < data->num_dirty_rects; ++i) {
+        if (SDL_HasIntersection(&data->dirty_rects[i], rect)) {
+            SDL_UnionRect(&data->dirty_rects[i], rect, &data->dirty_rects[i]);
+            return;
+        }
+    }
+    if (data->num_dirty_rects < SW_MAX_DIRTY_RECTS) {
+        data->dirty_rects[data->num_dirty_rects++] = *rect;
+        return;
+    }
+
+    /* Out of rects, grow the one that gets the least bigger */
+    for (i = 0; i < data->num_dirty_rects; ++i) {
+        const SDL_Rect *dirty = &data->dirty_rects[i];
+        SDL_Rect merged;
+        Sint64 growth;
+
+        SDL_UnionRect(dirty, rect, &merged);
+        growth = (Sint64)merged.w * merged.h - (Sint64)dirty->w * dirty->h;
+        if (best_growth < 0 || growth < best_growth) {
+            best_growth = growth;
+            best = i;
+        }
+    }
+    SDL_UnionRect(&data->dirty_rects[best], rect, &data->dirty_rects[best]);
+}
+
+/* Records the area a command is about to draw on, after the viewport and clip rect are applied */
+static void SW_TrackDraw(SW_RenderData *data, SDL_Surface *surface, const SDL_RenderCommand *cmd, void *vertices)
+{
+    SDL_Rect bounds;
+
+    if (surface != data->window || data->dirty_full) {
+        return;
+    }
+    if (cmd->command == SDL_RENDERCMD_CLEAR) {
+        data->dirty_full = SDL_TRUE;
+    } else if (GetDrawBounds(cmd, vertices, &surface->clip_rect, &bounds)) {
+        SW_AddDirtyRect(data, &bounds);
+    }
+}
+
+/* Draw a command whose vertices are already in the viewport, clipped to the surface clip rect.
+ * 'src' is the texture surface with the modulation and blend mode of the command applied.
+ * The vertices aren't modified, so a command can be drawn more than once.
+ */
+static void SW_DrawCommand(SDL_Renderer *renderer, SDL_Surface *surface, SDL_Surface *src, const SDL_RenderCommand *cmd, void *vertices)
+{
+    void *verts = ((Uint8 *)vertices) + cmd->data.draw.first;
+    const int count = (int)cmd->data.draw.count;
+    const Uint8 r = cmd->data.draw.r;
+    const Uint8 g = cmd->data.draw.g;
+    const Uint8 b = cmd->data.draw.b;
+    const Uint8 a = cmd->data.draw.a;
+    const SDL_BlendMode blend = cmd->data.draw.blend;
+    int i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR: {
+            /* Fills the whole clip rect, the caller decides what that covers */
+            SDL_FillRect(surface, NULL, SDL_MapRGBA(surface->format, cmd->data.color.r, cmd->data.color.g, cmd->data.color.b, cmd->data.color.a));
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawPoints(surface, (const SDL_Point *)verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendPoints(surface, (const SDL_Point *)verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_LINES: {
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_DrawLines(surface, (const SDL_Point *)verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendLines(surface, (const SDL_Point *)verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
 
-                PrepTextureForCopy(cmd);
+        case SDL_RENDERCMD_FILL_RECTS: {
+            if (blend == SDL_BLENDMODE_NONE) {
+                SDL_FillRects(surface, (const SDL_Rect *)verts, count, SDL_MapRGBA(surface->format, r, g, b, a));
+            } else {
+                SDL_BlendFillRects(surface, (const SDL_Rect *)verts, count, blend, r, g, b, a);
+            }
+            break;
+        }
 
-                /* Apply viewport */
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    dstrect->x += drawstate.viewport->x;
-                    dstrect->y += drawstate.viewport->y;
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *rects = (const SDL_Rect *)verts;
+
+            /* Several copies of the same texture may have been combined into one command */
+            for (i = 0; i < count; i++, rects += 2) {
+                /* The blit clips the destination rect, work on a copy */
+                SDL_Rect dstrect = rects[1];
+
+                if (!SDL_HasIntersection(&dstrect, &surface->clip_rect)) {
+                    continue;
+                }
+                if (SW_RenderCopyYUV(surface, cmd, &rects[0], &dstrect)) {
+                    continue;
                 }
+                SW_ConvertYUVTexture(cmd->data.draw.texture);
+                SW_RenderCopy(surface, src, cmd->data.draw.texture->scaleMode, &rects[0], &dstrect);
+            }
+            break;
+        }
 
-                if ( srcrect->w == dstrect->w && srcrect->h == dstrect->h ) {
-                    SDL_BlitSurface(src, srcrect, surface, dstrect);
-                } else {
-                    /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
-                     * to avoid potentially frequent RLE encoding/decoding.
-                     */
-                    SDL_SetSurfaceRLE(surface, 0);
-
-                    /* Prevent to do scaling + clipping on viewport boundaries as it may lose proportion */
-                    if (dstrect->x < 0 || dstrect->y < 0 || dstrect->x + dstrect->w > surface->w || dstrect->y + dstrect->h > surface->h) {
-                        SDL_Surface *tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h, 0, src->format->format);
-                        /* Scale to an intermediate surface, then blit */
-                        if (tmp) {
-                            SDL_Rect r;
-                            SDL_BlendMode blendmode;
-                            Uint8 alphaMod, rMod, gMod, bMod;
-
-                            SDL_GetSurfaceBlendMode(src, &blendmode);
-                            SDL_GetSurfaceAlphaMod(src, &alphaMod);
-                            SDL_GetSurfaceColorMod(src, &rMod, &gMod, &bMod);
-
-                            r.x = 0;
-                            r.y = 0;
-                            r.w = dstrect->w;
-                            r.h = dstrect->h;
-
-                            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
-                            SDL_SetSurfaceColorMod(src, 255, 255, 255);
-                            SDL_SetSurfaceAlphaMod(src, 255);
-
-                            SDL_PrivateUpperBlitScaled(src, srcrect, tmp, &r, texture->scaleMode);
-
-                            SDL_SetSurfaceColorMod(tmp, rMod, gMod, bMod);
-                            SDL_SetSurfaceAlphaMod(tmp, alphaMod);
-                            SDL_SetSurfaceBlendMode(tmp, blendmode);
-
-                            SDL_BlitSurface(tmp, NULL, surface, dstrect);
-                            SDL_FreeSurface(tmp);
-                            /* No need to set back r/g/b/a/blendmode to 'src' since it's done in PrepTextureForCopy() */
-                        }
-                    } else{
-                        SDL_PrivateUpperBlitScaled(src, srcrect, surface, dstrect, texture->scaleMode);
+        case SDL_RENDERCMD_COPY_EX: {
+            const CopyExData *copydata = (const CopyExData *)verts;
+            SW_ConvertYUVTexture(cmd->data.draw.texture);
+            SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
+                            &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
+                            copydata->scale_x, copydata->scale_y);
+            break;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY: {
+            if (src) {
+                const GeometryCopyData *ptr = (const GeometryCopyData *)verts;
+
+                /* Tiles convert their YUV textures before they start */
+                SW_ConvertYUVTexture(cmd->data.draw.texture);
+                for (i = 0; i < count; i += 3, ptr += 3) {
+                    /* SDL_SW_BlitTriangle() adjusts the points it's given */
+                    SDL_Point s0 = ptr[0].src, s1 = ptr[1].src, s2 = ptr[2].src;
+                    SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+
+                    SDL_SW_BlitTriangle(
+                            src,
+                            &s0, &s1, &s2,
+                            surface,
+                            &d0, &d1, &d2,
+                            ptr[0].color, ptr[1].color, ptr[2].color);
+                }
+            } else {
+                const GeometryFillData *ptr = (const GeometryFillData *)verts;
+
+                for (i = 0; i < count; i += 3, ptr += 3) {
+                    SDL_Point d0 = ptr[0].dst, d1 = ptr[1].dst, d2 = ptr[2].dst;
+
+                    SDL_SW_FillTriangle(surface, &d0, &d1, &d2, blend, ptr[0].color, ptr[1].color, ptr[2].color);
+                }
+            }
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+/* Tile-parallel command execution
+ *
+ * The target is split into bands of rows. Every draw, and every single copy
+ * of a copy command, is binned into the bands it touches in queue order, and
+ * each band replays its bin with its own clip rect, so each pixel is still
+ * painted in the same order as on the serial path. Draws that would rasterize
+ * differently when clipped (lines, scaled and rotated copies) run serially
+ * on the whole target, between the parallel runs of draws around them.
+ */
+
+#define SW_TILES_PER_THREAD 4
+#define SW_TILE_MIN_ROWS    16
+
+typedef struct SW_TiledDraw
+{
+    const SDL_RenderCommand *cmd;
+    SDL_Rect cliprect;  /* the clip rect of the draw on the whole target */
+    SDL_bool tileable;  /* whether clipping the draw to a tile gives the same pixels */
+    int texture_index;  /* index into the tile textures, -1 if the draw doesn't use one */
+} SW_TiledDraw;
+
+typedef struct SW_TileItem
+{
+    int draw; /* index into the draws of the job */
+    int copy; /* a single copy of a copy command, or -1 for the whole draw */
+} SW_TileItem;
+
+typedef struct
+{
+    SDL_Renderer *renderer;
+    SDL_Surface *surface;
+    void *vertices;
+    const SW_TiledDraw *draws;
+    int num_draws;
+    SDL_Surface **textures;
+    int num_textures;
+    SDL_Surface **tile_surfaces; /* per tile, its target followed by the num_textures textures it uses */
+    const SW_TileItem *items;
+    const int *item_ends; /* the items of tile N end at item_ends[N] */
+    int num_tiles;
+    int tile_rows;
+} SW_TileJob;
+
+/* Tiles draw through their own surface headers over the same pixels, so they
+ * can have their own clip rect, blit map and modulation without locking.
+ */
+static SDL_bool SW_CanShareSurface(SDL_Surface *surface)
+{
+    return surface->pixels && !SDL_MUSTLOCK(surface) && !surface->format->palette &&
+           surface->format->format != SDL_PIXELFORMAT_UNKNOWN;
+}
+
+static SDL_Surface *SW_CreateTileSurface(SDL_Surface *surface)
+{
+    return SDL_CreateRGBSurfaceWithFormatFrom(surface->pixels, surface->w, surface->h,
+                                              surface->format->BitsPerPixel, surface->pitch,
+                                              surface->format->format);
+}
+
+static SDL_bool SW_IsTileable(const SDL_RenderCommand *cmd, void *vertices)
+{
+    int i;
+
+    switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+        case SDL_RENDERCMD_DRAW_POINTS:
+        case SDL_RENDERCMD_FILL_RECTS:
+            return SDL_TRUE;
+
+        case SDL_RENDERCMD_COPY: {
+            const SDL_Rect *rects = (const SDL_Rect *)(((Uint8 *)vertices) + cmd->data.draw.first);
+
+            if (!SW_CanShareSurface((SDL_Surface *)cmd->data.draw.texture->driverdata)) {
+                return SDL_FALSE;
+            }
+            /* Scaled blits pick their source pixels based on the clipped rect */
+            for (i = 0; i < (int)cmd->data.draw.count; i++, rects += 2) {
+                if (rects[0].w != rects[1].w || rects[0].h != rects[1].h) {
+                    return SDL_FALSE;
+                }
+            }
+            return SDL_TRUE;
+        }
+
+        case SDL_RENDERCMD_GEOMETRY:
+            /* Triangles are rasterized per pixel, so they clip exactly */
+            return !cmd->data.draw.texture || SW_CanShareSurface((SDL_Surface *)cmd->data.draw.texture->driverdata);
+
+        default:
+            /* Clipping moves line end points, and rotated copies go through intermediate surfaces */
+            return SDL_FALSE;
+    }
+}
+
+static SDL_bool SW_ReserveTiledDraws(SW_RenderData *data, int count)
+{
+    if (count > data->tiled_draws_allocation) {
+        SW_TiledDraw *draws = (SW_TiledDraw *)SDL_realloc(data->tiled_draws, count * sizeof(*draws));
+        SDL_Surface **textures;
+
+        if (!draws) {
+            return SDL_FALSE;
+        }
+        data->tiled_draws = draws;
+
+        textures = (SDL_Surface **)SDL_realloc(data->tiled_textures, count * sizeof(*textures));
+        if (!textures) {
+            return SDL_FALSE;
+        }
+        data->tiled_textures = textures;
+        data->tiled_draws_allocation = count;
+    }
+    return SDL_TRUE;
+}
+
+/* Returns the bands of rows that a rect touches inside a clip rect */
+static SDL_bool GetTileRange(const SDL_Rect *rect, const SDL_Rect *cliprect, int tile_rows, int *first, int *last)
+{
+    SDL_Rect clipped;
+
+    if (!SDL_IntersectRect(rect, cliprect, &clipped)) {
+        return SDL_FALSE;
+    }
+    *first = clipped.y / tile_rows;
+    *last = (clipped.y + clipped.h - 1) / tile_rows;
+    return SDL_TRUE;
+}
+
+/* Calls the callback for every item of the job and every band it touches, in queue order */
+static void SW_VisitTileItems(SW_TileJob *job, void (*callback)(SW_TileJob *job, SW_RenderData *data, int tile, int draw, int copy), SW_RenderData *data)
+{
+    int i, j, tile, first, last;
+
+    for (i = 0; i < job->num_draws; ++i) {
+        const SW_TiledDraw *draw = &job->draws[i];
+
+        if (draw->cmd->command == SDL_RENDERCMD_COPY) {
+            const SDL_Rect *rects = (const SDL_Rect *)(((Uint8 *)job->vertices) + draw->cmd->data.draw.first);
+
+            for (j = 0; j < (int)draw->cmd->data.draw.count; j++, rects += 2) {
+                if (GetTileRange(&rects[1], &draw->cliprect, job->tile_rows, &first, &last)) {
+                    for (tile = first; tile <= last; ++tile) {
+                        callback(job, data, tile, i, j);
                     }
                 }
-                break;
             }
+        } else if (GetTileRange(&draw->cliprect, &draw->cliprect, job->tile_rows, &first, &last)) {
+            for (tile = first; tile <= last; ++tile) {
+                callback(job, data, tile, i, -1);
+            }
+        }
+    }
+}
 
-            case SDL_RENDERCMD_COPY_EX: {
-                CopyExData *copydata = (CopyExData *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                SetDrawState(surface, &drawstate);
-                PrepTextureForCopy(cmd);
+static void SW_CountTileItem(SW_TileJob *job, SW_RenderData *data, int tile, int draw, int copy)
+{
+    ++data->tile_item_ends[tile];
+}
+
+static void SW_AddTileItem(SW_TileJob *job, SW_RenderData *data, int tile, int draw, int copy)
+{
+    SW_TileItem *item = &data->tile_items[data->tile_item_ends[tile]++];
+
+    item->draw = draw;
+    item->copy = copy;
+}
+
+static SDL_bool SW_BinTileItems(SW_RenderData *data, SW_TileJob *job)
+{
+    int tile, total;
+
+    if (job->num_tiles > data->tile_item_ends_allocation) {
+        int *ends = (int *)SDL_realloc(data->tile_item_ends, job->num_tiles * sizeof(*ends));
+        if (!ends) {
+            return SDL_FALSE;
+        }
+        data->tile_item_ends = ends;
+        data->tile_item_ends_allocation = job->num_tiles;
+    }
+
+    /* Count the items of each tile, then turn the counts into where each tile starts */
+    SDL_memset(data->tile_item_ends, 0, job->num_tiles * sizeof(*data->tile_item_ends));
+    SW_VisitTileItems(job, SW_CountTileItem, data);
+    for (tile = 0, total = 0; tile < job->num_tiles; ++tile) {
+        const int count = data->tile_item_ends[tile];
+        data->tile_item_ends[tile] = total;
+        total += count;
+    }
+
+    if (total > data->tile_items_allocation) {
+        SW_TileItem *items = (SW_TileItem *)SDL_realloc(data->tile_items, total * sizeof(*items));
+        if (!items) {
+            return SDL_FALSE;
+        }
+        data->tile_items = items;
+        data->tile_items_allocation = total;
+    }
+
+    /* Filling in the items moves each start to where the tile ends */
+    SW_VisitTileItems(job, SW_AddTileItem, data);
+
+    job->items = data->tile_items;
+    job->item_ends = data->tile_item_ends;
+    return SDL_TRUE;
+}
+
+/* Creates the surface headers of every tile and of the textures it uses before the tiles run,
+ * so a failed allocation can fall back to drawing serially instead of dropping draws.
+ */
+static SDL_bool SW_CreateTileSurfaces(SW_TileJob *job)
+{
+    int tile, i;
+
+    for (tile = 0; tile < job->num_tiles; ++tile) {
+        SDL_Surface **surfaces = job->tile_surfaces + tile * (job->num_textures + 1);
+
+        surfaces[0] = SW_CreateTileSurface(job->surface);
+        if (!surfaces[0]) {
+            return SDL_FALSE;
+        }
+        for (i = (tile > 0) ? job->item_ends[tile - 1] : 0; i < job->item_ends[tile]; ++i) {
+            const int texture_index = job->draws[job->items[i].draw].texture_index;
+
+            if (texture_index >= 0 && !surfaces[1 + texture_index]) {
+                surfaces[1 + texture_index] = SW_CreateTileSurface(job->textures[texture_index]);
+                if (!surfaces[1 + texture_index]) {
+                    return SDL_FALSE;
+                }
+            }
+        }
+    }
+    return SDL_TRUE;
+}
 
-                /* Apply viewport */
-                if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                    copydata->dstrect.x += drawstate.viewport->x;
-                    copydata->dstrect.y += drawstate.viewport->y;
+static void SW_RenderTiles(void *userdata, int start, int end)
+{
+    SW_TileJob *job = (SW_TileJob *)userdata;
+    int tile, i;
+
+    for (tile = start; tile < end; ++tile) {
+        SDL_Surface **surfaces = job->tile_surfaces + tile * (job->num_textures + 1);
+        SDL_Surface *surface = surfaces[0];
+        const SW_TiledDraw *draw = NULL;
+        SDL_Surface *src = NULL;
+        SDL_Rect rect;
+
+        rect.x = 0;
+        rect.y = tile * job->tile_rows;
+        rect.w = job->surface->w;
+        rect.h = SDL_min(job->tile_rows, job->surface->h - rect.y);
+
+        for (i = (tile > 0) ? job->item_ends[tile - 1] : 0; i < job->item_ends[tile]; ++i) {
+            const SW_TileItem *item = &job->items[i];
+
+            if (draw != &job->draws[item->draw]) {
+                SDL_Rect cliprect;
+
+                draw = &job->draws[item->draw];
+                src = NULL;
+                if (draw->texture_index >= 0) {
+                    src = surfaces[1 + draw->texture_index];
+                    SetCopyState(src, draw->cmd);
                 }
+                SDL_IntersectRect(&draw->cliprect, &rect, &cliprect);
+                SDL_SetClipRect(surface, &cliprect);
+            }
+
+            if (item->copy >= 0) {
+                /* Tiled copies are never scaled */
+                const SDL_Rect *rects = (const SDL_Rect *)(((Uint8 *)job->vertices) + draw->cmd->data.draw.first) + 2 * item->copy;
+                SDL_Rect dstrect = rects[1];
+
+                SDL_BlitSurface(src, &rects[0], surface, &dstrect);
+            } else {
+                SW_DrawCommand(job->renderer, surface, src, draw->cmd, job->vertices);
+            }
+        }
+    }
+}
+
+static void SW_RunTiledDrawsSerially(SDL_Renderer *renderer, SDL_Surface *surface, const SW_TiledDraw *draws, int count, void *vertices)
+{
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_RenderCommand *cmd = draws[i].cmd;
+        SDL_Texture *texture = (cmd->command == SDL_RENDERCMD_CLEAR) ? NULL : cmd->data.draw.texture;
+
+        if (texture) {
+            PrepTextureForCopy(cmd);
+        }
+        SDL_SetClipRect(surface, &draws[i].cliprect);
+        SW_DrawCommand(renderer, surface, texture ? (SDL_Surface *)texture->driverdata : NULL, cmd, vertices);
+    }
+}
+
+static SDL_bool SW_UseTiles(SDL_Surface *surface)
+{
+    if (!SDL_GetHintBoolean(SDL_HINT_RENDER_SOFTWARE_TILES, SDL_FALSE)) {
+        return SDL_FALSE;
+    }
+    return SW_CanShareSurface(surface) && surface->h >= 2 * SW_TILE_MIN_ROWS;
+}
+
+static int SW_RunCommandQueueTiled(SDL_Renderer *renderer, SDL_Surface *surface, SDL_RenderCommand *cmd, void *vertices)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
+    SW_DrawStateCache drawstate;
+    SW_TileJob job;
+    SDL_RenderCommand *it;
+    int num_cmds = 0, num_draws = 0, num_textures = 0, num_tiles;
+    int i;
+
+    for (it = cmd; it; it = it->next) {
+        ++num_cmds;
+    }
+    /* Each command adds at most one draw and one texture */
+    if (!SW_ReserveTiledDraws(data, num_cmds)) {
+        return -1;
+    }
+
+    /* Record the clip rect of each draw and move it into the viewport, like the serial path does */
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
 
-                SW_RenderCopyEx(renderer, surface, cmd->data.draw.texture, &copydata->srcrect,
-                                &copydata->dstrect, copydata->angle, &copydata->center, copydata->flip,
-                                copydata->scale_x, copydata->scale_y);
+    for (; cmd; cmd = cmd->next) {
+        SW_TiledDraw *draw;
+
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETVIEWPORT: {
+                drawstate.viewport = &cmd->data.viewport.rect;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
                 break;
             }
 
+            case SDL_RENDERCMD_SETCLIPRECT: {
+                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_CLEAR: {
+                /* By definition the clear ignores the clip rect */
+                SW_TrackDraw(data, surface, cmd, vertices);
+                draw = &data->tiled_draws[num_draws++];
+                draw->cmd = cmd;
+                draw->cliprect.x = 0;
+                draw->cliprect.y = 0;
+                draw->cliprect.w = surface->w;
+                draw->cliprect.h = surface->h;
+                draw->tileable = SDL_TRUE;
+                draw->texture_index = -1;
+                break;
+            }
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
             case SDL_RENDERCMD_GEOMETRY: {
-                int i;
-                SDL_Rect *verts = (SDL_Rect *) (((Uint8 *) vertices) + cmd->data.draw.first);
-                const int count = (int) cmd->data.draw.count;
                 SDL_Texture *texture = cmd->data.draw.texture;
-                const SDL_BlendMode blend = cmd->data.draw.blend;
 
                 SetDrawState(surface, &drawstate);
+                ApplyViewport(cmd, vertices, drawstate.viewport);
+                SW_TrackDraw(data, surface, cmd, vertices);
 
-                if (texture) {
-                    SDL_Surface *src = (SDL_Surface *) texture->driverdata;
+                draw = &data->tiled_draws[num_draws++];
+                draw->cmd = cmd;
+                draw->cliprect = surface->clip_rect;
+                draw->tileable = SW_IsTileable(cmd, vertices);
+                draw->texture_index = -1;
 
-                    GeometryCopyData *ptr = (GeometryCopyData *) verts;
+                if (draw->tileable && texture) {
+                    SDL_Surface *src = (SDL_Surface *)texture->driverdata;
 
-                    PrepTextureForCopy(cmd);
+                    SW_ConvertYUVTexture(texture);
 
-                    /* Apply viewport */
-                    if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                        SDL_Point vp;
-                        vp.x = drawstate.viewport->x;
-                        vp.y = drawstate.viewport->y;
-                        trianglepoint_2_fixedpoint(&vp);
-                        for (i = 0; i < count; i++) {
-                            ptr[i].dst.x += vp.x;
-                            ptr[i].dst.y += vp.y;
+                    for (i = num_textures - 1; i >= 0; --i) {
+                        if (data->tiled_textures[i] == src) {
+                            break;
                         }
                     }
-
-                    for (i = 0; i < count; i += 3, ptr += 3) {
-                        SDL_SW_BlitTriangle(
-                                src,
-                                &(ptr[0].src), &(ptr[1].src), &(ptr[2].src),
-                                surface,
-                                &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst),
-                                ptr[0].color, ptr[1].color, ptr[2].color);
-                    }
-                } else {
-                    GeometryFillData *ptr = (GeometryFillData *) verts;
-
-                    /* Apply viewport */
-                    if (drawstate.viewport && (drawstate.viewport->x || drawstate.viewport->y)) {
-                        SDL_Point vp;
-                        vp.x = drawstate.viewport->x;
-                        vp.y = drawstate.viewport->y;
-                        trianglepoint_2_fixedpoint(&vp);
-                        for (i = 0; i < count; i++) {
-                            ptr[i].dst.x += vp.x;
-                            ptr[i].dst.y += vp.y;
-                        }
+                    if (i < 0) {
+                        i = num_textures++;
+                        data->tiled_textures[i] = src;
                     }
+                    draw->texture_index = i;
+                }
+                break;
+            }
 
-                    for (i = 0; i < count; i += 3, ptr += 3) {
-                        SDL_SW_FillTriangle(surface, &(ptr[0].dst), &(ptr[1].dst), &(ptr[2].dst), blend, ptr[0].color, ptr[1].color, ptr[2].color);
-                    }
+            default:
+                break;
+        }
+    }
+
+    /* A few bands per thread, so a band full of sprites doesn't hold up the others */
+    SDL_zero(job);
+    num_tiles = SDL_GetJobConcurrency() * SW_TILES_PER_THREAD;
+    job.tile_rows = SDL_max((surface->h + num_tiles - 1) / num_tiles, SW_TILE_MIN_ROWS);
+    job.num_tiles = (surface->h + job.tile_rows - 1) / job.tile_rows;
+
+    job.renderer = renderer;
+    job.surface = surface;
+    job.vertices = vertices;
+    job.textures = data->tiled_textures;
+    job.num_textures = num_textures;
+
+    for (i = 0; i < num_draws;) {
+        int end = i;
+
+        while (end < num_draws && data->tiled_draws[end].tileable) {
+            ++end;
+        }
+
+        if (end == i) {
+            SW_RunTiledDrawsSerially(renderer, surface, &data->tiled_draws[i], 1, vertices);
+            ++i;
+            continue;
+        }
+
+        job.draws = &data->tiled_draws[i];
+        job.num_draws = end - i;
+        job.tile_surfaces = (SDL_Surface **)SDL_calloc(job.num_tiles * (num_textures + 1), sizeof(*job.tile_surfaces));
+
+        if (!job.tile_surfaces || !SW_BinTileItems(data, &job) || !SW_CreateTileSurfaces(&job)) {
+            SW_RunTiledDrawsSerially(renderer, surface, job.draws, job.num_draws, vertices);
+        } else {
+            SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, SW_RenderTiles, &job, job.num_tiles, 1);
+        }
+
+        if (job.tile_surfaces) {
+            int j;
+
+            for (j = 0; j < job.num_tiles * (num_textures + 1); ++j) {
+                SDL_FreeSurface(job.tile_surfaces[j]);
+            }
+            SDL_free(job.tile_surfaces);
+        }
+        i = end;
+    }
+
+    return 0;
+}
+
+static int SW_RunCommandQueue(SDL_Renderer *renderer, SDL_RenderCommand *cmd, void *vertices, size_t vertsize)
+{
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
+    SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_DrawStateCache drawstate;
+
+    if (!surface) {
+        return -1;
+    }
+
+    if (SW_UseTiles(surface) && SW_RunCommandQueueTiled(renderer, surface, cmd, vertices) == 0) {
+        return 0;
+    }
+
+    drawstate.viewport = NULL;
+    drawstate.cliprect = NULL;
+    drawstate.surface_cliprect_dirty = SDL_TRUE;
+
+    while (cmd) {
+        switch (cmd->command) {
+            case SDL_RENDERCMD_SETDRAWCOLOR: {
+                break;  /* Not used in this backend. */
+            }
+
+            case SDL_RENDERCMD_SETVIEWPORT: {
+                drawstate.viewport = &cmd->data.viewport.rect;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_SETCLIPRECT: {
+                drawstate.cliprect = cmd->data.cliprect.enabled ? &cmd->data.cliprect.rect : NULL;
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_CLEAR: {
+                /* By definition the clear ignores the clip rect */
+                SDL_SetClipRect(surface, NULL);
+                SW_TrackDraw(data, surface, cmd, vertices);
+                SW_DrawCommand(renderer, surface, NULL, cmd, vertices);
+                drawstate.surface_cliprect_dirty = SDL_TRUE;
+                break;
+            }
+
+            case SDL_RENDERCMD_DRAW_POINTS:
+            case SDL_RENDERCMD_DRAW_LINES:
+            case SDL_RENDERCMD_FILL_RECTS:
+            case SDL_RENDERCMD_COPY:
+            case SDL_RENDERCMD_COPY_EX:
+            case SDL_RENDERCMD_GEOMETRY: {
+                SDL_Texture *texture = cmd->data.draw.texture;
+
+                SetDrawState(surface, &drawstate);
+                ApplyViewport(cmd, vertices, drawstate.viewport);
+                SW_TrackDraw(data, surface, cmd, vertices);
+
+                if (texture) {
+                    PrepTextureForCopy(cmd);
                 }
+                SW_DrawCommand(renderer, surface, texture ? (SDL_Surface *)texture->driverdata : NULL, cmd, vertices);
                 break;
             }
 
@@ -963,18 +1920,49 @@ static int SW_RenderReadPixels(SDL_Renderer *renderer, const SDL_Rect *rect,
 
 static int SW_RenderPresent(SDL_Renderer *renderer)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Window *window = renderer->window;
+    SDL_Surface *surface = data->window;
+    int retval, w, h, i;
 
     if (!window) {
         return -1;
     }
-    return SDL_UpdateWindowSurface(window);
+
+    /* A frame that drew nothing still updates the whole window, presenting paces the frame rate */
+    if (!data->dirty_full && surface && data->num_dirty_rects > 0) {
+        Sint64 pixels = 0;
+
+        for (i = 0; i < data->num_dirty_rects; ++i) {
+            pixels += (Sint64)data->dirty_rects[i].w * data->dirty_rects[i].h;
+        }
+        if (pixels * 100 <= (Sint64)surface->w * surface->h * SW_DIRTY_FULL_PERCENT) {
+            retval = SDL_UpdateWindowSurfaceRects(window, data->dirty_rects, data->num_dirty_rects);
+            renderer->stats.present_rects = (Uint32)data->num_dirty_rects;
+            renderer->stats.present_pixels = (Uint32)pixels;
+            data->num_dirty_rects = 0;
+            data->dirty_full = (retval < 0);
+            return retval;
+        }
+    }
+
+    SDL_GetWindowSizeInPixels(window, &w, &h);
+    retval = SDL_UpdateWindowSurface(window);
+    renderer->stats.present_rects = 0;
+    renderer->stats.present_pixels = (Uint32)w * h;
+    data->num_dirty_rects = 0;
+    /* With tracking disabled every present is a full update */
+    data->dirty_full = (!data->dirty_rects_enabled || retval < 0);
+    return retval;
 }
 
 static void SW_DestroyTexture(SDL_Renderer *renderer, SDL_Texture *texture)
 {
+    SW_RenderData *data = (SW_RenderData *)renderer->driverdata;
     SDL_Surface *surface = (SDL_Surface *)texture->driverdata;
 
+    SW_InvalidateRotatedSurfaces(data, texture);
+
     SDL_FreeSurface(surface);
 }
 
@@ -986,6 +1974,16 @@ static void SW_DestroyRenderer(SDL_Renderer *renderer)
     if (window) {
         SDL_DestroyWindowSurface(window);
     }
+    if (data) {
+        SDL_free(data->tiled_draws);
+        SDL_free(data->tiled_textures);
+        SDL_free(data->tile_items);
+        SDL_free(data->tile_item_ends);
+        SW_InvalidateRotatedSurfaces(data, NULL);
+        SDL_free(data->rotate_cache);
+        SDL_FreeSurface(data->scratch_scaled);
+        SDL_FreeSurface(data->scratch_mask);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -994,6 +1992,7 @@ SDL_Renderer *SW_CreateRendererForSurface(SDL_Surface *surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
 
     if (!surface) {
         SDL_InvalidParamError("surface");
@@ -1014,9 +2013,14 @@ SDL_Renderer *SW_CreateRendererForSurface(SDL_Surface *surface)
     }
     data->surface = surface;
     data->window = surface;
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_ROTATE_CACHE);
+    data->rotate_cache_size = hint ? SDL_max(SDL_atoi(hint), 0) : SW_ROTATE_CACHE_DEFAULT_SIZE;
+    data->dirty_rects_enabled = SDL_GetHintBoolean(SDL_HINT_RENDER_SOFTWARE_DIRTY_RECTS, SDL_TRUE);
+    data->dirty_full = SDL_TRUE;
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
+    renderer->SupportsBlendMode = SW_SupportsBlendMode;
     renderer->CreateTexture = SW_CreateTexture;
     renderer->UpdateTexture = SW_UpdateTexture;
     renderer->LockTexture = SW_LockTexture;
@@ -1078,7 +2082,11 @@ SDL_RenderDriver SW_RenderDriver = {
     {
      "software",
      SDL_RENDERER_SOFTWARE | SDL_RENDERER_PRESENTVSYNC | SDL_RENDERER_TARGETTEXTURE,
+#if SDL_HAVE_YUV
+     15,
+#else
      8,
+#endif
      {
       SDL_PIXELFORMAT_ARGB8888,
       SDL_PIXELFORMAT_ABGR8888,
@@ -1087,7 +2095,17 @@ SDL_RenderDriver SW_RenderDriver = {
       SDL_PIXELFORMAT_RGB888,
       SDL_PIXELFORMAT_BGR888,
       SDL_PIXELFORMAT_RGB565,
-      SDL_PIXELFORMAT_RGB555
+      SDL_PIXELFORMAT_RGB555,
+#if SDL_HAVE_YUV
+      /* P010 and P016 don't fit, they get an RGB texture */
+      SDL_PIXELFORMAT_YV12,
+      SDL_PIXELFORMAT_IYUV,
+      SDL_PIXELFORMAT_NV12,
+      SDL_PIXELFORMAT_NV21,
+      SDL_PIXELFORMAT_YUY2,
+      SDL_PIXELFORMAT_UYVY,
+      SDL_PIXELFORMAT_YVYU
+#endif
      },
      0,
      0}
@@ -29,14 +29,6 @@
 
 #include "../../video/SDL_blit.h"
 
-/* fixed points bits precision
- * Set to 1, so that it can start rendering wth middle of a pixel precision.
- * It doesn't need to be increased.
- * But, if increased too much, it overflows (srcx, srcy) coordinates used for filling with texture.
- * (which could be turned to int64).
- */
-#define FP_BITS 1
-
 #define COLOR_EQ(c1, c2) ((c1).r == (c2).r && (c1).g == (c2).g && (c1).b == (c2).b && (c1).a == (c2).a)
 
 static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
@@ -44,6 +36,12 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
                                   int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
                                   int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, int w0_row, int w1_row, int w2_row,
                                   SDL_Color c0, SDL_Color c1, SDL_Color c2, int is_uniform);
+static SDL_bool SDL_BlitTriangle_Can32(const SDL_BlitInfo *info);
+static void SDL_BlitTriangle_32(SDL_BlitInfo *info,
+                               SDL_Point s2_x_area, SDL_Rect dstrect, Sint64 area, int bias_w0, int bias_w1, int bias_w2,
+                               int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
+                               int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, Sint64 w0_row, Sint64 w1_row, Sint64 w2_row,
+                               SDL_Color c0, SDL_Color c1, SDL_Color c2, int is_uniform);
 
 #if 0
 int SDL_BlitTriangle(SDL_Surface *src, const SDL_Point srcpoints[3], SDL_Surface *dst, const SDL_Point dstpoints[3])
@@ -161,6 +159,48 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
     r->h = (max_y - min_y);
 }
 
+/* Narrows the span [*x_start, x_end) of a row to the pixels where the edge function
+ * w + x * step isn't negative, and returns the new end.
+ */
+static SDL_INLINE int clip_span_to_edge(Sint64 w, int step, int *x_start, int x_end)
+{
+    if (step > 0) {
+        if (w < 0) {
+            const Sint64 first = (-w + step - 1) / step;
+            if (first > *x_start) {
+                *x_start = (int)SDL_min(first, (Sint64)x_end);
+            }
+        }
+    } else if (step < 0) {
+        if (w < 0) {
+            return *x_start;
+        } else {
+            const Sint64 last = w / -(Sint64)step;
+            if (last < x_end - 1) {
+                x_end = (int)last + 1;
+            }
+        }
+    } else if (w < 0) {
+        return *x_start;
+    }
+    return x_end;
+}
+
+/* Finds the pixels of a row that are inside the triangle, given the biased edge functions
+ * at its first pixel. The edge functions are linear along the row, so this gives exactly
+ * the pixels that testing each of them would, without the per pixel tests.
+ */
+static int triangle_row_span(Sint64 w0, Sint64 w1, Sint64 w2, int step0, int step1, int step2, int width, int *x_start)
+{
+    int x_end = width;
+
+    *x_start = 0;
+    x_end = clip_span_to_edge(w0, step0, x_start, x_end);
+    x_end = clip_span_to_edge(w1, step1, x_start, x_end);
+    x_end = clip_span_to_edge(w2, step2, x_start, x_end);
+    return x_end;
+}
+
 /* Triangle rendering, using Barycentric coordinates (w0, w1, w2)
  *
  * The cross product isn't computed from scratch at each iteration,
@@ -168,17 +208,22 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
  *
  */
 
-#define TRIANGLE_BEGIN_LOOP                                                        \
-    {                                                                              \
-        int x, y;                                                                  \
-        for (y = 0; y < dstrect.h; y++) {                                          \
-            /* y start */                                                          \
-            Sint64 w0 = w0_row;                                                    \
-            Sint64 w1 = w1_row;                                                    \
-            Sint64 w2 = w2_row;                                                    \
-            for (x = 0; x < dstrect.w; x++) {                                      \
-                /* In triangle */                                                  \
-                if (w0 + bias_w0 >= 0 && w1 + bias_w1 >= 0 && w2 + bias_w2 >= 0) { \
+#define TRIANGLE_BEGIN_LOOP                                                                 \
+    {                                                                                       \
+        int x, y;                                                                           \
+        for (y = 0; y < dstrect.h; y++) {                                                   \
+            /* y start */                                                                   \
+            Sint64 w0 = w0_row;                                                             \
+            Sint64 w1 = w1_row;                                                             \
+            Sint64 w2 = w2_row;                                                             \
+            /* Only visit the pixels in the triangle */                                     \
+            const int x_end = triangle_row_span(w0 + bias_w0, w1 + bias_w1, w2 + bias_w2,   \
+                                                d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x);     \
+            w0 += (Sint64)x * d2d1_y;                                                       \
+            w1 += (Sint64)x * d0d2_y;                                                       \
+            w2 += (Sint64)x * d1d0_y;                                                       \
+            for (; x < x_end; x++, w0 += d2d1_y, w1 += d0d2_y, w2 += d1d0_y) {              \
+                {                                                                           \
                     Uint8 *dptr = (Uint8 *)dst_ptr + x * dstbpp;
 
 /* Use 64 bits precision to prevent overflow when interpolating color / texture with wide triangles */
@@ -201,10 +246,6 @@ static void bounding_rect(const SDL_Point *a, const SDL_Point *b, const SDL_Poin
 
 #define TRIANGLE_END_LOOP \
     }                     \
-    /* x += 1 */          \
-    w0 += d2d1_y;         \
-    w1 += d0d2_y;         \
-    w2 += d1d0_y;         \
     }                     \
     /* y += 1 */          \
     w0_row += d1d2_x;     \
@@ -366,11 +407,19 @@ int SDL_SW_FillTriangle(SDL_Surface *dst, SDL_Point *d0, SDL_Point *d1, SDL_Poin
         }
 
         if (dstbpp == 4) {
-            TRIANGLE_BEGIN_LOOP
-            {
-                *(Uint32 *)dptr = color;
+            int y;
+            for (y = 0; y < dstrect.h; y++) {
+                int x_start;
+                const int x_end = triangle_row_span(w0_row + bias_w0, w1_row + bias_w1, w2_row + bias_w2,
+                                                    d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x_start);
+                if (x_start < x_end) {
+                    SDL_memset4(dst_ptr + x_start * 4, color, x_end - x_start);
+                }
+                w0_row += d1d2_x;
+                w1_row += d2d0_x;
+                w2_row += d0d1_x;
+                dst_ptr += dst_pitch;
             }
-            TRIANGLE_END_LOOP
         } else if (dstbpp == 3) {
             TRIANGLE_BEGIN_LOOP
             {
@@ -707,22 +756,35 @@ int SDL_SW_BlitTriangle(
         CHECK_INT_RANGE(w0_row);
         CHECK_INT_RANGE(w1_row);
         CHECK_INT_RANGE(w2_row);
-        SDL_BlitTriangle_Slow(&tmp_info, s2_x_area, dstrect, (int)area, bias_w0, bias_w1, bias_w2,
-                              d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
-                              s2s0_x, s2s1_x, s2s0_y, s2s1_y, (int)w0_row, (int)w1_row, (int)w2_row,
-                              c0, c1, c2, is_uniform);
+        if (SDL_BlitTriangle_Can32(&tmp_info)) {
+            SDL_BlitTriangle_32(&tmp_info, s2_x_area, dstrect, area, bias_w0, bias_w1, bias_w2,
+                                d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                s2s0_x, s2s1_x, s2s0_y, s2s1_y, w0_row, w1_row, w2_row,
+                                c0, c1, c2, is_uniform);
+        } else {
+            SDL_BlitTriangle_Slow(&tmp_info, s2_x_area, dstrect, (int)area, bias_w0, bias_w1, bias_w2,
+                                  d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                                  s2s0_x, s2s1_x, s2s0_y, s2s1_y, (int)w0_row, (int)w1_row, (int)w2_row,
+                                  c0, c1, c2, is_uniform);
+        }
 
         goto end;
     }
 
     if (dstbpp == 4) {
-        TRIANGLE_BEGIN_LOOP
-        {
-            TRIANGLE_GET_TEXTCOORD
-            Uint32 *sptr = (Uint32 *)((Uint8 *)src_ptr + srcy * src_pitch);
-            *(Uint32 *)dptr = sptr[srcx];
-        }
-        TRIANGLE_END_LOOP
+        SDL_BlitInfo copy_info;
+
+        SDL_zero(copy_info);
+        copy_info.src = (Uint8 *)src_ptr;
+        copy_info.src_pitch = src_pitch;
+        copy_info.src_fmt = src->format;
+        copy_info.dst = dst_ptr;
+        copy_info.dst_pitch = dst_pitch;
+        copy_info.dst_fmt = dst->format;
+        SDL_BlitTriangle_32(&copy_info, s2_x_area, dstrect, area, bias_w0, bias_w1, bias_w2,
+                            d2d1_y, d1d2_x, d0d2_y, d2d0_x, d1d0_y, d0d1_x,
+                            s2s0_x, s2s1_x, s2s0_y, s2s1_y, w0_row, w1_row, w2_row,
+                            c0, c1, c2, is_uniform);
     } else if (dstbpp == 3) {
         TRIANGLE_BEGIN_LOOP
         {
@@ -834,7 +896,7 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
                 continue;
             }
         }
-        if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL))) {
+        if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED))) {
             if (FORMAT_HAS_ALPHA(dstfmt_val)) {
                 DISEMBLE_RGBA(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG, dstB, dstA);
             } else if (FORMAT_HAS_NO_ALPHA(dstfmt_val)) {
@@ -865,6 +927,12 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
         }
         if (flags & SDL_COPY_MODULATE_ALPHA) {
             srcA = (srcA * modulateA) / 255;
+            if (flags & SDL_COPY_BLEND_PREMULTIPLIED) {
+                /* The color is premultiplied, so it fades with the alpha */
+                srcR = (srcR * modulateA) / 255;
+                srcG = (srcG * modulateA) / 255;
+                srcB = (srcB * modulateA) / 255;
+            }
         }
         if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
             /* This goes away if we ever use premultiplied alpha */
@@ -874,7 +942,7 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
                 srcB = (srcB * srcA) / 255;
             }
         }
-        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+        switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED)) {
         case 0:
             dstR = srcR;
             dstG = srcG;
@@ -887,6 +955,9 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
             dstB = srcB + ((255 - srcA) * dstB) / 255;
             dstA = srcA + ((255 - srcA) * dstA) / 255;
             break;
+        case SDL_COPY_BLEND_PREMULTIPLIED:
+            PREMULTIPLIED_ALPHA_BLEND_RGBA(srcR, srcG, srcB, srcA, dstR, dstG, dstB, dstA);
+            break;
         case SDL_COPY_ADD:
             dstR = srcR + dstR;
             if (dstR > 255) {
@@ -935,6 +1006,341 @@ static void SDL_BlitTriangle_Slow(SDL_BlitInfo *info,
     TRIANGLE_END_LOOP
 }
 
+/* Copying 32-bit textures, and blending 8888 textures onto 8888 surfaces with the same color layout
+ *
+ * These are the common cases for textured geometry, and do exactly what the
+ * loops above and SDL_BlitTriangle_Slow() do for them. The texture coordinates
+ * and vertex colors are stepped along each span instead of being divided out
+ * at every pixel, and the blending uses vector instructions where available.
+ */
+
+/* value / area as an exact quotient and remainder, so it can be stepped without dividing */
+typedef struct
+{
+    Sint64 q; /* floor(value / area) */
+    Sint64 r; /* the remainder, in [0, area) */
+} TriangleInterp;
+
+static SDL_INLINE void interp_init(TriangleInterp *it, Sint64 value, Sint64 area)
+{
+    it->q = value / area;
+    it->r = value % area;
+    if (it->r < 0) {
+        it->r += area;
+        it->q -= 1;
+    }
+}
+
+static SDL_INLINE int interp_get(const TriangleInterp *it)
+{
+    /* Rounded toward zero, like the division it replaces */
+    return (int)(it->q + ((it->q < 0) & (it->r != 0)));
+}
+
+/* The carries are data dependent and don't predict well, so these don't branch */
+static SDL_INLINE void interp_add(TriangleInterp *it, const TriangleInterp *step, Sint64 area)
+{
+    Sint64 carry;
+
+    it->r += step->r;
+    carry = (it->r >= area);
+    it->q += step->q + carry;
+    it->r -= area & -carry;
+}
+
+static SDL_INLINE void interp_sub(TriangleInterp *it, const TriangleInterp *step, Sint64 area)
+{
+    Sint64 borrow;
+
+    it->r -= step->r;
+    borrow = (it->r < 0);
+    it->q -= step->q + borrow;
+    it->r += area & -borrow;
+}
+
+static SDL_bool SDL_BlitTriangle_Can32(const SDL_BlitInfo *info)
+{
+    const SDL_PixelFormat *src_fmt = info->src_fmt;
+    const SDL_PixelFormat *dst_fmt = info->dst_fmt;
+
+    /* Copies and the BLEND blend mode */
+    if (info->flags & (SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_COLORKEY)) {
+        return SDL_FALSE;
+    }
+    if (src_fmt->BytesPerPixel != 4 || dst_fmt->BytesPerPixel != 4) {
+        return SDL_FALSE;
+    }
+    /* The destination has the same layout, with or without alpha */
+    if (src_fmt->Rmask != dst_fmt->Rmask || src_fmt->Gmask != dst_fmt->Gmask || src_fmt->Bmask != dst_fmt->Bmask ||
+        !src_fmt->Amask || (dst_fmt->Amask && dst_fmt->Amask != src_fmt->Amask)) {
+        return SDL_FALSE;
+    }
+    /* Every channel is a whole byte */
+    if ((src_fmt->Rmask >> src_fmt->Rshift) != 0xFF || (src_fmt->Gmask >> src_fmt->Gshift) != 0xFF ||
+        (src_fmt->Bmask >> src_fmt->Bshift) != 0xFF || (src_fmt->Amask >> src_fmt->Ashift) != 0xFF ||
+        (src_fmt->Rshift | src_fmt->Gshift | src_fmt->Bshift | src_fmt->Ashift) & 7) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
+/* Modulates one texel, both in the same byte layout */
+static SDL_INLINE Uint32 modulate_8888(Uint32 s, Uint32 m)
+{
+    Uint32 result = 0;
+    int shift;
+
+    for (shift = 0; shift < 32; shift += 8) {
+        result |= ((((s >> shift) & 0xFF) * ((m >> shift) & 0xFF)) / 255) << shift;
+    }
+    return result;
+}
+
+/* Blends one texel with the modulation, all three in the same byte layout */
+static SDL_INLINE Uint32 blend_8888(Uint32 s, Uint32 m, Uint32 d, int ashift, Uint32 dst_amask)
+{
+    const Uint32 srcA = (((s >> ashift) & 0xFF) * ((m >> ashift) & 0xFF)) / 255;
+    Uint32 result = 0;
+    int shift;
+
+    if (!dst_amask) {
+        /* Read as opaque, written as zero */
+        d |= (Uint32)0xFF << ashift;
+    }
+    for (shift = 0; shift < 32; shift += 8) {
+        const Uint32 dstC = (d >> shift) & 0xFF;
+        Uint32 srcC;
+
+        if (shift == ashift) {
+            srcC = srcA;
+        } else {
+            srcC = (((s >> shift) & 0xFF) * ((m >> shift) & 0xFF)) / 255;
+            srcC = (srcC * srcA) / 255;
+        }
+        result |= (srcC + ((255 - srcA) * dstC) / 255) << shift;
+    }
+    if (!dst_amask) {
+        result &= ~((Uint32)0xFF << ashift);
+    }
+    return result;
+}
+
+#if defined(__SSE2__)
+#define BLITV_SSE2
+#include "../../video/SDL_blit_simd.h"
+#include "SDL_triangle_simd.h"
+#undef BLITV_SSE2
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+#define BLITV_AVX2
+#include "../../video/SDL_blit_simd.h"
+#include "SDL_triangle_simd.h"
+#undef BLITV_AVX2
+#endif
+#if defined(__ARM_NEON)
+#define BLITV_NEON
+#include "../../video/SDL_blit_simd.h"
+#include "SDL_triangle_simd.h"
+#undef BLITV_NEON
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define BLITV_ALTIVEC
+#include "../../video/SDL_blit_simd.h"
+#include "SDL_triangle_simd.h"
+#undef BLITV_ALTIVEC
+#endif
+
+/* Blends n texels with their modulation, like blend_8888() with alpha in the top byte */
+typedef void (*TriangleBlend8888Func)(const Uint32 *texels, const Uint32 *mods, Uint32 *dst, int n, Uint32 dst_amask);
+
+/* The texels are gathered in batches of this many pixels for the vector blend */
+#define TRIANGLE_BLEND_BATCH 16
+
+static TriangleBlend8888Func GetTriangleBlend8888(void)
+{
+    const int features = SDL_GetBlitCPUFeatures();
+
+#if defined(SDL_AVX2_INTRINSICS)
+    if (features & SDL_CPU_AVX2) {
+        return TriangleBlend8888_AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return TriangleBlend8888_SSE2;
+    }
+#endif
+#if defined(__ARM_NEON)
+    if (features & SDL_CPU_NEON) {
+        return TriangleBlend8888_NEON;
+    }
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (features & SDL_CPU_ALTIVEC) {
+        return TriangleBlend8888_AltiVec;
+    }
+#endif
+    (void)features;
+    return NULL;
+}
+
+/* Texture coordinates and vertex colors of a pixel, and the steps to its neighbors */
+typedef struct
+{
+    TriangleInterp u, v;
+    TriangleInterp r, g, b, a;
+} TriangleInterps;
+
+static SDL_INLINE void interps_add(TriangleInterps *it, const TriangleInterps *step, Sint64 area, int is_uniform)
+{
+    interp_add(&it->u, &step->u, area);
+    interp_add(&it->v, &step->v, area);
+    if (!is_uniform) {
+        interp_add(&it->r, &step->r, area);
+        interp_add(&it->g, &step->g, area);
+        interp_add(&it->b, &step->b, area);
+        interp_add(&it->a, &step->a, area);
+    }
+}
+
+static SDL_INLINE void interps_sub(TriangleInterps *it, const TriangleInterps *step, Sint64 area, int is_uniform)
+{
+    interp_sub(&it->u, &step->u, area);
+    interp_sub(&it->v, &step->v, area);
+    if (!is_uniform) {
+        interp_sub(&it->r, &step->r, area);
+        interp_sub(&it->g, &step->g, area);
+        interp_sub(&it->b, &step->b, area);
+        interp_sub(&it->a, &step->a, area);
+    }
+}
+
+/* Sets up the values for edge functions w0, w1 and w2, with the same arithmetic as
+ * TRIANGLE_GET_TEXTCOORD and TRIANGLE_GET_COLOR. Used for the steps too, without the base.
+ */
+static void interps_init(TriangleInterps *it, Sint64 w0, Sint64 w1, Sint64 w2, const SDL_Point *base, Sint64 area,
+                         int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y,
+                         SDL_Color c0, SDL_Color c1, SDL_Color c2, int is_uniform)
+{
+    interp_init(&it->u, w0 * s2s0_x + w1 * s2s1_x + (base ? base->x : 0), area);
+    interp_init(&it->v, w0 * s2s0_y + w1 * s2s1_y + (base ? base->y : 0), area);
+    if (!is_uniform) {
+        interp_init(&it->r, w0 * c0.r + w1 * c1.r + w2 * c2.r, area);
+        interp_init(&it->g, w0 * c0.g + w1 * c1.g + w2 * c2.g, area);
+        interp_init(&it->b, w0 * c0.b + w1 * c1.b + w2 * c2.b, area);
+        interp_init(&it->a, w0 * c0.a + w1 * c1.a + w2 * c2.a, area);
+    }
+}
+
+static void SDL_BlitTriangle_32(SDL_BlitInfo *info,
+                               SDL_Point s2_x_area, SDL_Rect dstrect, Sint64 area, int bias_w0, int bias_w1, int bias_w2,
+                               int d2d1_y, int d1d2_x, int d0d2_y, int d2d0_x, int d1d0_y, int d0d1_x,
+                               int s2s0_x, int s2s1_x, int s2s0_y, int s2s1_y, Sint64 w0_row, Sint64 w1_row, Sint64 w2_row,
+                               SDL_Color c0, SDL_Color c1, SDL_Color c2, int is_uniform)
+{
+    const SDL_PixelFormat *fmt = info->src_fmt;
+    const Uint32 dst_amask = info->dst_fmt->Amask;
+    const int ashift = fmt->Ashift;
+    Uint32 mod = ((Uint32)info->r << fmt->Rshift) | ((Uint32)info->g << fmt->Gshift) |
+                 ((Uint32)info->b << fmt->Bshift) | ((Uint32)info->a << fmt->Ashift);
+    TriangleInterps row, step_x, step_y;
+    Uint8 *dst_ptr = info->dst;
+    Uint32 copy_mask = 0xFFFFFFFF;
+    SDL_bool modulate;
+    int row_x = 0;
+    int y;
+    const TriangleBlend8888Func blend_simd = (ashift == 24 && (info->flags & SDL_COPY_BLEND)) ? GetTriangleBlend8888() : NULL;
+
+    /* The unmodulated colors are all 255, so the modulation can always be applied */
+    if (!(info->flags & SDL_COPY_MODULATE_COLOR)) {
+        mod |= fmt->Rmask | fmt->Gmask | fmt->Bmask;
+    }
+    if (!(info->flags & SDL_COPY_MODULATE_ALPHA)) {
+        mod |= fmt->Amask;
+    }
+
+    /* Copies keep every byte, unless the destination drops the alpha channel */
+    modulate = (info->flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) ? SDL_TRUE : SDL_FALSE;
+    if (!dst_amask && info->src_fmt->format != info->dst_fmt->format) {
+        copy_mask = ~((Uint32)0xFF << ashift);
+    }
+
+    /* Only the setup divides, the rows and spans step exactly from there */
+    interps_init(&row, w0_row, w1_row, w2_row, &s2_x_area, area, s2s0_x, s2s1_x, s2s0_y, s2s1_y, c0, c1, c2, is_uniform);
+    interps_init(&step_x, d2d1_y, d0d2_y, d1d0_y, NULL, area, s2s0_x, s2s1_x, s2s0_y, s2s1_y, c0, c1, c2, is_uniform);
+    interps_init(&step_y, d1d2_x, d2d0_x, d0d1_x, NULL, area, s2s0_x, s2s1_x, s2s0_y, s2s1_y, c0, c1, c2, is_uniform);
+
+    for (y = 0; y < dstrect.h; y++) {
+        int x;
+        const int x_end = triangle_row_span(w0_row + bias_w0, w1_row + bias_w1, w2_row + bias_w2,
+                                            d2d1_y, d0d2_y, d1d0_y, dstrect.w, &x);
+
+        if (x < x_end) {
+            TriangleInterps it;
+            Uint32 *dst = (Uint32 *)dst_ptr + x;
+
+            /* The spans of neighboring rows start close to each other */
+            for (; row_x < x; ++row_x) {
+                interps_add(&row, &step_x, area, is_uniform);
+            }
+            for (; row_x > x; --row_x) {
+                interps_sub(&row, &step_x, area, is_uniform);
+            }
+            it = row;
+
+#define BLEND8888_FETCH(texel, pixel_mod)                                                                           \
+    texel = *((const Uint32 *)(info->src + interp_get(&it.v) * info->src_pitch) + interp_get(&it.u));               \
+    if (is_uniform) {                                                                                                \
+        pixel_mod = mod;                                                                                             \
+    } else {                                                                                                         \
+        pixel_mod = ((Uint32)interp_get(&it.r) << fmt->Rshift) | ((Uint32)interp_get(&it.g) << fmt->Gshift) |       \
+                    ((Uint32)interp_get(&it.b) << fmt->Bshift) | ((Uint32)interp_get(&it.a) << fmt->Ashift);        \
+    }                                                                                                                \
+    interps_add(&it, &step_x, area, is_uniform);
+
+            if (!(info->flags & SDL_COPY_BLEND)) {
+                for (; x < x_end; x++, dst++) {
+                    Uint32 texel, pixel_mod;
+
+                    BLEND8888_FETCH(texel, pixel_mod)
+                    if (modulate) {
+                        texel = modulate_8888(texel, pixel_mod);
+                    }
+                    *dst = texel & copy_mask;
+                }
+            }
+            if (blend_simd) {
+                while (x < x_end) {
+                    Uint32 texels[TRIANGLE_BLEND_BATCH], mods[TRIANGLE_BLEND_BATCH];
+                    const int n = SDL_min(x_end - x, TRIANGLE_BLEND_BATCH);
+                    int i;
+
+                    for (i = 0; i < n; ++i) {
+                        BLEND8888_FETCH(texels[i], mods[i])
+                    }
+                    blend_simd(texels, mods, dst, n, dst_amask);
+                    x += n;
+                    dst += n;
+                }
+            }
+            for (; x < x_end; x++, dst++) {
+                Uint32 texel, pixel_mod;
+
+                BLEND8888_FETCH(texel, pixel_mod)
+                *dst = blend_8888(texel, pixel_mod, *dst, ashift, dst_amask);
+            }
+#undef BLEND8888_FETCH
+        }
+
+        /* y += 1 */
+        interps_add(&row, &step_y, area, is_uniform);
+        w0_row += d1d2_x;
+        w1_row += d2d0_x;
+        w2_row += d0d1_x;
+        dst_ptr += info->dst_pitch;
+    }
+}
+
 #endif /* SDL_VIDEO_RENDER_SW */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -24,6 +24,14 @@
 
 #include "../../SDL_internal.h"
 
+/* fixed points bits precision
+ * Set to 1, so that it can start rendering wth middle of a pixel precision.
+ * It doesn't need to be increased.
+ * But, if increased too much, it overflows (srcx, srcy) coordinates used for filling with texture.
+ * (which could be turned to int64).
+ */
+#define FP_BITS 1
+
 extern int SDL_SW_FillTriangle(SDL_Surface *dst,
                                SDL_Point *d0, SDL_Point *d1, SDL_Point *d2,
                                SDL_BlendMode blend, SDL_Color c0, SDL_Color c1, SDL_Color c2);
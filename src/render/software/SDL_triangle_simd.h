@@ -0,0 +1,56 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * Blending of modulated 8888 texels onto 8888 pixels, with alpha in the top
+ * byte, written with the operations of SDL_blit_simd.h. SDL_triangle.c
+ * includes this once for every instruction set it is built with.
+ *
+ * The results are exactly those of blend_8888().
+ */
+
+BLITV_TARGET static void BLITV_NAME(TriangleBlend8888)(const Uint32 *texels, const Uint32 *mods, Uint32 *dst, int n, Uint32 dst_amask)
+{
+    const BLITV alpha = BLITV_SPLAT32(0xFF000000);
+    const BLITV opaque = BLITV_SPLAT32(dst_amask ? 0 : 0xFF000000);
+    const BLITV ones = BLITV_SPLAT32(0xFFFFFFFF);
+
+    for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+        BLITV s = BLITV_MULDIV255(BLITV_LOAD(texels), BLITV_LOAD(mods));
+        BLITV d = BLITV_OR(BLITV_LOAD(dst), opaque);
+        BLITV a = BLITV_SRL32(s, 24);
+
+        a = BLITV_OR(a, BLITV_SLL32(a, 8));
+        a = BLITV_OR(a, BLITV_SLL32(a, 16));
+        /* The colors are scaled by the alpha, the alpha is kept */
+        s = BLITV_MULDIV255(s, BLITV_OR(a, alpha));
+        d = BLITV_MULDIV255(d, BLITV_SUB8(ones, a));
+        BLITV_STORE(dst, BLITV_ANDNOT(BLITV_ADD8(s, d), opaque));
+        texels += BLITV_PIXELS;
+        mods += BLITV_PIXELS;
+        dst += BLITV_PIXELS;
+    }
+    for (; n > 0; --n, ++texels, ++mods, ++dst) {
+        *dst = blend_8888(*texels, *mods, *dst, 24, dst_amask);
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,306 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* Data-parallel job dispatch for SDL internals */
+
+#include "SDL_hints.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_jobs_c.h"
+#include "SDL_systhread.h"
+
+/* Don't spin up more helpers than this, the kernels are memory bound */
+#define SDL_MAX_JOB_WORKERS 16
+
+typedef struct SDL_JobBatch
+{
+    SDL_JobFunc func;
+    void *userdata;
+    int count;
+    int grain;
+    SDL_atomic_t next; /* the first item that hasn't been claimed yet */
+    int users;         /* workers currently running chunks, protected by the pool lock */
+    SDL_bool queued;
+    struct SDL_JobBatch *prev;
+    struct SDL_JobBatch *nextbatch;
+} SDL_JobBatch;
+
+#ifndef SDL_THREADS_DISABLED
+typedef struct
+{
+    SDL_mutex *lock;
+    SDL_cond *work_available;
+    SDL_cond *batch_released;
+    SDL_JobBatch *head;
+    SDL_JobBatch *tail;
+    SDL_bool quit;
+    int num_workers;
+    SDL_Thread *workers[SDL_MAX_JOB_WORKERS];
+} SDL_JobPool;
+
+static SDL_JobPool *SDL_job_pool;
+static SDL_atomic_t SDL_job_pool_initialized;
+#endif /* !SDL_THREADS_DISABLED */
+
+static void SDL_RunJobChunks(SDL_JobBatch *batch)
+{
+    for (;;) {
+        const int start = SDL_AtomicAdd(&batch->next, batch->grain);
+        int end;
+
+        if (start >= batch->count) {
+            break;
+        }
+        end = SDL_min(start + batch->grain, batch->count);
+        batch->func(batch->userdata, start, end);
+    }
+}
+
+#ifndef SDL_THREADS_DISABLED
+
+/* Must be called with the pool lock held */
+static void SDL_UnlinkJobBatch(SDL_JobPool *pool, SDL_JobBatch *batch)
+{
+    if (!batch->queued) {
+        return;
+    }
+    if (batch->prev) {
+        batch->prev->nextbatch = batch->nextbatch;
+    } else {
+        pool->head = batch->nextbatch;
+    }
+    if (batch->nextbatch) {
+        batch->nextbatch->prev = batch->prev;
+    } else {
+        pool->tail = batch->prev;
+    }
+    batch->prev = batch->nextbatch = NULL;
+    batch->queued = SDL_FALSE;
+}
+
+static int SDLCALL SDL_JobWorkerThread(void *data)
+{
+    SDL_JobPool *pool = (SDL_JobPool *)data;
+
+    SDL_LockMutex(pool->lock);
+    for (;;) {
+        SDL_JobBatch *batch;
+
+        while (!pool->quit && !pool->head) {
+            SDL_CondWait(pool->work_available, pool->lock);
+        }
+        if (pool->quit) {
+            break;
+        }
+
+        batch = pool->head;
+        ++batch->users;
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_RunJobChunks(batch);
+
+        SDL_LockMutex(pool->lock);
+        /* Every chunk has been claimed, nobody else needs to pick this up */
+        SDL_UnlinkJobBatch(pool, batch);
+        if (--batch->users == 0) {
+            SDL_CondBroadcast(pool->batch_released);
+        }
+    }
+    SDL_UnlockMutex(pool->lock);
+
+    return 0;
+}
+
+static void SDL_DestroyJobPool(SDL_JobPool *pool)
+{
+    int i;
+
+    if (pool->lock) {
+        SDL_LockMutex(pool->lock);
+        pool->quit = SDL_TRUE;
+        SDL_CondBroadcast(pool->work_available);
+        SDL_UnlockMutex(pool->lock);
+    }
+    for (i = 0; i < pool->num_workers; ++i) {
+        SDL_WaitThread(pool->workers[i], NULL);
+    }
+    SDL_DestroyCond(pool->batch_released);
+    SDL_DestroyCond(pool->work_available);
+    SDL_DestroyMutex(pool->lock);
+    SDL_free(pool);
+}
+
+static int SDL_GetDesiredJobWorkers(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_JOB_THREADS);
+    int num_workers;
+
+    if (hint && *hint) {
+        /* The hint counts the calling thread, which always takes part */
+        num_workers = SDL_atoi(hint) - 1;
+    } else {
+        num_workers = SDL_GetCPUCount() - 1;
+    }
+    return SDL_clamp(num_workers, 0, SDL_MAX_JOB_WORKERS);
+}
+
+static SDL_JobPool *SDL_CreateJobPool(void)
+{
+    SDL_JobPool *pool;
+    const int num_workers = SDL_GetDesiredJobWorkers();
+    int i;
+
+    if (num_workers == 0) {
+        return NULL;
+    }
+
+    pool = (SDL_JobPool *)SDL_calloc(1, sizeof(*pool));
+    if (!pool) {
+        return NULL;
+    }
+    pool->lock = SDL_CreateMutex();
+    pool->work_available = SDL_CreateCond();
+    pool->batch_released = SDL_CreateCond();
+    if (!pool->lock || !pool->work_available || !pool->batch_released) {
+        SDL_DestroyJobPool(pool);
+        return NULL;
+    }
+
+    for (i = 0; i < num_workers; ++i) {
+        char name[32];
+
+        SDL_snprintf(name, sizeof(name), "SDLJobWorker%d", i);
+        pool->workers[i] = SDL_CreateThreadInternal(SDL_JobWorkerThread, name, 0, pool);
+        if (!pool->workers[i]) {
+            break;
+        }
+        ++pool->num_workers;
+    }
+    if (pool->num_workers == 0) {
+        SDL_DestroyJobPool(pool);
+        return NULL;
+    }
+    return pool;
+}
+
+static SDL_JobPool *SDL_GetJobPool(void)
+{
+    SDL_JobPool *pool = (SDL_JobPool *)SDL_AtomicGetPtr((void **)&SDL_job_pool);
+
+    if (!pool && !SDL_AtomicGet(&SDL_job_pool_initialized)) {
+        /* Starting the workers can take a while, so don't hold a lock while
+           doing it. If another thread published its pool first, use that one.
+           If creation fails, we just run jobs on the calling thread. */
+        pool = SDL_CreateJobPool();
+        if (pool && !SDL_AtomicCASPtr((void **)&SDL_job_pool, NULL, pool)) {
+            SDL_DestroyJobPool(pool);
+            pool = (SDL_JobPool *)SDL_AtomicGetPtr((void **)&SDL_job_pool);
+        }
+        SDL_AtomicSet(&SDL_job_pool_initialized, 1);
+    }
+    return pool;
+}
+
+#endif /* !SDL_THREADS_DISABLED */
+
+int SDL_GetJobConcurrency(void)
+{
+#ifndef SDL_THREADS_DISABLED
+    SDL_JobPool *pool = SDL_GetJobPool();
+    if (pool) {
+        return 1 + pool->num_workers;
+    }
+#endif
+    return 1;
+}
+
+void SDL_RunJobs(SDL_JobKernel kernel, SDL_JobFunc func, void *userdata, int count, int grain)
+{
+    SDL_JobBatch batch;
+#ifndef SDL_THREADS_DISABLED
+    SDL_JobPool *pool;
+#endif
+
+    (void)kernel; /* No SPU kernels are registered yet, everything runs on the PPU pool */
+
+    if (count <= 0) {
+        return;
+    }
+
+#ifndef SDL_THREADS_DISABLED
+    pool = SDL_GetJobPool();
+    if (grain <= 0) {
+        const int concurrency = pool ? (1 + pool->num_workers) : 1;
+        grain = (count + concurrency - 1) / concurrency;
+    }
+#else
+    grain = count;
+#endif
+
+    SDL_zero(batch);
+    batch.func = func;
+    batch.userdata = userdata;
+    batch.count = count;
+    batch.grain = grain;
+
+#ifndef SDL_THREADS_DISABLED
+    if (pool && count > grain) {
+        SDL_LockMutex(pool->lock);
+        batch.prev = pool->tail;
+        if (pool->tail) {
+            pool->tail->nextbatch = &batch;
+        } else {
+            pool->head = &batch;
+        }
+        pool->tail = &batch;
+        batch.queued = SDL_TRUE;
+        SDL_CondBroadcast(pool->work_available);
+        SDL_UnlockMutex(pool->lock);
+
+        SDL_RunJobChunks(&batch);
+
+        /* The batch lives on our stack, wait until no worker references it */
+        SDL_LockMutex(pool->lock);
+        SDL_UnlinkJobBatch(pool, &batch);
+        while (batch.users > 0) {
+            SDL_CondWait(pool->batch_released, pool->lock);
+        }
+        SDL_UnlockMutex(pool->lock);
+        return;
+    }
+#endif /* !SDL_THREADS_DISABLED */
+
+    SDL_RunJobChunks(&batch);
+}
+
+void SDL_JobsQuit(void)
+{
+#ifndef SDL_THREADS_DISABLED
+    SDL_JobPool *pool = (SDL_JobPool *)SDL_AtomicSetPtr((void **)&SDL_job_pool, NULL);
+
+    SDL_AtomicSet(&SDL_job_pool_initialized, 0);
+    if (pool) {
+        SDL_DestroyJobPool(pool);
+    }
+#endif
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,66 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef SDL_jobs_c_h_
+#define SDL_jobs_c_h_
+
+/* Internal interface for offloading data-parallel work.
+
+   A job splits the index range [0, count) into chunks of at most `grain`
+   items and calls the job function on each chunk, possibly from several
+   threads at once. SDL_RunJobs() returns once every chunk has completed;
+   the calling thread always works on the range itself, so a job never
+   waits on a busy pool and nested jobs cannot deadlock.
+
+   The kernel tag says what kind of work the job does. Platforms with
+   dedicated coprocessors (the Cell SPUs on PSL1GHT) can use it to pick an
+   accelerated implementation; everywhere else, and whenever no such
+   implementation is available, the chunks run on a pool of worker threads.
+ */
+
+typedef enum
+{
+    SDL_JOB_KERNEL_GENERIC,
+    SDL_JOB_KERNEL_BLIT_ROWS,
+    SDL_JOB_KERNEL_YUV_CONVERT,
+    SDL_JOB_KERNEL_COUNT
+} SDL_JobKernel;
+
+/* Process items [start, end) of the job. */
+typedef void (*SDL_JobFunc)(void *userdata, int start, int end);
+
+/* Run a data-parallel job and wait for it to finish.
+   If grain is <= 0, the range is split evenly across the available threads.
+ */
+extern void SDL_RunJobs(SDL_JobKernel kernel, SDL_JobFunc func, void *userdata, int count, int grain);
+
+/* Returns the number of threads that can work on a job at once, including
+   the calling thread. This is 1 when jobs run serially.
+ */
+extern int SDL_GetJobConcurrency(void);
+
+/* Shut down the worker pool, called from SDL_Quit() */
+extern void SDL_JobsQuit(void);
+
+#endif /* SDL_jobs_c_h_ */
+
+/* vi: set ts=4 sw=4 expandtab: */
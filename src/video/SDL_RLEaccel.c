@@ -52,6 +52,12 @@
  *
  * Encoding of colorkeyed surfaces:
  *
+ *   The sequence begins with a table of 32-bit offsets, from the start of
+ *   the encoding, of the first segment of every scan line. Blits of part of
+ *   the surface, like a sprite of a sprite sheet, go straight to the lines
+ *   and columns they need instead of through all the segments before them.
+ *   Lines after the last one with any pixels start at the end of sequence.
+ *
  *   Encoded pixels always have the same format as the target surface.
  *   <skip> and <run> are unsigned 8 bit integers, except for 32 bit depth
  *   where they are 16 bit. This makes the pixel data aligned at all times.
@@ -63,12 +69,15 @@
  * Encoding of surfaces with per-pixel alpha:
  *
  *   The sequence begins with a struct RLEDestFormat describing the target
- *   pixel format, to provide reliable un-encoding.
+ *   pixel format, to provide reliable un-encoding, followed by a table of
+ *   two offsets per scan line like the one above: where its opaque pixels
+ *   start, and where its translucent pixels start.
  *
  *   Each scan line is encoded twice: First all completely opaque pixels,
  *   encoded in the target format as described above, and then all
  *   partially transparent (translucent) pixels (where 1 <= alpha <= 254),
- *   in the following 32-bit format:
+ *   in the following 32-bit format. A translucent segment may take in a few
+ *   pixels that blending leaves as they are, see RLEAlphaSurface().
  *
  *   For 32-bit targets, each pixel has the target RGB format but with
  *   the alpha value occupying the highest 8 bits. The <skip> and <run>
@@ -87,6 +96,7 @@
  *   beginning of an opaque line.
  */
 
+#include "SDL_hints.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
 #include "SDL_blit.h"
@@ -384,55 +394,43 @@
 
 /*
  * This takes care of the case when the surface is clipped on the left and/or
- * right. Top clipping has already been taken care of.
+ * right. Each line starts where the line table says, so top clipping and the
+ * pixels past the right edge are skipped without going through their runs.
  */
-#define RLECLIPBLIT(bpp, Type, do_blit)                                    \
-    do {                                                                   \
-        int linecount = srcrect->h;                                        \
-        int ofs = 0;                                                       \
-        int left = srcrect->x;                                             \
-        int right = left + srcrect->w;                                     \
-        dstbuf -= left * bpp;                                              \
-        for (;;) {                                                         \
-            int run;                                                       \
-            ofs += *(Type *)srcbuf;                                        \
-            run = ((Type *)srcbuf)[1];                                     \
-            srcbuf += 2 * sizeof(Type);                                    \
-            if (run) {                                                     \
-                /* clip to left and right borders */                       \
-                if (ofs < right) {                                         \
-                    int start = 0;                                         \
-                    int len = run;                                         \
-                    int startcol;                                          \
-                    if (left - ofs > 0) {                                  \
-                        start = left - ofs;                                \
-                        len -= start;                                      \
-                        if (len <= 0)                                      \
-                            goto nocopy##bpp##do_blit;                     \
-                    }                                                      \
-                    startcol = ofs + start;                                \
-                    if (len > right - startcol)                            \
-                        len = right - startcol;                            \
-                    do_blit(dstbuf + startcol * bpp, srcbuf + start * bpp, \
-                            len, bpp, alpha);                              \
-                }                                                          \
-                nocopy##bpp##do_blit : srcbuf += run * bpp;                \
-                ofs += run;                                                \
-            } else if (!ofs) {                                             \
-                break;                                                     \
-            }                                                              \
-                                                                           \
-            if (ofs == w) {                                                \
-                ofs = 0;                                                   \
-                dstbuf += surf_dst->pitch;                                 \
-                if (!--linecount) {                                        \
-                    break;                                                 \
-                }                                                          \
-            }                                                              \
-        }                                                                  \
+#define RLECLIPBLIT(bpp, Type, do_blit)                                        \
+    do {                                                                       \
+        int linecount = srcrect->h;                                            \
+        int left = srcrect->x;                                                 \
+        int right = left + srcrect->w;                                         \
+        const Uint32 *line = rows + srcrect->y;                                \
+        dstbuf -= left * bpp;                                                  \
+        do {                                                                   \
+            Uint8 *srcbuf = rledata + *line++;                                 \
+            int ofs = 0;                                                       \
+            while (ofs < right) {                                              \
+                int run;                                                       \
+                ofs += *(Type *)srcbuf;                                        \
+                run = ((Type *)srcbuf)[1];                                     \
+                srcbuf += 2 * sizeof(Type);                                    \
+                if (run) {                                                     \
+                    /* clip to left and right borders */                       \
+                    int start = SDL_max(left - ofs, 0);                        \
+                    int len = SDL_min(ofs + run, right) - (ofs + start);       \
+                    if (len > 0) {                                             \
+                        do_blit(dstbuf + (ofs + start) * bpp,                  \
+                                srcbuf + start * bpp, len, bpp, alpha);        \
+                    }                                                          \
+                    srcbuf += run * bpp;                                       \
+                    ofs += run;                                                \
+                } else if (!ofs) {                                             \
+                    return;                                                    \
+                }                                                              \
+            }                                                                  \
+            dstbuf += surf_dst->pitch;                                         \
+        } while (--linecount);                                                 \
     } while (0)
 
-static void RLEClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
+static void RLEClipBlit(Uint8 *rledata, const Uint32 *rows, SDL_Surface *surf_dst,
                         Uint8 *dstbuf, SDL_Rect *srcrect, unsigned alpha)
 {
     SDL_PixelFormat *fmt = surf_dst->format;
@@ -448,6 +446,8 @@ static int SDLCALL SDL_RLEBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
 {
     Uint8 *dstbuf;
     Uint8 *srcbuf;
+    Uint8 *rledata = (Uint8 *)surf_src->map->data;
+    const Uint32 *rows = (const Uint32 *)rledata;
     int x, y;
     int w = surf_src->w;
     unsigned alpha;
@@ -459,59 +459,16 @@ static int SDLCALL SDL_RLEBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
         }
     }
 
-    /* Set up the source and destination pointers */
+    /* Set up the source and destination pointers, skipping lines at the top */
     x = dstrect->x;
     y = dstrect->y;
     dstbuf = (Uint8 *)surf_dst->pixels + y * surf_dst->pitch + x * surf_src->format->BytesPerPixel;
-    srcbuf = (Uint8 *)surf_src->map->data;
-
-    {
-        /* skip lines at the top if necessary */
-        int vskip = srcrect->y;
-        int ofs = 0;
-        if (vskip) {
-
-#define RLESKIP(bpp, Type)          \
-    for (;;) {                      \
-        int run;                    \
-        ofs += *(Type *)srcbuf;     \
-        run = ((Type *)srcbuf)[1];  \
-        srcbuf += sizeof(Type) * 2; \
-        if (run) {                  \
-            srcbuf += run * bpp;    \
-            ofs += run;             \
-        } else if (!ofs)            \
-            goto done;              \
-        if (ofs == w) {             \
-            ofs = 0;                \
-            if (!--vskip)           \
-                break;              \
-        }                           \
-    }
-
-            switch (surf_src->format->BytesPerPixel) {
-            case 1:
-                RLESKIP(1, Uint8);
-                break;
-            case 2:
-                RLESKIP(2, Uint8);
-                break;
-            case 3:
-                RLESKIP(3, Uint8);
-                break;
-            case 4:
-                RLESKIP(4, Uint16);
-                break;
-            }
-
-#undef RLESKIP
-        }
-    }
+    srcbuf = rledata + rows[srcrect->y];
 
     alpha = surf_src->map->info.a;
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != surf_src->w) {
-        RLEClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect, alpha);
+        RLEClipBlit(rledata, rows, surf_dst, dstbuf, srcrect, alpha);
     } else {
         SDL_PixelFormat *fmt = surf_src->format;
 
@@ -544,7 +501,6 @@ static int SDLCALL SDL_RLEBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
 #undef RLEBLIT
     }
 
-done:
     /* Unlock the destination if necessary */
     if (SDL_MUSTLOCK(surf_dst)) {
         SDL_UnlockSurface(surf_dst);
@@ -605,6 +561,87 @@ done:
         dst = (Uint16)(d | d >> 16);       \
     } while (0)
 
+/* blend a run of translucent pixels */
+typedef void (*RLEBlendRun888)(Uint32 *dst, const Uint32 *src, unsigned n);
+
+static void BlendTranslRun888(Uint32 *dst, const Uint32 *src, unsigned n)
+{
+    unsigned i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_888(src[i], dst[i]);
+    }
+}
+
+static void BlendTranslRun565(Uint16 *dst, const Uint32 *src, unsigned n)
+{
+    unsigned i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_565(src[i], dst[i]);
+    }
+}
+
+static void BlendTranslRun555(Uint16 *dst, const Uint32 *src, unsigned n)
+{
+    unsigned i;
+    for (i = 0; i < n; i++) {
+        BLIT_TRANSL_555(src[i], dst[i]);
+    }
+}
+
+/* vector versions of BlendTranslRun888(), which sprites spend most of their time in */
+#if defined(__SSE2__)
+#define BLITV_SSE2
+#include "SDL_blit_simd.h"
+#include "SDL_RLEaccel_simd.h"
+#undef BLITV_SSE2
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+#define BLITV_AVX2
+#include "SDL_blit_simd.h"
+#include "SDL_RLEaccel_simd.h"
+#undef BLITV_AVX2
+#endif
+#if defined(__ARM_NEON)
+#define BLITV_NEON
+#include "SDL_blit_simd.h"
+#include "SDL_RLEaccel_simd.h"
+#undef BLITV_NEON
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define BLITV_ALTIVEC
+#include "SDL_blit_simd.h"
+#include "SDL_RLEaccel_simd.h"
+#undef BLITV_ALTIVEC
+#endif
+
+static RLEBlendRun888 GetBlendTranslRun888(void)
+{
+    const int features = SDL_GetBlitCPUFeatures();
+
+#if defined(SDL_AVX2_INTRINSICS)
+    if (features & SDL_CPU_AVX2) {
+        return BlendTranslRun888_AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return BlendTranslRun888_SSE2;
+    }
+#endif
+#if defined(__ARM_NEON)
+    if (features & SDL_CPU_NEON) {
+        return BlendTranslRun888_NEON;
+    }
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (features & SDL_CPU_ALTIVEC) {
+        return BlendTranslRun888_AltiVec;
+    }
+#endif
+    (void)features;
+    return BlendTranslRun888;
+}
+
 /* used to save the destination format in the encoding. Designed to be
    macro-compatible with SDL_PixelFormat but without the unneeded fields */
 typedef struct
@@ -623,96 +660,84 @@ typedef struct
     Uint8 Gshift;
     Uint8 Bshift;
     Uint8 Ashift;
+    RLEBlendRun888 blend_888; /* chosen for the CPU when encoding */
 } RLEDestFormat;
 
 /* blit a pixel-alpha RLE surface clipped at the right and/or left edges */
-static void RLEAlphaClipBlit(int w, Uint8 *srcbuf, SDL_Surface *surf_dst,
-                             Uint8 *dstbuf, SDL_Rect *srcrect)
+static void RLEAlphaClipBlit(Uint8 *rledata, const Uint32 *rows, SDL_Surface *surf_dst,
+                             Uint8 *dstbuf, SDL_Rect *srcrect, RLEBlendRun888 blend_888)
 {
     SDL_PixelFormat *df = surf_dst->format;
     /*
      * clipped blitter: Ptype is the destination pixel type,
-     * Ctype the translucent count type, and do_blend the macro
-     * to blend one pixel.
+     * Ctype the opaque count type, and blend_run the function
+     * to blend a run of pixels. Both halves of a line start where
+     * the line table says, so the pixels past the right edge are
+     * skipped without going through their runs.
      */
-#define RLEALPHACLIPBLIT(Ptype, Ctype, do_blend)                          \
-    do {                                                                  \
-        int linecount = srcrect->h;                                       \
-        int left = srcrect->x;                                            \
-        int right = left + srcrect->w;                                    \
-        dstbuf -= left * sizeof(Ptype);                                   \
-        do {                                                              \
-            int ofs = 0;                                                  \
-            /* blit opaque pixels on one line */                          \
-            do {                                                          \
-                unsigned run;                                             \
-                ofs += ((Ctype *)srcbuf)[0];                              \
-                run = ((Ctype *)srcbuf)[1];                               \
-                srcbuf += 2 * sizeof(Ctype);                              \
-                if (run) {                                                \
-                    /* clip to left and right borders */                  \
-                    int cofs = ofs;                                       \
-                    int crun = run;                                       \
-                    if (left - cofs > 0) {                                \
-                        crun -= left - cofs;                              \
-                        cofs = left;                                      \
-                    }                                                     \
-                    if (crun > right - cofs)                              \
-                        crun = right - cofs;                              \
-                    if (crun > 0)                                         \
-                        PIXEL_COPY(dstbuf + cofs * sizeof(Ptype),         \
-                                   srcbuf + (cofs - ofs) * sizeof(Ptype), \
-                                   (unsigned)crun, sizeof(Ptype));        \
-                    srcbuf += run * sizeof(Ptype);                        \
-                    ofs += run;                                           \
-                } else if (!ofs)                                          \
-                    return;                                               \
-            } while (ofs < w);                                            \
-            /* skip padding if necessary */                               \
-            if (sizeof(Ptype) == 2)                                       \
-                srcbuf += (uintptr_t)srcbuf & 2;                          \
-            /* blit translucent pixels on the same line */                \
-            ofs = 0;                                                      \
-            do {                                                          \
-                unsigned run;                                             \
-                ofs += ((Uint16 *)srcbuf)[0];                             \
-                run = ((Uint16 *)srcbuf)[1];                              \
-                srcbuf += 4;                                              \
-                if (run) {                                                \
-                    /* clip to left and right borders */                  \
-                    int cofs = ofs;                                       \
-                    int crun = run;                                       \
-                    if (left - cofs > 0) {                                \
-                        crun -= left - cofs;                              \
-                        cofs = left;                                      \
-                    }                                                     \
-                    if (crun > right - cofs)                              \
-                        crun = right - cofs;                              \
-                    if (crun > 0) {                                       \
-                        Ptype *dst = (Ptype *)dstbuf + cofs;              \
-                        Uint32 *src = (Uint32 *)srcbuf + (cofs - ofs);    \
-                        int i;                                            \
-                        for (i = 0; i < crun; i++)                        \
-                            do_blend(src[i], dst[i]);                     \
-                    }                                                     \
-                    srcbuf += run * 4;                                    \
-                    ofs += run;                                           \
-                }                                                         \
-            } while (ofs < w);                                            \
-            dstbuf += surf_dst->pitch;                                    \
-        } while (--linecount);                                            \
+#define RLEALPHACLIPBLIT(Ptype, Ctype, blend_run)                             \
+    do {                                                                      \
+        int linecount = srcrect->h;                                           \
+        int left = srcrect->x;                                                \
+        int right = left + srcrect->w;                                        \
+        const Uint32 *line = rows + 2 * srcrect->y;                           \
+        dstbuf -= left * sizeof(Ptype);                                       \
+        do {                                                                  \
+            Uint8 *srcbuf = rledata + line[0];                                \
+            int ofs = 0;                                                      \
+            /* blit opaque pixels on one line */                              \
+            while (ofs < right) {                                             \
+                int run;                                                      \
+                ofs += ((Ctype *)srcbuf)[0];                                  \
+                run = ((Ctype *)srcbuf)[1];                                   \
+                srcbuf += 2 * sizeof(Ctype);                                  \
+                if (run) {                                                    \
+                    /* clip to left and right borders */                      \
+                    int start = SDL_max(left - ofs, 0);                       \
+                    int len = SDL_min(ofs + run, right) - (ofs + start);      \
+                    if (len > 0)                                              \
+                        PIXEL_COPY(dstbuf + (ofs + start) * sizeof(Ptype),    \
+                                   srcbuf + start * sizeof(Ptype),            \
+                                   (unsigned)len, sizeof(Ptype));             \
+                    srcbuf += run * sizeof(Ptype);                            \
+                    ofs += run;                                               \
+                } else if (!ofs)                                              \
+                    return;                                                   \
+            }                                                                 \
+            /* blit translucent pixels on the same line */                    \
+            srcbuf = rledata + line[1];                                       \
+            ofs = 0;                                                          \
+            while (ofs < right) {                                             \
+                int run;                                                      \
+                ofs += ((Uint16 *)srcbuf)[0];                                 \
+                run = ((Uint16 *)srcbuf)[1];                                  \
+                srcbuf += 4;                                                  \
+                if (run) {                                                    \
+                    /* clip to left and right borders */                      \
+                    int start = SDL_max(left - ofs, 0);                       \
+                    int len = SDL_min(ofs + run, right) - (ofs + start);      \
+                    if (len > 0)                                              \
+                        blend_run((Ptype *)dstbuf + ofs + start,              \
+                                  (Uint32 *)srcbuf + start, (unsigned)len);   \
+                    srcbuf += run * 4;                                        \
+                    ofs += run;                                               \
+                }                                                             \
+            }                                                                 \
+            line += 2;                                                        \
+            dstbuf += surf_dst->pitch;                                        \
+        } while (--linecount);                                                \
     } while (0)
 
     switch (df->BytesPerPixel) {
     case 2:
         if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_565);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BlendTranslRun565);
         } else {
-            RLEALPHACLIPBLIT(Uint16, Uint8, BLIT_TRANSL_555);
+            RLEALPHACLIPBLIT(Uint16, Uint8, BlendTranslRun555);
         }
         break;
     case 4:
-        RLEALPHACLIPBLIT(Uint32, Uint16, BLIT_TRANSL_888);
+        RLEALPHACLIPBLIT(Uint32, Uint16, blend_888);
         break;
     }
 }
@@ -723,8 +748,11 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
 {
     int x, y;
     int w = surf_src->w;
+    Uint8 *rledata = (Uint8 *)surf_src->map->data;
+    const Uint32 *rows = (const Uint32 *)(rledata + sizeof(RLEDestFormat));
     Uint8 *srcbuf, *dstbuf;
     SDL_PixelFormat *df = surf_dst->format;
+    RLEBlendRun888 blend_888 = ((RLEDestFormat *)rledata)->blend_888;
 
     /* Lock the destination if necessary */
     if (SDL_MUSTLOCK(surf_dst)) {
@@ -733,80 +761,23 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
         }
     }
 
+    /* Set up the source and destination pointers, skipping lines at the top */
     x = dstrect->x;
     y = dstrect->y;
     dstbuf = (Uint8 *)surf_dst->pixels + y * surf_dst->pitch + x * df->BytesPerPixel;
-    srcbuf = (Uint8 *)surf_src->map->data + sizeof(RLEDestFormat);
-
-    {
-        /* skip lines at the top if necessary */
-        int vskip = srcrect->y;
-        if (vskip) {
-            int ofs;
-            if (df->BytesPerPixel == 2) {
-                /* the 16/32 interleaved format */
-                do {
-                    /* skip opaque line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += srcbuf[0];
-                        run = srcbuf[1];
-                        srcbuf += 2;
-                        if (run) {
-                            srcbuf += 2 * run;
-                            ofs += run;
-                        } else if (ofs == 0) {
-                            goto done;
-                        }
-                    } while (ofs < w);
-
-                    /* skip padding */
-                    srcbuf += (uintptr_t)srcbuf & 2;
-
-                    /* skip translucent line */
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *)srcbuf)[0];
-                        run = ((Uint16 *)srcbuf)[1];
-                        srcbuf += 4 * (run + 1);
-                        ofs += run;
-                    } while (ofs < w);
-                } while (--vskip);
-            } else {
-                /* the 32/32 interleaved format */
-                vskip <<= 1; /* opaque and translucent have same format */
-                do {
-                    ofs = 0;
-                    do {
-                        int run;
-                        ofs += ((Uint16 *)srcbuf)[0];
-                        run = ((Uint16 *)srcbuf)[1];
-                        srcbuf += 4;
-                        if (run) {
-                            srcbuf += 4 * run;
-                            ofs += run;
-                        } else if (ofs == 0) {
-                            goto done;
-                        }
-                    } while (ofs < w);
-                } while (--vskip);
-            }
-        }
-    }
+    srcbuf = rledata + rows[2 * srcrect->y];
 
     /* if left or right edge clipping needed, call clip blit */
     if (srcrect->x || srcrect->w != surf_src->w) {
-        RLEAlphaClipBlit(w, srcbuf, surf_dst, dstbuf, srcrect);
+        RLEAlphaClipBlit(rledata, rows, surf_dst, dstbuf, srcrect, blend_888);
     } else {
 
         /*
          * non-clipped blitter. Ptype is the destination pixel type,
-         * Ctype the translucent count type, and do_blend the
-         * macro to blend one pixel.
+         * Ctype the opaque count type, and blend_run the
+         * function to blend a run of pixels.
          */
-#define RLEALPHABLIT(Ptype, Ctype, do_blend)                         \
+#define RLEALPHABLIT(Ptype, Ctype, blend_run)                        \
     do {                                                             \
         int linecount = srcrect->h;                                  \
         do {                                                         \
@@ -836,14 +807,9 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
                 run = ((Uint16 *)srcbuf)[1];                         \
                 srcbuf += 4;                                         \
                 if (run) {                                           \
-                    Ptype *dst = (Ptype *)dstbuf + ofs;              \
-                    unsigned i;                                      \
-                    for (i = 0; i < run; i++) {                      \
-                        Uint32 src = *(Uint32 *)srcbuf;              \
-                        do_blend(src, *dst);                         \
-                        srcbuf += 4;                                 \
-                        dst++;                                       \
-                    }                                                \
+                    blend_run((Ptype *)dstbuf + ofs,                 \
+                              (Uint32 *)srcbuf, run);                \
+                    srcbuf += run * 4;                               \
                     ofs += run;                                      \
                 }                                                    \
             } while (ofs < w);                                       \
@@ -854,13 +820,13 @@ static int SDLCALL SDL_RLEAlphaBlit(SDL_Surface *surf_src, SDL_Rect *srcrect,
         switch (df->BytesPerPixel) {
         case 2:
             if (df->Gmask == 0x07e0 || df->Rmask == 0x07e0 || df->Bmask == 0x07e0) {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_565);
+                RLEALPHABLIT(Uint16, Uint8, BlendTranslRun565);
             } else {
-                RLEALPHABLIT(Uint16, Uint8, BLIT_TRANSL_555);
+                RLEALPHABLIT(Uint16, Uint8, BlendTranslRun555);
             }
             break;
         case 4:
-            RLEALPHABLIT(Uint32, Uint16, BLIT_TRANSL_888);
+            RLEALPHABLIT(Uint32, Uint16, blend_888);
             break;
         }
     }
@@ -1008,6 +974,11 @@ static int uncopy_32(Uint32 *dst, void *src, int n,
 #define ISTRANSL(pixel, fmt) \
     ((unsigned)((((pixel)&fmt->Amask) >> fmt->Ashift) - 1U) < 254U)
 
+#define ISTRANSPARENT(pixel, fmt) (((pixel)&fmt->Amask) == 0)
+
+/* the longest gap between two translucent runs that is encoded as part of them */
+#define RLE_MERGE_GAP 8
+
 /* convert surface to be quickly alpha-blittable onto dest, if possible */
 static int RLEAlphaSurface(SDL_Surface *surface)
 {
@@ -1016,8 +987,11 @@ static int RLEAlphaSurface(SDL_Surface *surface)
     int maxsize = 0;
     int max_opaque_run;
     int max_transl_run = 65535;
+    int merge_gap = 0;
+    SDL_bool merge_opaque, merge_transparent;
     unsigned masksum;
     Uint8 *rlebuf, *dst;
+    Uint32 *rows;
     int (*copy_opaque)(void *, Uint32 *, int,
                        SDL_PixelFormat *, SDL_PixelFormat *);
     int (*copy_transl)(void *, Uint32 *, int,
@@ -1070,7 +1044,7 @@ static int RLEAlphaSurface(SDL_Surface *surface)
         }
         copy_opaque = copy_32;
         copy_transl = copy_32;
-        max_opaque_run = 255; /* runs stored as short ints */
+        max_opaque_run = 65535; /* runs stored as short ints */
 
         /* worst case is alternating opaque and translucent pixels */
         maxsize = surface->h * 2 * 4 * (surface->w + 1) + 4;
@@ -1079,7 +1053,22 @@ static int RLEAlphaSurface(SDL_Surface *surface)
         return -1; /* anything else unsupported right now */
     }
 
-    maxsize += sizeof(RLEDestFormat);
+    /*
+     * Blending a translucent run costs less than starting a new one, so
+     * short gaps can be blended too if that leaves them as they are:
+     * opaque pixels, already drawn by the opaque runs, and transparent
+     * pixels, when the destination has no bits besides RGB that blending
+     * would set or clear. Translucent pixels keep only 5 bits of alpha for
+     * 16bpp targets, so there opaque pixels would not come back the same
+     * from SDL_UnRLESurface().
+     */
+    if (SDL_GetHintBoolean(SDL_HINT_RLE_MERGE_RUNS, SDL_TRUE)) {
+        merge_gap = RLE_MERGE_GAP;
+    }
+    merge_opaque = (df->BytesPerPixel == 4);
+    merge_transparent = (df->BytesPerPixel == 2 && masksum == 0xffff);
+
+    maxsize += sizeof(RLEDestFormat) + surface->h * 2 * sizeof(Uint32);
     rlebuf = (Uint8 *)SDL_malloc(maxsize);
     if (!rlebuf) {
         return SDL_OutOfMemory();
@@ -1100,8 +1089,10 @@ static int RLEAlphaSurface(SDL_Surface *surface)
         r->Gshift = df->Gshift;
         r->Bshift = df->Bshift;
         r->Ashift = df->Ashift;
+        r->blend_888 = GetBlendTranslRun888();
     }
-    dst = rlebuf + sizeof(RLEDestFormat);
+    rows = (Uint32 *)(rlebuf + sizeof(RLEDestFormat));
+    dst = (Uint8 *)(rows + surface->h * 2);
 
     /* Do the actual encoding */
     {
@@ -1131,6 +1122,7 @@ static int RLEAlphaSurface(SDL_Surface *surface)
             int runstart, skipstart;
             int blankline = 0;
             /* First encode all opaque pixels of a scan line */
+            rows[2 * y] = (Uint32)(dst - rlebuf);
             x = 0;
             do {
                 int run, skip, len;
@@ -1167,6 +1159,7 @@ static int RLEAlphaSurface(SDL_Surface *surface)
 
             /* Make sure the next output address is 32-bit aligned */
             dst += (uintptr_t)dst & 2;
+            rows[2 * y + 1] = (Uint32)(dst - rlebuf);
 
             /* Next, encode all translucent pixels of the same scan line */
             x = 0;
@@ -1177,8 +1170,22 @@ static int RLEAlphaSurface(SDL_Surface *surface)
                     x++;
                 }
                 runstart = x;
-                while (x < w && ISTRANSL(src[x], sf)) {
-                    x++;
+                for (;;) {
+                    int gap;
+                    while (x < w && ISTRANSL(src[x], sf)) {
+                        x++;
+                    }
+                    /* take in a short gap if another translucent run follows */
+                    gap = x;
+                    while (gap < w && gap - x < merge_gap &&
+                           ((merge_opaque && ISOPAQUE(src[gap], sf)) ||
+                            (merge_transparent && ISTRANSPARENT(src[gap], sf)))) {
+                        gap++;
+                    }
+                    if (gap == x || gap == w || !ISTRANSL(src[gap], sf)) {
+                        break;
+                    }
+                    x = gap;
                 }
                 skip = runstart - skipstart;
                 blankline &= (skip == w);
@@ -1208,6 +1215,11 @@ static int RLEAlphaSurface(SDL_Surface *surface)
         }
         dst = lastline; /* back up past trailing blank lines */
         ADD_OPAQUE_COUNTS(0, 0);
+
+        /* the trailing blank lines start at the end of sequence */
+        for (y = 0; y < 2 * h; y++) {
+            rows[y] = SDL_min(rows[y], (Uint32)(lastline - rlebuf));
+        }
     }
 
 #undef ADD_OPAQUE_COUNTS
@@ -1269,6 +1281,7 @@ static const getpix_func getpixes[4] = {
 static int RLEColorkeySurface(SDL_Surface *surface)
 {
     Uint8 *rlebuf, *dst;
+    Uint32 *rows;
     int maxn;
     int y;
     Uint8 *srcbuf, *lastline;
@@ -1298,6 +1311,7 @@ static int RLEColorkeySurface(SDL_Surface *surface)
     default:
         return -1;
     }
+    maxsize += surface->h * sizeof(Uint32);
 
     rlebuf = (Uint8 *)SDL_malloc(maxsize);
     if (!rlebuf) {
@@ -1307,7 +1321,8 @@ static int RLEColorkeySurface(SDL_Surface *surface)
     /* Set up the conversion */
     srcbuf = (Uint8 *)surface->pixels;
     maxn = bpp == 4 ? 65535 : 255;
-    dst = rlebuf;
+    rows = (Uint32 *)rlebuf;
+    dst = (Uint8 *)(rows + surface->h);
     rgbmask = ~surface->format->Amask;
     ckey = surface->map->info.colorkey & rgbmask;
     lastline = dst;
@@ -1329,6 +1344,7 @@ static int RLEColorkeySurface(SDL_Surface *surface)
     for (y = 0; y < h; y++) {
         int x = 0;
         int blankline = 0;
+        rows[y] = (Uint32)(dst - rlebuf);
         do {
             int run, skip;
             int len;
@@ -1378,6 +1394,11 @@ static int RLEColorkeySurface(SDL_Surface *surface)
     dst = lastline; /* back up bast trailing blank lines */
     ADD_COUNTS(0, 0);
 
+    /* the trailing blank lines start at the end of sequence */
+    for (y = 0; y < h; y++) {
+        rows[y] = SDL_min(rows[y], (Uint32)(lastline - rlebuf));
+    }
+
 #undef ADD_COUNTS
 
     /* Now that we have it encoded, release the original pixels */
@@ -1436,7 +1457,7 @@ int SDL_RLESurface(SDL_Surface *surface)
     /* Pass on combinations not supported */
     if ((flags & SDL_COPY_MODULATE_COLOR) ||
         ((flags & SDL_COPY_MODULATE_ALPHA) && surface->format->Amask) ||
-        (flags & (SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) ||
+        (flags & (SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED)) ||
         (flags & SDL_COPY_NEAREST)) {
         return -1;
     }
@@ -1500,7 +1521,7 @@ static SDL_bool UnRLEAlpha(SDL_Surface *surface)
     SDL_memset(surface->pixels, 0, (size_t)surface->h * surface->pitch);
 
     dst = surface->pixels;
-    srcbuf = (Uint8 *)(df + 1);
+    srcbuf = (Uint8 *)df + *(Uint32 *)(df + 1); /* the first line, after the line table */
     for (;;) {
         /* copy opaque pixels */
         int ofs = 0;
@@ -0,0 +1,57 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * Translucent runs of RLE surfaces with per-pixel alpha, for 32bpp targets,
+ * written with the operations of SDL_blit_simd.h. SDL_RLEaccel.c includes
+ * this once for every instruction set it is built with.
+ *
+ * The results are exactly those of BLIT_TRANSL_888(): every channel becomes
+ * d + ((s - d) * alpha >> 8), rounded down also when the source is darker,
+ * and the top byte is set.
+ */
+
+BLITV_TARGET static void BLITV_NAME(BlendTranslRun888)(Uint32 *dst, const Uint32 *src, unsigned n)
+{
+    const BLITV opaque = BLITV_SPLAT32(0xff000000);
+    const BLITV16 bias = BLITV16_SPLAT(255);
+
+    for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+        const BLITV s = BLITV_LOAD(src);
+        const BLITV d = BLITV_LOAD(dst);
+        BLITV a = BLITV_SRL32(s, 24);
+        BLITV up, down;
+        BLITV16 lo, hi;
+
+        /* The alpha is always in the top byte of the encoded pixel */
+        a = BLITV_OR(a, BLITV_SLL32(a, 8));
+        a = BLITV_OR(a, BLITV_SLL32(a, 16));
+        BLITV_MULW(BLITV_ABSDIFF8(s, d), a, lo, hi);
+        up = BLITV_NARROW(BLITV16_SRL(lo, 8), BLITV16_SRL(hi, 8));
+        down = BLITV_NARROW(BLITV16_SRL(BLITV16_ADD(lo, bias), 8), BLITV16_SRL(BLITV16_ADD(hi, bias), 8));
+        BLITV_STORE(dst, BLITV_OR(BLITV_SELECT(BLITV_GE8(s, d), BLITV_ADD8(d, up), BLITV_SUB8(d, down)), opaque));
+        src += BLITV_PIXELS;
+        dst += BLITV_PIXELS;
+    }
+    BlendTranslRun888(dst, src, n);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
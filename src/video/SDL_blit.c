@@ -28,6 +28,47 @@
 #include "SDL_blit_slow.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_hints.h"
+#include "../thread/SDL_jobs_c.h"
+
+typedef struct
+{
+    SDL_BlitFunc func;
+    const SDL_BlitInfo *info;
+} SDL_BlitBands;
+
+/* Runs the blit on rows [start, end) */
+static void SDL_BlitBand(void *userdata, int start, int end)
+{
+    const SDL_BlitBands *bands = (const SDL_BlitBands *)userdata;
+    SDL_BlitInfo info = *bands->info;
+
+    info.src += (size_t)start * info.src_pitch;
+    info.dst += (size_t)start * info.dst_pitch;
+    info.src_h = end - start;
+    info.dst_h = end - start;
+    bands->func(&info);
+}
+
+/* Bands can only run in any order if the blit doesn't read what it writes */
+static SDL_bool SDL_BlitOverlaps(const SDL_BlitInfo *info)
+{
+    const Uint8 *src_end = info->src + (size_t)(info->src_h - 1) * info->src_pitch + (size_t)info->src_w * info->src_fmt->BytesPerPixel;
+    const Uint8 *dst_end = info->dst + (size_t)(info->dst_h - 1) * info->dst_pitch + (size_t)info->dst_w * info->dst_fmt->BytesPerPixel;
+
+    return (info->src < dst_end && info->dst < src_end) ? SDL_TRUE : SDL_FALSE;
+}
+
+int SDL_GetBlitBandRows(int w, int h)
+{
+    if (w <= 0 || (Sint64)w * h < SDL_BLIT_BANDS_MIN_PIXELS) {
+        return 0;
+    }
+    if (!SDL_GetHintBoolean(SDL_HINT_BLIT_THREADS, SDL_FALSE)) {
+        return 0;
+    }
+    return SDL_max(SDL_BLIT_BAND_PIXELS / w, 1);
+}
 
 /* The general purpose software blit routine */
 static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
@@ -63,6 +104,7 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
     if (okay && !SDL_RectEmpty(srcrect)) {
         SDL_BlitFunc RunBlit;
         SDL_BlitInfo *info = &src->map->info;
+        int band_rows;
 
         /* Set up the blit information */
         info->src = (Uint8 *)src->pixels +
@@ -83,8 +125,21 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
             info->dst_pitch - info->dst_w * info->dst_fmt->BytesPerPixel;
         RunBlit = (SDL_BlitFunc)src->map->data;
 
-        /* Run the actual software blit */
-        RunBlit(info);
+        /* Run the actual software blit, in bands of rows if it's big enough.
+           Scaled blits step through the source from the top, so they aren't split. */
+        band_rows = 0;
+        if (info->src_w == info->dst_w && info->src_h == info->dst_h && !SDL_BlitOverlaps(info)) {
+            band_rows = SDL_GetBlitBandRows(info->dst_w, info->dst_h);
+        }
+        if (band_rows > 0 && band_rows < info->dst_h) {
+            SDL_BlitBands bands;
+
+            bands.func = RunBlit;
+            bands.info = info;
+            SDL_RunJobs(SDL_JOB_KERNEL_BLIT_ROWS, SDL_BlitBand, &bands, info->dst_h, band_rows);
+        } else {
+            RunBlit(info);
+        }
     }
 
     /* We need to unlock the surfaces if they're locked */
@@ -98,8 +153,6 @@ static int SDLCALL SDL_SoftBlit(SDL_Surface *src, SDL_Rect *srcrect,
     return okay ? 0 : -1;
 }
 
-#if SDL_HAVE_BLIT_AUTO
-
 #ifdef __MACOSX__
 #include <sys/sysctl.h>
 
@@ -123,43 +176,62 @@ static SDL_bool SDL_UseAltivecPrefetch(void)
 }
 #endif /* __MACOSX__ */
 
-static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
-                                       SDL_BlitFuncEntry *entries)
+int SDL_GetBlitCPUFeatures(void)
 {
-    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
-    static int features = 0x7fffffff;
+    static int cpu_features = 0x7fffffff;
+    const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    int features;
 
     /* Get the available CPU features */
-    if (features == 0x7fffffff) {
-        const char *override = SDL_getenv("SDL_BLIT_CPU_FEATURES");
-
-        features = SDL_CPU_ANY;
-
-        /* Allow an override for testing .. */
-        if (override) {
-            (void)SDL_sscanf(override, "%u", &features);
-        } else {
-            if (SDL_HasMMX()) {
-                features |= SDL_CPU_MMX;
-            }
-            if (SDL_Has3DNow()) {
-                features |= SDL_CPU_3DNOW;
-            }
-            if (SDL_HasSSE()) {
-                features |= SDL_CPU_SSE;
-            }
-            if (SDL_HasSSE2()) {
-                features |= SDL_CPU_SSE2;
-            }
-            if (SDL_HasAltiVec()) {
-                if (SDL_UseAltivecPrefetch()) {
-                    features |= SDL_CPU_ALTIVEC_PREFETCH;
-                } else {
-                    features |= SDL_CPU_ALTIVEC_NOPREFETCH;
-                }
+    if (cpu_features == 0x7fffffff) {
+        cpu_features = SDL_CPU_ANY;
+        if (SDL_HasMMX()) {
+            cpu_features |= SDL_CPU_MMX;
+        }
+        if (SDL_Has3DNow()) {
+            cpu_features |= SDL_CPU_3DNOW;
+        }
+        if (SDL_HasSSE()) {
+            cpu_features |= SDL_CPU_SSE;
+        }
+        if (SDL_HasSSE2()) {
+            cpu_features |= SDL_CPU_SSE2;
+        }
+        if (SDL_HasAVX2()) {
+            cpu_features |= SDL_CPU_AVX2;
+        }
+        if (SDL_HasNEON()) {
+            cpu_features |= SDL_CPU_NEON;
+        }
+        if (SDL_HasAltiVec()) {
+            cpu_features |= SDL_CPU_ALTIVEC;
+            if (SDL_UseAltivecPrefetch()) {
+                cpu_features |= SDL_CPU_ALTIVEC_PREFETCH;
+            } else {
+                cpu_features |= SDL_CPU_ALTIVEC_NOPREFETCH;
             }
         }
     }
+    features = cpu_features;
+
+    /* Allow an override for testing .. it's read every time, so tests can compare the blitters,
+       and an empty value, which is how tests put back an unset variable, doesn't override anything */
+    if (override && *override) {
+        int enabled = 0;
+
+        (void)SDL_sscanf(override, "%u", &enabled);
+        features &= enabled;
+    }
+    return features;
+}
+
+#if SDL_HAVE_BLIT_AUTO
+
+static SDL_BlitFunc SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
+                                       SDL_BlitFuncEntry *entries)
+{
+    int i, flagcheck = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_COLORKEY | SDL_COPY_NEAREST));
+    const int features = SDL_GetBlitCPUFeatures();
 
     for (i = 0; entries[i].func; ++i) {
         /* Check for matching pixel formats */
@@ -241,7 +313,7 @@ int SDL_CalculateBlit(SDL_Surface *surface)
     }
 #endif
 #if SDL_HAVE_BLIT_A
-    else if (map->info.flags & SDL_COPY_BLEND) {
+    else if (map->info.flags & (SDL_COPY_BLEND | SDL_COPY_BLEND_PREMULTIPLIED)) {
         blit = SDL_CalculateBlitA(surface);
     }
 #endif
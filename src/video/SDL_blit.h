@@ -45,6 +45,7 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_COPY_MUL            0x00000080
 #define SDL_COPY_COLORKEY       0x00000100
 #define SDL_COPY_NEAREST        0x00000200
+#define SDL_COPY_BLEND_PREMULTIPLIED 0x00000400
 #define SDL_COPY_RLE_DESIRED    0x00001000
 #define SDL_COPY_RLE_COLORKEY   0x00002000
 #define SDL_COPY_RLE_ALPHAKEY   0x00004000
@@ -58,6 +59,9 @@ extern Uint8 *SDL_expand_byte[9];
 #define SDL_CPU_SSE2               0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH   0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH 0x00000020
+#define SDL_CPU_AVX2               0x00000040
+#define SDL_CPU_NEON               0x00000080
+#define SDL_CPU_ALTIVEC            0x00000100
 
 typedef struct
 {
@@ -88,6 +92,29 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* A blit set up by SDL_MapSurface(), and what it was set up for. The formats
+   and palettes are referenced, so they can't be replaced by others at the
+   same address while the blit is kept. */
+typedef struct
+{
+    SDL_PixelFormat *dst_fmt;
+    SDL_Palette *src_palette;
+    Uint32 src_palette_version;
+    SDL_Palette *dst_palette;
+    Uint32 dst_palette_version;
+    int flags;
+    Uint8 r, g, b, a;
+    Uint32 last_used;
+
+    int identity;
+    Uint8 *table;
+    SDL_blit blit;
+    void *data;
+} SDL_BlitMapEntry;
+
+/* The number of blits SDL_InvalidateMap() keeps for SDL_MapSurface() to reuse */
+#define SDL_BLITMAP_CACHE_SIZE 4
+
 /* Blit mapping definition */
 /* typedef'ed in SDL_surface.h */
 struct SDL_BlitMap
@@ -102,11 +129,45 @@ struct SDL_BlitMap
        an invalid mapping */
     Uint32 dst_palette_version;
     Uint32 src_palette_version;
+
+    /* Scratch rows for blits with bilinear scaling, see SDL_PrivateBlitScaledLinearRows() */
+    SDL_Surface *scaled_rows;
+
+    /* The source converted for bilinear scaling, see SDL_PrivateLowerBlitScaled() */
+    SDL_Surface *scaled_source;
+
+    /* What the current blit was set up for, and the blits set up before it for
+       other destination formats, palettes or flags. Maps on the stack have no
+       cache, see SDL_AllocBlitMap(). */
+    SDL_bool cached;
+    SDL_BlitMapEntry current;
+    SDL_BlitMapEntry cache[SDL_BLITMAP_CACHE_SIZE];
+    Uint32 cache_clock;
 };
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface *surface);
 
+/* Returns the SDL_CPU_* features the blitters may use, less those masked off by SDL_BLIT_CPU_FEATURES */
+extern int SDL_GetBlitCPUFeatures(void);
+
+/* With SDL_HINT_BLIT_THREADS, operations on at least this many pixels are split
+   into bands of rows, each about SDL_BLIT_BAND_PIXELS big, that run on the job pool */
+#define SDL_BLIT_BANDS_MIN_PIXELS (256 * 1024)
+#define SDL_BLIT_BAND_PIXELS      (64 * 1024)
+
+/* Returns the number of rows in each band of a w x h operation, or 0 to run it on the calling thread */
+extern int SDL_GetBlitBandRows(int w, int h);
+
+/* Functions found in SDL_stretch.c */
+typedef Uint32 *(*SDL_StretchRowFunc)(void *userdata, int y, Uint32 *row);
+
+/* Scales 'srcrect' of a 32-bit surface to dst_w x dst_h pixels with bilinear filtering,
+   one row at a time. The first row is written to 'row', which holds dst_w pixels. Each
+   finished row is passed to 'row_func', which returns where to write the next one. */
+extern int SDL_SoftStretchLinearRows(SDL_Surface *src, const SDL_Rect *srcrect, int dst_w, int dst_h,
+                                     Uint32 *row, SDL_StretchRowFunc row_func, void *row_data);
+
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface *surface);
 extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface *surface);
@@ -465,6 +526,25 @@ extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface);
         dA = (Uint8)((int)sA + dA - ((int)sA * dA) / 255);     \
     } while (0)
 
+/* Blend the RGBA values of two pixels, the source color is premultiplied by its alpha */
+#define PREMULTIPLIED_ALPHA_BLEND_RGBA(sR, sG, sB, sA, dR, dG, dB, dA) \
+    do {                                                               \
+        const unsigned inva = 255 - (unsigned)sA;                      \
+        dR = sR + (dR * inva) / 255;                                   \
+        if (dR > 255) {                                                \
+            dR = 255;                                                  \
+        }                                                              \
+        dG = sG + (dG * inva) / 255;                                   \
+        if (dG > 255) {                                                \
+            dG = 255;                                                  \
+        }                                                              \
+        dB = sB + (dB * inva) / 255;                                   \
+        if (dB > 255) {                                                \
+            dB = 255;                                                  \
+        }                                                              \
+        dA = sA + (dA * inva) / 255;                                   \
+    } while (0)
+
 /* This is a very useful loop for optimizing blitters */
 #if defined(_MSC_VER) && (_MSC_VER == 1300)
 /* There's a bug in the Visual C++ 7 optimizer when compiling this code */
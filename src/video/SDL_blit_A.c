@@ -1417,10 +1417,183 @@ static void BlitNtoNPixelAlpha(SDL_BlitInfo *info)
     }
 }
 
+/* General (slow) N->N blending with premultiplied pixel alpha */
+static void BlitNtoNPixelAlphaPremultiplied(SDL_BlitInfo *info)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    SDL_PixelFormat *srcfmt = info->src_fmt;
+    SDL_PixelFormat *dstfmt = info->dst_fmt;
+    int srcbpp;
+    int dstbpp;
+    Uint32 Pixel;
+    unsigned sR, sG, sB, sA;
+    unsigned dR, dG, dB, dA;
+
+    /* Set up some basic variables */
+    srcbpp = srcfmt->BytesPerPixel;
+    dstbpp = dstfmt->BytesPerPixel;
+
+    while (height--) {
+        /* *INDENT-OFF* */ /* clang-format off */
+        DUFFS_LOOP4(
+        {
+        DISEMBLE_RGBA(src, srcbpp, srcfmt, Pixel, sR, sG, sB, sA);
+        DISEMBLE_RGBA(dst, dstbpp, dstfmt, Pixel, dR, dG, dB, dA);
+        PREMULTIPLIED_ALPHA_BLEND_RGBA(sR, sG, sB, sA, dR, dG, dB, dA);
+        ASSEMBLE_RGBA(dst, dstbpp, dstfmt, dR, dG, dB, dA);
+        src += srcbpp;
+        dst += dstbpp;
+        },
+        width);
+        /* *INDENT-ON* */ /* clang-format on */
+        src += srcskip;
+        dst += dstskip;
+    }
+}
+
+/* Blitters built for every instruction set from SDL_blit_A_simd.h */
+enum
+{
+    ALPHA_BLIT_PIXEL,
+    ALPHA_BLIT_SURFACE,
+    ALPHA_BLIT_SURFACE_KEY,
+    ALPHA_BLIT_RGB_PIXEL,
+    ALPHA_BLIT_RGB_SURFACE,
+    ALPHA_BLIT_PREMULTIPLIED
+};
+
+typedef struct
+{
+    Uint32 src_amask; /* source alpha, for per-pixel alpha */
+    Uint32 dst_amask; /* destination byte that gets the blended alpha */
+    Uint32 dst_zmask; /* destination bytes that are written as zero */
+    Uint32 colorkey;
+    Uint8 alpha;
+} AlphaBlitParams;
+
+typedef struct
+{
+    SDL_BlitFunc BlitNtoNPixelAlpha;
+    SDL_BlitFunc BlitNtoNSurfaceAlpha;
+    SDL_BlitFunc BlitNtoNSurfaceAlphaKey;
+    SDL_BlitFunc BlitRGBtoRGBPixelAlpha;
+    SDL_BlitFunc BlitRGBtoRGBSurfaceAlpha;
+    SDL_BlitFunc BlitNtoNPixelAlphaPremultiplied;
+} AlphaBlitSIMD;
+
+static void GetAlphaBlitParams(const SDL_BlitInfo *info, int mode, AlphaBlitParams *params)
+{
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+
+    if (mode == ALPHA_BLIT_RGB_PIXEL || mode == ALPHA_BLIT_RGB_SURFACE) {
+        /* These always write the top byte, like BlitRGBtoRGBPixelAlpha() */
+        params->src_amask = 0xff000000;
+        params->dst_amask = 0xff000000;
+        params->dst_zmask = 0;
+    } else {
+        params->src_amask = srcfmt->Amask;
+        params->dst_amask = dstfmt->Amask;
+        params->dst_zmask = ~(dstfmt->Rmask | dstfmt->Gmask | dstfmt->Bmask | dstfmt->Amask);
+    }
+    params->colorkey = info->colorkey;
+    params->alpha = info->a;
+}
+
+#if defined(__SSE2__)
+#define BLITV_SSE2
+#include "SDL_blit_simd.h"
+#include "SDL_blit_A_simd.h"
+#undef BLITV_SSE2
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+#define BLITV_AVX2
+#include "SDL_blit_simd.h"
+#include "SDL_blit_A_simd.h"
+#undef BLITV_AVX2
+#endif
+#if defined(__ARM_NEON)
+#define BLITV_NEON
+#include "SDL_blit_simd.h"
+#include "SDL_blit_A_simd.h"
+#undef BLITV_NEON
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define BLITV_ALTIVEC
+#include "SDL_blit_simd.h"
+#include "SDL_blit_A_simd.h"
+#undef BLITV_ALTIVEC
+#endif
+
+enum
+{
+    ALPHA_BLIT_FEATURE_ARCH = 1, /* MMX, 3DNow! and ARM assembly blitters */
+    ALPHA_BLIT_FEATURE_SIMD = 2  /* blitters from SDL_blit_A_simd.h */
+};
+
+static int GetAlphaBlitFeatures(void)
+{
+    /* Provide an override for testing .. */
+    const char *override = SDL_getenv("SDL_ALPHA_BLIT_FEATURES");
+    if (override) {
+        return SDL_atoi(override);
+    }
+    return ALPHA_BLIT_FEATURE_ARCH | ALPHA_BLIT_FEATURE_SIMD;
+}
+
+static const AlphaBlitSIMD *GetAlphaBlitSIMD(int features)
+{
+    if (!(features & ALPHA_BLIT_FEATURE_SIMD)) {
+        return NULL;
+    }
+#if defined(SDL_AVX2_INTRINSICS)
+    if (SDL_HasAVX2()) {
+        return &AlphaBlitSIMD_AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (SDL_HasSSE2()) {
+        return &AlphaBlitSIMD_SSE2;
+    }
+#endif
+#if defined(__ARM_NEON)
+    if (SDL_HasNEON()) {
+        return &AlphaBlitSIMD_NEON;
+    }
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (SDL_HasAltiVec()) {
+        return &AlphaBlitSIMD_AltiVec;
+    }
+#endif
+    return NULL;
+}
+
+/* 32-bit formats with 8-bit channels in the same place, which the vector blitters handle */
+static SDL_bool IsByteMask(Uint32 mask)
+{
+    return mask == 0xff || mask == 0xff00 || mask == 0xff0000 || mask == 0xff000000;
+}
+
+static SDL_bool CanBlendBytes(const SDL_PixelFormat *sf, const SDL_PixelFormat *df)
+{
+    return sf->BytesPerPixel == 4 && df->BytesPerPixel == 4 &&
+           sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask &&
+           IsByteMask(df->Rmask) && IsByteMask(df->Gmask) && IsByteMask(df->Bmask) &&
+           (!df->Amask || IsByteMask(df->Amask));
+}
+
 SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 {
     SDL_PixelFormat *sf = surface->format;
     SDL_PixelFormat *df = surface->map->dst->format;
+    const int features = GetAlphaBlitFeatures();
+    const AlphaBlitSIMD *simd = GetAlphaBlitSIMD(features);
 
     switch (surface->map->info.flags & ~SDL_COPY_RLE_MASK) {
     case SDL_COPY_BLEND:
@@ -1436,7 +1609,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 
         case 2:
 #if defined(SDL_ARM_NEON_BLITTERS) || defined(SDL_ARM_SIMD_BLITTERS)
-            if (sf->BytesPerPixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && df->Gmask == 0x7e0 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
+            if ((features & ALPHA_BLIT_FEATURE_ARCH) && sf->BytesPerPixel == 4 && sf->Amask == 0xff000000 && sf->Gmask == 0xff00 && df->Gmask == 0x7e0 && ((sf->Rmask == 0xff && df->Rmask == 0x1f) || (sf->Bmask == 0xff && df->Bmask == 0x1f))) {
 #ifdef SDL_ARM_NEON_BLITTERS
                 if (SDL_HasNEON()) {
                     return BlitARGBto565PixelAlphaARMNEON;
@@ -1461,7 +1634,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
         case 4:
             if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
 #if defined(__MMX__) || defined(__3dNOW__)
-                if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
+                if ((features & ALPHA_BLIT_FEATURE_ARCH) && sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && sf->Ashift % 8 == 0 && sf->Aloss == 0) {
 #ifdef __3dNOW__
                     if (SDL_Has3DNow()) {
                         return BlitRGBtoRGBPixelAlphaMMX3DNOW;
@@ -1476,17 +1649,23 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
 #endif /* __MMX__ || __3dNOW__ */
                 if (sf->Amask == 0xff000000) {
 #ifdef SDL_ARM_NEON_BLITTERS
-                    if (SDL_HasNEON()) {
+                    if ((features & ALPHA_BLIT_FEATURE_ARCH) && SDL_HasNEON()) {
                         return BlitRGBtoRGBPixelAlphaARMNEON;
                     }
 #endif
 #ifdef SDL_ARM_SIMD_BLITTERS
-                    if (SDL_HasARMSIMD()) {
+                    if ((features & ALPHA_BLIT_FEATURE_ARCH) && SDL_HasARMSIMD()) {
                         return BlitRGBtoRGBPixelAlphaARMSIMD;
                     }
 #endif
+                    if (simd && CanBlendBytes(sf, df)) {
+                        return simd->BlitRGBtoRGBPixelAlpha;
+                    }
                     return BlitRGBtoRGBPixelAlpha;
                 }
+                if (simd && IsByteMask(sf->Amask) && CanBlendBytes(sf, df)) {
+                    return simd->BlitNtoNPixelAlpha;
+                }
             } else if (sf->Rmask == df->Bmask && sf->Gmask == df->Gmask && sf->Bmask == df->Rmask && sf->BytesPerPixel == 4) {
                 if (sf->Amask == 0xff000000) {
                     return BlitRGBtoBGRPixelAlpha;
@@ -1516,7 +1695,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                 if (surface->map->identity) {
                     if (df->Gmask == 0x7e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX()) {
+                        if ((features & ALPHA_BLIT_FEATURE_ARCH) && SDL_HasMMX()) {
                             return Blit565to565SurfaceAlphaMMX;
                         } else
 #endif
@@ -1525,7 +1704,7 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                         }
                     } else if (df->Gmask == 0x3e0) {
 #ifdef __MMX__
-                        if (SDL_HasMMX()) {
+                        if ((features & ALPHA_BLIT_FEATURE_ARCH) && SDL_HasMMX()) {
                             return Blit555to555SurfaceAlphaMMX;
                         } else
 #endif
@@ -1539,13 +1718,19 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
             case 4:
                 if (sf->Rmask == df->Rmask && sf->Gmask == df->Gmask && sf->Bmask == df->Bmask && sf->BytesPerPixel == 4) {
 #ifdef __MMX__
-                    if (sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
+                    if ((features & ALPHA_BLIT_FEATURE_ARCH) && sf->Rshift % 8 == 0 && sf->Gshift % 8 == 0 && sf->Bshift % 8 == 0 && SDL_HasMMX()) {
                         return BlitRGBtoRGBSurfaceAlphaMMX;
                     }
 #endif
                     if ((sf->Rmask | sf->Gmask | sf->Bmask) == 0xffffff) {
+                        if (simd && CanBlendBytes(sf, df)) {
+                            return simd->BlitRGBtoRGBSurfaceAlpha;
+                        }
                         return BlitRGBtoRGBSurfaceAlpha;
                     }
+                    if (simd && CanBlendBytes(sf, df)) {
+                        return simd->BlitNtoNSurfaceAlpha;
+                    }
                 }
                 return BlitNtoNSurfaceAlpha;
 
@@ -1566,11 +1751,23 @@ SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface *surface)
                     /* RGB332 has no palette ! */
                     return BlitNtoNSurfaceAlphaKey;
                 }
+            } else if (simd && CanBlendBytes(sf, df)) {
+                return simd->BlitNtoNSurfaceAlphaKey;
             } else {
                 return BlitNtoNSurfaceAlphaKey;
             }
         }
         break;
+
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        /* Per-pixel alpha blits, the source color is already multiplied by its alpha */
+        if (sf->Amask && !SDL_ISPIXELFORMAT_INDEXED(df->format)) {
+            if (simd && IsByteMask(sf->Amask) && CanBlendBytes(sf, df)) {
+                return simd->BlitNtoNPixelAlphaPremultiplied;
+            }
+            return BlitNtoNPixelAlphaPremultiplied;
+        }
+        break;
     }
 
     return NULL;
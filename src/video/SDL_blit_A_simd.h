@@ -0,0 +1,200 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * Alpha blending blitters for 32-bit pixels with 8-bit channels, written
+ * with the operations of SDL_blit_simd.h. SDL_blit_A.c includes this once
+ * for every instruction set it is built with.
+ *
+ * The results are exactly those of the scalar blitters they replace:
+ * ALPHA_BLEND_RGBA() for the general ones, PREMULTIPLIED_ALPHA_BLEND_RGBA()
+ * for the premultiplied one, and the shift by 8 of BlitRGBtoRGBPixelAlpha()
+ * and BlitRGBtoRGBSurfaceAlpha() for those.
+ */
+
+/* (a * b + bias) >> 8 for every byte */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(MulShr8)(BLITV a, BLITV b, Uint16 bias)
+{
+    const BLITV16 b16 = BLITV16_SPLAT(bias);
+    BLITV16 lo, hi;
+
+    BLITV_MULW(a, b, lo, hi);
+    lo = BLITV16_SRL(BLITV16_ADD(lo, b16), 8);
+    hi = BLITV16_SRL(BLITV16_ADD(hi, b16), 8);
+    return BLITV_NARROW(lo, hi);
+}
+
+/* Copies the alpha byte of every pixel to its other bytes */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SpreadAlpha)(BLITV alpha)
+{
+    alpha = BLITV_OR(alpha, BLITV_OR(BLITV_SRL32(alpha, 8), BLITV_SLL32(alpha, 8)));
+    return BLITV_OR(alpha, BLITV_OR(BLITV_SRL32(alpha, 16), BLITV_SLL32(alpha, 16)));
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(BlendPixels)(BLITV s, BLITV d, const AlphaBlitParams *params, const BLITV *k, int mode)
+{
+    const BLITV zero = BLITV_SPLAT32(0);
+    BLITV a, sa, q, out;
+
+    if (mode == ALPHA_BLIT_PREMULTIPLIED) {
+        /* s + d * (255 - sA) / 255 for every byte, the alpha included, saturated */
+        a = BLITV_NAME(SpreadAlpha)(BLITV_AND(s, k[0]));
+        q = BLITV_MULDIV255(d, BLITV_SUB8(BLITV_SPLAT32(0xFFFFFFFF), a));
+        return BLITV_ANDNOT(BLITV_ADDS8(s, q), k[2]);
+    }
+
+    if (mode == ALPHA_BLIT_PIXEL || mode == ALPHA_BLIT_RGB_PIXEL) {
+        sa = BLITV_AND(s, k[0]);
+        a = BLITV_NAME(SpreadAlpha)(sa);
+    } else {
+        sa = zero;
+        a = BLITV_SPLAT32((Uint32)params->alpha * 0x01010101);
+    }
+
+    if (mode == ALPHA_BLIT_RGB_PIXEL || mode == ALPHA_BLIT_RGB_SURFACE) {
+        /* d + ((s - d) * a >> 8), rounding down also when s < d */
+        const BLITV diff = BLITV_ABSDIFF8(s, d);
+
+        out = BLITV_SELECT(BLITV_GE8(s, d),
+                           BLITV_ADD8(d, BLITV_NAME(MulShr8)(diff, a, 0)),
+                           BLITV_SUB8(d, BLITV_NAME(MulShr8)(diff, a, 255)));
+        if (mode == ALPHA_BLIT_RGB_PIXEL) {
+            /* dalpha = alpha + (dalpha * (alpha ^ 0xFF) >> 8) */
+            q = BLITV_ADD8(a, BLITV_NAME(MulShr8)(d, BLITV_SUB8(BLITV_SPLAT32(0xFFFFFFFF), a), 0));
+            out = BLITV_SELECT(k[1], q, out);
+            out = BLITV_SELECT(BLITV_CMPEQ32(sa, k[0]), s, out);
+        } else {
+            out = BLITV_OR(out, k[1]);
+        }
+    } else {
+        /* ALPHA_BLEND_RGBA(), the alpha byte is blended separately */
+        q = BLITV_MULDIV255(BLITV_ABSDIFF8(s, d), a);
+        out = BLITV_SELECT(BLITV_GE8(s, d), BLITV_ADD8(d, q), BLITV_SUB8(d, q));
+        q = BLITV_SUB8(BLITV_ADD8(a, d), BLITV_MULDIV255(a, d));
+        out = BLITV_ANDNOT(BLITV_SELECT(k[1], q, out), k[2]);
+        if (mode == ALPHA_BLIT_SURFACE_KEY) {
+            out = BLITV_SELECT(BLITV_CMPEQ32(s, k[3]), d, out);
+        }
+    }
+
+    if (mode == ALPHA_BLIT_PIXEL || mode == ALPHA_BLIT_RGB_PIXEL) {
+        /* Transparent pixels are left alone */
+        out = BLITV_SELECT(BLITV_CMPEQ32(sa, zero), d, out);
+    }
+    return out;
+}
+
+BLITV_TARGET SDL_FORCE_INLINE void BLITV_NAME(BlitAlpha)(SDL_BlitInfo *info, int mode)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    AlphaBlitParams params;
+    BLITV k[4];
+
+    GetAlphaBlitParams(info, mode, &params);
+    k[0] = BLITV_SPLAT32(params.src_amask);
+    k[1] = BLITV_SPLAT32(params.dst_amask);
+    k[2] = BLITV_SPLAT32(params.dst_zmask);
+    k[3] = BLITV_SPLAT32(params.colorkey);
+
+    while (height--) {
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint32 *dstp = (Uint32 *)dst;
+        int n;
+
+        if (BLITV_ALIGNED(srcp) && BLITV_ALIGNED(dstp)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (n = width; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dstp, BLITV_NAME(BlendPixels)(BLITV_LOADA(srcp), BLITV_LOADA(dstp), &params, k, mode));
+                srcp += BLITV_PIXELS;
+                dstp += BLITV_PIXELS;
+            }
+        } else {
+            for (n = width; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dstp, BLITV_NAME(BlendPixels)(BLITV_LOAD(srcp), BLITV_LOAD(dstp), &params, k, mode));
+                srcp += BLITV_PIXELS;
+                dstp += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* Blend the last few pixels through a full vector */
+            Uint32 s[BLITV_PIXELS], d[BLITV_PIXELS];
+
+            SDL_zeroa(s);
+            SDL_zeroa(d);
+            SDL_memcpy(s, srcp, n * sizeof(Uint32));
+            SDL_memcpy(d, dstp, n * sizeof(Uint32));
+            BLITV_STORE(d, BLITV_NAME(BlendPixels)(BLITV_LOAD(s), BLITV_LOAD(d), &params, k, mode));
+            SDL_memcpy(dstp, d, n * sizeof(Uint32));
+        }
+        src += width * 4 + srcskip;
+        dst += width * 4 + dstskip;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitNtoNPixelAlpha)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_PIXEL);
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitNtoNSurfaceAlpha)(SDL_BlitInfo *info)
+{
+    if (info->a) {
+        BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_SURFACE);
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitNtoNSurfaceAlphaKey)(SDL_BlitInfo *info)
+{
+    if (info->a) {
+        BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_SURFACE_KEY);
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitRGBtoRGBPixelAlpha)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_RGB_PIXEL);
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitRGBtoRGBSurfaceAlpha)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_RGB_SURFACE);
+}
+
+BLITV_TARGET static void BLITV_NAME(BlitNtoNPixelAlphaPremultiplied)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitAlpha)(info, ALPHA_BLIT_PREMULTIPLIED);
+}
+
+static const AlphaBlitSIMD BLITV_NAME(AlphaBlitSIMD) = {
+    BLITV_NAME(BlitNtoNPixelAlpha),
+    BLITV_NAME(BlitNtoNSurfaceAlpha),
+    BLITV_NAME(BlitNtoNSurfaceAlphaKey),
+    BLITV_NAME(BlitRGBtoRGBPixelAlpha),
+    BLITV_NAME(BlitRGBtoRGBSurfaceAlpha),
+    BLITV_NAME(BlitNtoNPixelAlphaPremultiplied)
+};
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -3202,6 +3202,125 @@ static void Blit_3or4_to_3or4__inversed_rgb(SDL_BlitInfo *info)
     }
 }
 
+/* Blitters built for every instruction set from SDL_blit_N_simd.h */
+typedef struct
+{
+    int order[4]; /* source byte of each destination byte in memory, or -1 */
+    Uint32 fill;  /* alpha for destinations with alpha and sources without */
+    Uint32 keep;  /* destination bits that are left alone */
+} ShuffleBlitParams;
+
+typedef struct
+{
+    SDL_BlitFunc Blit8888to8888Shuffle;
+    SDL_BlitFunc Blit8888to8888ShuffleKeepUnused;
+} ShuffleBlitSIMD;
+
+static SDL_bool IsByteMask(Uint32 mask)
+{
+    return mask == 0xff || mask == 0xff00 || mask == 0xff0000 || mask == 0xff000000;
+}
+
+/* The byte in memory that a channel with a byte mask is stored in */
+static int GetByteIndex(Uint32 mask)
+{
+    int i = 0;
+
+    while (mask > 0xff) {
+        mask >>= 8;
+        ++i;
+    }
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+    return i;
+#else
+    return 3 - i;
+#endif
+}
+
+static SDL_bool CanShuffleBytes(const SDL_PixelFormat *srcfmt, const SDL_PixelFormat *dstfmt)
+{
+    return srcfmt->BytesPerPixel == 4 && dstfmt->BytesPerPixel == 4 &&
+           IsByteMask(srcfmt->Rmask) && IsByteMask(srcfmt->Gmask) && IsByteMask(srcfmt->Bmask) &&
+           (!srcfmt->Amask || IsByteMask(srcfmt->Amask)) &&
+           IsByteMask(dstfmt->Rmask) && IsByteMask(dstfmt->Gmask) && IsByteMask(dstfmt->Bmask) &&
+           (!dstfmt->Amask || IsByteMask(dstfmt->Amask));
+}
+
+/* Same results as BlitNtoN() and BlitNtoNCopyAlpha(), or as
+   Blit_3or4_to_3or4__inversed_rgb() when the unused byte is kept */
+static void GetShuffleBlitParams(const SDL_BlitInfo *info, SDL_bool keep_unused, ShuffleBlitParams *params)
+{
+    const SDL_PixelFormat *srcfmt = info->src_fmt;
+    const SDL_PixelFormat *dstfmt = info->dst_fmt;
+
+    params->order[0] = params->order[1] = params->order[2] = params->order[3] = -1;
+    params->order[GetByteIndex(dstfmt->Rmask)] = GetByteIndex(srcfmt->Rmask);
+    params->order[GetByteIndex(dstfmt->Gmask)] = GetByteIndex(srcfmt->Gmask);
+    params->order[GetByteIndex(dstfmt->Bmask)] = GetByteIndex(srcfmt->Bmask);
+    params->fill = 0;
+    params->keep = 0;
+    if (keep_unused && !dstfmt->Amask) {
+        params->keep = ~(dstfmt->Rmask | dstfmt->Gmask | dstfmt->Bmask);
+    }
+    if (dstfmt->Amask) {
+        if (srcfmt->Amask) {
+            params->order[GetByteIndex(dstfmt->Amask)] = GetByteIndex(srcfmt->Amask);
+        } else {
+            params->fill = (Uint32)info->a << dstfmt->Ashift;
+        }
+    }
+}
+
+#if defined(__SSE2__)
+#define BLITV_SSE2
+#include "SDL_blit_simd.h"
+#include "SDL_blit_N_simd.h"
+#undef BLITV_SSE2
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+#define BLITV_AVX2
+#include "SDL_blit_simd.h"
+#include "SDL_blit_N_simd.h"
+#undef BLITV_AVX2
+#endif
+#if defined(__ARM_NEON)
+#define BLITV_NEON
+#include "SDL_blit_simd.h"
+#include "SDL_blit_N_simd.h"
+#undef BLITV_NEON
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define BLITV_ALTIVEC
+#include "SDL_blit_simd.h"
+#include "SDL_blit_N_simd.h"
+#undef BLITV_ALTIVEC
+#endif
+
+static const ShuffleBlitSIMD *GetShuffleBlitSIMD(int features)
+{
+#if defined(SDL_AVX2_INTRINSICS)
+    if (features & SDL_CPU_AVX2) {
+        return &ShuffleBlitSIMD_AVX2;
+    }
+#endif
+#if defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        return &ShuffleBlitSIMD_SSE2;
+    }
+#endif
+#if defined(__ARM_NEON)
+    if (features & SDL_CPU_NEON) {
+        return &ShuffleBlitSIMD_NEON;
+    }
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (features & SDL_CPU_ALTIVEC) {
+        return &ShuffleBlitSIMD_AltiVec;
+    }
+#endif
+    return NULL;
+}
+
 /* Normal N to N optimized blitters */
 #define NO_ALPHA   1
 #define SET_ALPHA  2
@@ -3424,6 +3543,19 @@ SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface *surface)
                     blitfun = BlitNtoNCopyAlpha;
                 }
             }
+
+            /* Other than straight copies and the platform specific blitters above,
+               32-bit pixels with 8-bit channels are rearranged with a byte shuffle */
+            if (blitfun != SDL_BlitCopy && !table[which].blit_features && CanShuffleBytes(srcfmt, dstfmt)) {
+                const ShuffleBlitSIMD *shuffle = GetShuffleBlitSIMD(SDL_GetBlitCPUFeatures());
+                if (shuffle) {
+                    if (blitfun == Blit_3or4_to_3or4__inversed_rgb) {
+                        blitfun = shuffle->Blit8888to8888ShuffleKeepUnused;
+                    } else {
+                        blitfun = shuffle->Blit8888to8888Shuffle;
+                    }
+                }
+            }
         }
         return blitfun;
 
@@ -0,0 +1,113 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * Conversion between any two 32-bit formats with 8-bit channels, written
+ * with the operations of SDL_blit_simd.h. SDL_blit_N.c includes this once
+ * for every instruction set it is built with.
+ *
+ * Each pixel is one byte shuffle, set up by GetShuffleBlitParams(), and an
+ * OR that fills in the alpha channel when the source has none. The unused
+ * byte of the destination is cleared, like BlitNtoN() does, or kept, like
+ * Blit_3or4_to_3or4__inversed_rgb() does.
+ */
+
+BLITV_TARGET SDL_FORCE_INLINE void BLITV_NAME(BlitShuffle)(SDL_BlitInfo *info, SDL_bool keep_unused)
+{
+    int width = info->dst_w;
+    int height = info->dst_h;
+    Uint8 *src = info->src;
+    int srcskip = info->src_skip;
+    Uint8 *dst = info->dst;
+    int dstskip = info->dst_skip;
+    ShuffleBlitParams params;
+    BLITV_PERM perm;
+    BLITV fill, keep;
+
+    GetShuffleBlitParams(info, keep_unused, &params);
+    BLITV_PERM_INIT(&perm, params.order);
+    fill = BLITV_SPLAT32(params.fill);
+    keep = BLITV_SPLAT32(params.keep);
+
+    while (height--) {
+        const Uint32 *srcp = (const Uint32 *)src;
+        Uint32 *dstp = (Uint32 *)dst;
+        int n;
+
+        if (BLITV_ALIGNED(srcp) && BLITV_ALIGNED(dstp)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (n = width; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV out = BLITV_OR(BLITV_PERMUTE(BLITV_LOADA(srcp), &perm), fill);
+                if (keep_unused) {
+                    out = BLITV_SELECT(keep, BLITV_LOADA(dstp), out);
+                }
+                BLITV_STOREA(dstp, out);
+                srcp += BLITV_PIXELS;
+                dstp += BLITV_PIXELS;
+            }
+        } else {
+            for (n = width; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV out = BLITV_OR(BLITV_PERMUTE(BLITV_LOAD(srcp), &perm), fill);
+                if (keep_unused) {
+                    out = BLITV_SELECT(keep, BLITV_LOAD(dstp), out);
+                }
+                BLITV_STORE(dstp, out);
+                srcp += BLITV_PIXELS;
+                dstp += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* Convert the last few pixels through a full vector */
+            Uint32 s[BLITV_PIXELS], d[BLITV_PIXELS];
+            BLITV out;
+
+            SDL_zeroa(s);
+            SDL_zeroa(d);
+            SDL_memcpy(s, srcp, n * sizeof(Uint32));
+            SDL_memcpy(d, dstp, n * sizeof(Uint32));
+            out = BLITV_OR(BLITV_PERMUTE(BLITV_LOAD(s), &perm), fill);
+            if (keep_unused) {
+                out = BLITV_SELECT(keep, BLITV_LOAD(d), out);
+            }
+            BLITV_STORE(d, out);
+            SDL_memcpy(dstp, d, n * sizeof(Uint32));
+        }
+        src += width * 4 + srcskip;
+        dst += width * 4 + dstskip;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(Blit8888to8888Shuffle)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitShuffle)(info, SDL_FALSE);
+}
+
+BLITV_TARGET static void BLITV_NAME(Blit8888to8888ShuffleKeepUnused)(SDL_BlitInfo *info)
+{
+    BLITV_NAME(BlitShuffle)(info, SDL_TRUE);
+}
+
+static const ShuffleBlitSIMD BLITV_NAME(ShuffleBlitSIMD) = {
+    BLITV_NAME(Blit8888to8888Shuffle),
+    BLITV_NAME(Blit8888to8888ShuffleKeepUnused)
+};
+
+/* vi: set ts=4 sw=4 expandtab: */
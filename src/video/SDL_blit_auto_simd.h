@@ -0,0 +1,5967 @@
+/* DO NOT EDIT!  This file is generated by sdlgenblit.pl */
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#if SDL_HAVE_BLIT_AUTO
+
+/* *INDENT-OFF* */ /* clang-format off */
+
+/*
+ * Vector versions of the blitters in SDL_blit_auto.c, written with the
+ * operations of SDL_blit_simd.h. SDL_blit_auto.c includes this once for
+ * every instruction set it is built with.
+ *
+ * The pixels are moved into the channel order of the destination, with
+ * alpha in the top byte, and give exactly the results of the scalar code.
+ */
+
+/* Copies the alpha byte of every pixel to its other bytes */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_SpreadAlpha)(BLITV v)
+{
+    v = BLITV_SRL32(v, 24);
+    v = BLITV_OR(v, BLITV_SLL32(v, 8));
+    return BLITV_OR(v, BLITV_SLL32(v, 16));
+}
+
+/* The modulation for every byte, 255 for what isn't modulated */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_Modulation)(const SDL_BlitInfo *info, int Rshift, int Gshift, int Bshift)
+{
+    Uint32 modulate = 0xFFFFFFFF;
+
+    if (info->flags & SDL_COPY_MODULATE_COLOR) {
+        modulate = 0xFF000000 | ((Uint32)info->r << Rshift) | ((Uint32)info->g << Gshift) | ((Uint32)info->b << Bshift);
+    }
+    if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+        modulate = (modulate & 0x00FFFFFF) | ((Uint32)info->a << 24);
+    }
+    return BLITV_SPLAT32(modulate);
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_Blend)(BLITV s, BLITV d, int mode)
+{
+    const BLITV amask = BLITV_SPLAT32(0xFF000000);
+    const BLITV sA = BLITV_NAME(SDL_Blit_SpreadAlpha)(s);
+    const BLITV inv_sA = BLITV_ANDNOT(BLITV_SPLAT32(0xFFFFFFFF), sA);
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        /* This goes away if we ever use premultiplied alpha */
+        s = BLITV_SELECT(amask, s, BLITV_MULDIV255(s, sA));
+        return BLITV_ADD8(s, BLITV_MULDIV255(inv_sA, d));
+    case SDL_COPY_ADD:
+        s = BLITV_MULDIV255(s, sA);
+        return BLITV_SELECT(amask, d, BLITV_ADDS8(s, d));
+    case SDL_COPY_MOD:
+        return BLITV_SELECT(amask, d, BLITV_MULDIV255(s, d));
+    case SDL_COPY_MUL:
+        /* d * (s + 255 - sA) / 255, split at 255 so the products fit in 16 bits */
+        s = BLITV_ADDS8(BLITV_MULDIV255(d, BLITV_ADDS8(s, inv_sA)),
+                        BLITV_MULDIV255(d, BLITV_SUBS8(s, sA)));
+        return BLITV_SELECT(amask, d, s);
+    default:
+        return d;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_RGB888_Pixels)(BLITV s)
+{
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_BGR888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGB888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_RGB888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_BGR888_Pixels)(BLITV s)
+{
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGR888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Pixels)(BLITV s)
+{
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Pixels)(BLITV s)
+{
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ARGB8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_RGBA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Pixels)(BLITV s)
+{
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 16), BLITV_AND(s, BLITV_SPLAT32(0xFF00FF00))), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x000000FF)), 16));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_ABGR8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_RGB888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_SRL32(s, 8), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 0, 8, 16);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_BGR888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Pixels)(BLITV s)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Scale)(SDL_BlitInfo *info)
+{
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Pixels)(BLITV_LOAD(srcbuf)));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV s, BLITV d, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV s, BLITV modulate)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV_LOADA(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(src), modulate));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Pixels)(BLITV_LOAD(srcbuf), modulate));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV s, BLITV d, BLITV modulate, int mode)
+{
+    s = BLITV_OR(BLITV_OR(BLITV_OR(BLITV_SRL32(s, 24), BLITV_SRL32(BLITV_AND(s, BLITV_SPLAT32(0x00FF0000)), 8)), BLITV_SLL32(BLITV_AND(s, BLITV_SPLAT32(0x0000FF00)), 8)), BLITV_SLL32(s, 24));
+    s = BLITV_MULDIV255(s, modulate);
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+    return s;
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOADA(src), BLITV_LOADA(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(src), BLITV_LOAD(dst), modulate, mode));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+BLITV_TARGET static void BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Scale)(SDL_BlitInfo *info)
+{
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, 16, 8, 0);
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dst), modulate, mode));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, BLITV_NAME(SDL_Blit_BGRA8888_ARGB8888_Modulate_Blend_Pixels)(BLITV_LOAD(srcbuf), BLITV_LOAD(dstbuf), modulate, mode));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+/* *INDENT-ON* */ /* clang-format on */
+
+#endif /* SDL_HAVE_BLIT_AUTO */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,416 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * A small set of vector operations for the blitters, so a kernel can be
+ * written once and built for every instruction set.
+ *
+ * Define one of BLITV_SSE2, BLITV_AVX2, BLITV_NEON or BLITV_ALTIVEC before
+ * including this file. It may be included again with another one, the
+ * previous definitions are replaced.
+ *
+ * Every function using these operations is declared with BLITV_TARGET, which
+ * lets AVX2 kernels be built without compiling the rest of SDL for AVX2.
+ *
+ * BLITV holds BLITV_PIXELS 32-bit pixels, seen as bytes by most operations.
+ * BLITV_LOAD() and BLITV_STORE() take any 32-bit aligned address, the faster
+ * BLITV_LOADA() and BLITV_STOREA() one for which BLITV_ALIGNED() is true.
+ * BLITV_PERMUTE() rearranges the four bytes of every pixel, as described by a
+ * BLITV_PERM set up with BLITV_PERM_INIT() from the source byte, in memory
+ * order, of each destination byte, or -1 to clear it.
+ * BLITV_MULW() multiplies bytes into two BLITV16 vectors of 16-bit lanes and
+ * BLITV_NARROW() puts them back together. Which bytes end up in which of the
+ * two vectors is up to the backend, so only lane-wise operations may be used
+ * on them in between.
+ * BLITV_MULDIV255() is a * b / 255 for every byte, rounded down like the
+ * scalar blitters do it.
+ */
+
+#undef BLITV
+#undef BLITV16
+#undef BLITV_PIXELS
+#undef BLITV_NAME
+#undef BLITV_TARGET
+#undef BLITV_LOAD
+#undef BLITV_STORE
+#undef BLITV_LOADA
+#undef BLITV_STOREA
+#undef BLITV_ALIGNED
+#undef BLITV_SPLAT32
+#undef BLITV_AND
+#undef BLITV_OR
+#undef BLITV_ANDNOT
+#undef BLITV_SELECT
+#undef BLITV_ADD8
+#undef BLITV_SUB8
+#undef BLITV_ADDS8
+#undef BLITV_SUBS8
+#undef BLITV_ABSDIFF8
+#undef BLITV_GE8
+#undef BLITV_CMPEQ32
+#undef BLITV_SLL32
+#undef BLITV_SRL32
+#undef BLITV_MULW
+#undef BLITV_MULDIV255
+#undef BLITV_NARROW
+#undef BLITV16_ADD
+#undef BLITV16_SRL
+#undef BLITV16_SPLAT
+#undef BLITV_SHIFT32
+#undef BLITV_PERM
+#undef BLITV_PERM_INIT
+#undef BLITV_PERMUTE
+
+#if defined(BLITV_SSE2)
+
+#ifndef SDL_blit_simd_sse2_h_
+#define SDL_blit_simd_sse2_h_
+/* Without a byte shuffle, every destination byte is shifted into place and masked */
+typedef struct
+{
+    __m128i mask[4];
+    __m128i right[4];
+    __m128i left[4];
+} BlitV_PermSSE2;
+
+static SDL_INLINE void BlitV_PermInitSSE2(BlitV_PermSSE2 *perm, const int order[4])
+{
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        const int shift = (order[i] < 0) ? 0 : 8 * (order[i] - i);
+
+        perm->mask[i] = _mm_set1_epi32((order[i] < 0) ? 0 : (int)(0xFFu << (8 * i)));
+        perm->right[i] = _mm_cvtsi32_si128(shift > 0 ? shift : 0);
+        perm->left[i] = _mm_cvtsi32_si128(shift < 0 ? -shift : 0);
+    }
+}
+
+static SDL_INLINE __m128i BlitV_PermuteSSE2(__m128i v, const BlitV_PermSSE2 *perm)
+{
+    __m128i out = _mm_and_si128(_mm_sll_epi32(_mm_srl_epi32(v, perm->right[0]), perm->left[0]), perm->mask[0]);
+    out = _mm_or_si128(out, _mm_and_si128(_mm_sll_epi32(_mm_srl_epi32(v, perm->right[1]), perm->left[1]), perm->mask[1]));
+    out = _mm_or_si128(out, _mm_and_si128(_mm_sll_epi32(_mm_srl_epi32(v, perm->right[2]), perm->left[2]), perm->mask[2]));
+    return _mm_or_si128(out, _mm_and_si128(_mm_sll_epi32(_mm_srl_epi32(v, perm->right[3]), perm->left[3]), perm->mask[3]));
+}
+#endif /* SDL_blit_simd_sse2_h_ */
+
+#define BLITV        __m128i
+#define BLITV16      __m128i
+#define BLITV_PIXELS 4
+#define BLITV_NAME(name) name##_SSE2
+#define BLITV_TARGET
+
+#define BLITV_LOAD(p)          _mm_loadu_si128((const __m128i *)(p))
+#define BLITV_STORE(p, v)      _mm_storeu_si128((__m128i *)(p), v)
+#define BLITV_LOADA(p)         _mm_load_si128((const __m128i *)(p))
+#define BLITV_STOREA(p, v)     _mm_store_si128((__m128i *)(p), v)
+#define BLITV_SPLAT32(x)       _mm_set1_epi32((int)(x))
+#define BLITV_AND(a, b)        _mm_and_si128(a, b)
+#define BLITV_OR(a, b)         _mm_or_si128(a, b)
+#define BLITV_ANDNOT(a, b)     _mm_andnot_si128(b, a)
+#define BLITV_SELECT(m, a, b)  _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b))
+#define BLITV_ADD8(a, b)       _mm_add_epi8(a, b)
+#define BLITV_SUB8(a, b)       _mm_sub_epi8(a, b)
+#define BLITV_ADDS8(a, b)      _mm_adds_epu8(a, b)
+#define BLITV_SUBS8(a, b)      _mm_subs_epu8(a, b)
+#define BLITV_ABSDIFF8(a, b)   _mm_or_si128(_mm_subs_epu8(a, b), _mm_subs_epu8(b, a))
+#define BLITV_GE8(a, b)        _mm_cmpeq_epi8(_mm_max_epu8(a, b), a)
+#define BLITV_CMPEQ32(a, b)    _mm_cmpeq_epi32(a, b)
+#define BLITV_SLL32(v, n)      _mm_slli_epi32(v, n)
+#define BLITV_SRL32(v, n)      _mm_srli_epi32(v, n)
+#define BLITV_MULW(a, b, lo, hi)                                                                 \
+    do {                                                                                         \
+        const __m128i _zero = _mm_setzero_si128();                                               \
+        lo = _mm_mullo_epi16(_mm_unpacklo_epi8(a, _zero), _mm_unpacklo_epi8(b, _zero));          \
+        hi = _mm_mullo_epi16(_mm_unpackhi_epi8(a, _zero), _mm_unpackhi_epi8(b, _zero));          \
+    } while (0)
+#define BLITV_NARROW(lo, hi)   _mm_packus_epi16(lo, hi)
+#define BLITV16_ADD(a, b)      _mm_add_epi16(a, b)
+#define BLITV16_SRL(v, n)      _mm_srli_epi16(v, n)
+#define BLITV16_SPLAT(x)       _mm_set1_epi16(x)
+#define BLITV_PERM             BlitV_PermSSE2
+#define BLITV_PERM_INIT(p, o)  BlitV_PermInitSSE2(p, o)
+#define BLITV_PERMUTE(v, p)    BlitV_PermuteSSE2(v, p)
+
+#elif defined(BLITV_AVX2)
+
+#ifndef SDL_blit_simd_avx2_h_
+#define SDL_blit_simd_avx2_h_
+typedef struct
+{
+    __m256i index;
+} BlitV_PermAVX2;
+
+/* The shuffle works within each 128-bit half, which is four whole pixels */
+SDL_TARGETING("avx2") static SDL_INLINE void BlitV_PermInitAVX2(BlitV_PermAVX2 *perm, const int order[4])
+{
+    Uint8 index[32];
+    int i;
+
+    for (i = 0; i < 32; ++i) {
+        index[i] = (order[i % 4] < 0) ? 0x80 : (Uint8)((i % 16) - (i % 4) + order[i % 4]);
+    }
+    perm->index = _mm256_loadu_si256((const __m256i *)index);
+}
+#endif /* SDL_blit_simd_avx2_h_ */
+
+#define BLITV        __m256i
+#define BLITV16      __m256i
+#define BLITV_PIXELS 8
+#define BLITV_NAME(name) name##_AVX2
+#define BLITV_TARGET SDL_TARGETING("avx2")
+
+#define BLITV_LOAD(p)          _mm256_loadu_si256((const __m256i *)(p))
+#define BLITV_STORE(p, v)      _mm256_storeu_si256((__m256i *)(p), v)
+#define BLITV_LOADA(p)         _mm256_load_si256((const __m256i *)(p))
+#define BLITV_STOREA(p, v)     _mm256_store_si256((__m256i *)(p), v)
+#define BLITV_SPLAT32(x)       _mm256_set1_epi32((int)(x))
+#define BLITV_AND(a, b)        _mm256_and_si256(a, b)
+#define BLITV_OR(a, b)         _mm256_or_si256(a, b)
+#define BLITV_ANDNOT(a, b)     _mm256_andnot_si256(b, a)
+#define BLITV_SELECT(m, a, b)  _mm256_blendv_epi8(b, a, m)
+#define BLITV_ADD8(a, b)       _mm256_add_epi8(a, b)
+#define BLITV_SUB8(a, b)       _mm256_sub_epi8(a, b)
+#define BLITV_ADDS8(a, b)      _mm256_adds_epu8(a, b)
+#define BLITV_SUBS8(a, b)      _mm256_subs_epu8(a, b)
+#define BLITV_ABSDIFF8(a, b)   _mm256_or_si256(_mm256_subs_epu8(a, b), _mm256_subs_epu8(b, a))
+#define BLITV_GE8(a, b)        _mm256_cmpeq_epi8(_mm256_max_epu8(a, b), a)
+#define BLITV_CMPEQ32(a, b)    _mm256_cmpeq_epi32(a, b)
+#define BLITV_SLL32(v, n)      _mm256_slli_epi32(v, n)
+#define BLITV_SRL32(v, n)      _mm256_srli_epi32(v, n)
+#define BLITV_MULW(a, b, lo, hi)                                                                        \
+    do {                                                                                                \
+        const __m256i _zero = _mm256_setzero_si256();                                                   \
+        lo = _mm256_mullo_epi16(_mm256_unpacklo_epi8(a, _zero), _mm256_unpacklo_epi8(b, _zero));        \
+        hi = _mm256_mullo_epi16(_mm256_unpackhi_epi8(a, _zero), _mm256_unpackhi_epi8(b, _zero));        \
+    } while (0)
+#define BLITV_NARROW(lo, hi)   _mm256_packus_epi16(lo, hi)
+#define BLITV16_ADD(a, b)      _mm256_add_epi16(a, b)
+#define BLITV16_SRL(v, n)      _mm256_srli_epi16(v, n)
+#define BLITV16_SPLAT(x)       _mm256_set1_epi16(x)
+#define BLITV_PERM             BlitV_PermAVX2
+#define BLITV_PERM_INIT(p, o)  BlitV_PermInitAVX2(p, o)
+#define BLITV_PERMUTE(v, p)    _mm256_shuffle_epi8(v, (p)->index)
+
+#elif defined(BLITV_NEON)
+
+#ifndef SDL_blit_simd_neon_h_
+#define SDL_blit_simd_neon_h_
+typedef struct
+{
+    uint8x16_t index;
+} BlitV_PermNEON;
+
+/* Table lookups with an index past the end give zero */
+static SDL_INLINE void BlitV_PermInitNEON(BlitV_PermNEON *perm, const int order[4])
+{
+    Uint8 index[16];
+    int i;
+
+    for (i = 0; i < 16; ++i) {
+        index[i] = (order[i % 4] < 0) ? 0xFF : (Uint8)(i - (i % 4) + order[i % 4]);
+    }
+    perm->index = vld1q_u8(index);
+}
+
+static SDL_INLINE uint8x16_t BlitV_PermuteNEON(uint8x16_t v, const BlitV_PermNEON *perm)
+{
+#if defined(__aarch64__) || defined(_M_ARM64)
+    return vqtbl1q_u8(v, perm->index);
+#else
+    uint8x8x2_t table;
+
+    table.val[0] = vget_low_u8(v);
+    table.val[1] = vget_high_u8(v);
+    return vcombine_u8(vtbl2_u8(table, vget_low_u8(perm->index)), vtbl2_u8(table, vget_high_u8(perm->index)));
+#endif
+}
+#endif /* SDL_blit_simd_neon_h_ */
+
+#define BLITV        uint8x16_t
+#define BLITV16      uint16x8_t
+#define BLITV_PIXELS 4
+#define BLITV_NAME(name) name##_NEON
+#define BLITV_TARGET
+
+#define BLITV_LOAD(p)          vld1q_u8((const Uint8 *)(p))
+#define BLITV_STORE(p, v)      vst1q_u8((Uint8 *)(p), v)
+#define BLITV_LOADA(p)         vld1q_u8((const Uint8 *)(p))
+#define BLITV_STOREA(p, v)     vst1q_u8((Uint8 *)(p), v)
+#define BLITV_SPLAT32(x)       vreinterpretq_u8_u32(vdupq_n_u32(x))
+#define BLITV_AND(a, b)        vandq_u8(a, b)
+#define BLITV_OR(a, b)         vorrq_u8(a, b)
+#define BLITV_ANDNOT(a, b)     vbicq_u8(a, b)
+#define BLITV_SELECT(m, a, b)  vbslq_u8(m, a, b)
+#define BLITV_ADD8(a, b)       vaddq_u8(a, b)
+#define BLITV_SUB8(a, b)       vsubq_u8(a, b)
+#define BLITV_ADDS8(a, b)      vqaddq_u8(a, b)
+#define BLITV_SUBS8(a, b)      vqsubq_u8(a, b)
+#define BLITV_ABSDIFF8(a, b)   vabdq_u8(a, b)
+#define BLITV_GE8(a, b)        vcgeq_u8(a, b)
+#define BLITV_CMPEQ32(a, b)    vreinterpretq_u8_u32(vceqq_u32(vreinterpretq_u32_u8(a), vreinterpretq_u32_u8(b)))
+#define BLITV_SLL32(v, n)      vreinterpretq_u8_u32(vshlq_n_u32(vreinterpretq_u32_u8(v), n))
+#define BLITV_SRL32(v, n)      vreinterpretq_u8_u32(vshrq_n_u32(vreinterpretq_u32_u8(v), n))
+#define BLITV_MULW(a, b, lo, hi)                              \
+    do {                                                      \
+        lo = vmull_u8(vget_low_u8(a), vget_low_u8(b));        \
+        hi = vmull_u8(vget_high_u8(a), vget_high_u8(b));      \
+    } while (0)
+#define BLITV_NARROW(lo, hi)   vcombine_u8(vmovn_u16(lo), vmovn_u16(hi))
+#define BLITV16_ADD(a, b)      vaddq_u16(a, b)
+#define BLITV16_SRL(v, n)      vshrq_n_u16(v, n)
+#define BLITV16_SPLAT(x)       vdupq_n_u16(x)
+#define BLITV_PERM             BlitV_PermNEON
+#define BLITV_PERM_INIT(p, o)  BlitV_PermInitNEON(p, o)
+#define BLITV_PERMUTE(v, p)    BlitV_PermuteNEON(v, p)
+
+#elif defined(BLITV_ALTIVEC)
+
+/* Big endian only: BLITV_NARROW() relies on the high byte of a 16-bit lane coming first */
+#define BLITV        vector unsigned char
+#define BLITV16      vector unsigned short
+#define BLITV_PIXELS 4
+#define BLITV_NAME(name) name##_AltiVec
+#define BLITV_TARGET
+
+#ifndef SDL_blit_simd_altivec_h_
+#define SDL_blit_simd_altivec_h_
+#ifdef HAVE_ALTIVEC_H
+#include <altivec.h>
+#endif
+
+/* AltiVec only loads and stores aligned vectors, so shift the data into place */
+static SDL_INLINE vector unsigned char BlitV_LoadAltiVec(const void *p)
+{
+    const vector unsigned char MSQ = vec_ld(0, (const unsigned char *)p);
+    const vector unsigned char LSQ = vec_ld(15, (const unsigned char *)p);
+    return vec_perm(MSQ, LSQ, vec_lvsl(0, (const unsigned char *)p));
+}
+
+/* Pixels are 32-bit aligned, so the vector can be written a pixel at a time */
+static SDL_INLINE void BlitV_StoreAltiVec(void *p, vector unsigned char v)
+{
+    const vector unsigned int w = (vector unsigned int)vec_perm(v, v, vec_lvsr(0, (unsigned char *)p));
+    vec_ste(w, 0, (unsigned int *)p);
+    vec_ste(w, 4, (unsigned int *)p);
+    vec_ste(w, 8, (unsigned int *)p);
+    vec_ste(w, 12, (unsigned int *)p);
+}
+
+static SDL_INLINE vector unsigned char BlitV_Splat32AltiVec(Uint32 x)
+{
+    union
+    {
+        vector unsigned int v;
+        Uint32 u[4];
+    } splat;
+    splat.u[0] = x;
+    return (vector unsigned char)vec_splat(splat.v, 0);
+}
+
+static SDL_INLINE vector unsigned short BlitV_Splat16AltiVec(Uint16 x)
+{
+    union
+    {
+        vector unsigned short v;
+        Uint16 u[8];
+    } splat;
+    splat.u[0] = x;
+    return vec_splat(splat.v, 0);
+}
+
+typedef struct
+{
+    vector unsigned char index;
+} BlitV_PermAltiVec;
+
+/* Indices past the first vector pick from a vector of zeros */
+static SDL_INLINE void BlitV_PermInitAltiVec(BlitV_PermAltiVec *perm, const int order[4])
+{
+    union
+    {
+        vector unsigned char v;
+        Uint8 u[16];
+    } index;
+    int i;
+
+    for (i = 0; i < 16; ++i) {
+        index.u[i] = (order[i % 4] < 0) ? 16 : (Uint8)(i - (i % 4) + order[i % 4]);
+    }
+    perm->index = index.v;
+}
+#endif /* SDL_blit_simd_altivec_h_ */
+
+/* vec_splat_u32() takes -16..15, shifts only use the low five bits of the count */
+#define BLITV_SHIFT32(n)       vec_splat_u32((n) > 15 ? (n) - 32 : (n))
+
+#define BLITV_LOAD(p)          BlitV_LoadAltiVec(p)
+#define BLITV_STORE(p, v)      BlitV_StoreAltiVec(p, v)
+#define BLITV_LOADA(p)         vec_ld(0, (const unsigned char *)(p))
+#define BLITV_STOREA(p, v)     vec_st(v, 0, (unsigned char *)(p))
+#define BLITV_SPLAT32(x)       BlitV_Splat32AltiVec(x)
+#define BLITV_AND(a, b)        vec_and(a, b)
+#define BLITV_OR(a, b)         vec_or(a, b)
+#define BLITV_ANDNOT(a, b)     vec_andc(a, b)
+#define BLITV_SELECT(m, a, b)  vec_sel(b, a, (vector unsigned char)(m))
+#define BLITV_ADD8(a, b)       vec_add(a, b)
+#define BLITV_SUB8(a, b)       vec_sub(a, b)
+#define BLITV_ADDS8(a, b)      vec_adds(a, b)
+#define BLITV_SUBS8(a, b)      vec_subs(a, b)
+#define BLITV_ABSDIFF8(a, b)   vec_sub(vec_max(a, b), vec_min(a, b))
+#define BLITV_GE8(a, b)        ((vector unsigned char)vec_cmpeq(vec_max(a, b), a))
+#define BLITV_CMPEQ32(a, b)    ((vector unsigned char)vec_cmpeq((vector unsigned int)(a), (vector unsigned int)(b)))
+#define BLITV_SLL32(v, n)      ((vector unsigned char)vec_sl((vector unsigned int)(v), BLITV_SHIFT32(n)))
+#define BLITV_SRL32(v, n)      ((vector unsigned char)vec_sr((vector unsigned int)(v), BLITV_SHIFT32(n)))
+#define BLITV_MULW(a, b, lo, hi) \
+    do {                         \
+        lo = vec_mule(a, b);     \
+        hi = vec_mulo(a, b);     \
+    } while (0)
+#define BLITV_NARROW(lo, hi)   ((vector unsigned char)vec_or(vec_sl(lo, vec_splat_u16(8)), hi))
+#define BLITV16_ADD(a, b)      vec_add(a, b)
+#define BLITV16_SRL(v, n)      vec_sr(v, vec_splat_u16(n))
+#define BLITV16_SPLAT(x)       BlitV_Splat16AltiVec(x)
+#define BLITV_PERM             BlitV_PermAltiVec
+#define BLITV_PERM_INIT(p, o)  BlitV_PermInitAltiVec(p, o)
+#define BLITV_PERMUTE(v, p)    vec_perm(v, vec_splat_u8(0), (p)->index)
+
+#else
+#error Define one of BLITV_SSE2, BLITV_AVX2, BLITV_NEON or BLITV_ALTIVEC
+#endif
+
+#define BLITV_ALIGNED(p) ((((uintptr_t)(p)) & (BLITV_PIXELS * 4 - 1)) == 0)
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(BlitV_MulDiv255)(BLITV a, BLITV b)
+{
+    const BLITV16 one = BLITV16_SPLAT(1);
+    BLITV16 lo, hi;
+
+    BLITV_MULW(a, b, lo, hi);
+    /* x / 255 == (x + 1 + (x >> 8)) >> 8 for 0 <= x <= 255 * 255 */
+    lo = BLITV16_SRL(BLITV16_ADD(BLITV16_ADD(lo, one), BLITV16_SRL(lo, 8)), 8);
+    hi = BLITV16_SRL(BLITV16_ADD(BLITV16_ADD(hi, one), BLITV16_SRL(hi, 8)), 8);
+    return BLITV_NARROW(lo, hi);
+}
+#define BLITV_MULDIV255(a, b) BLITV_NAME(BlitV_MulDiv255)(a, b)
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -106,7 +106,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
                     continue;
                 }
             }
-            if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL))) {
+            if ((flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED))) {
                 if (FORMAT_HAS_ALPHA(dstfmt_val)) {
                     DISEMBLE_RGBA(dst, dstbpp, dst_fmt, dstpixel, dstR, dstG, dstB, dstA);
                 } else if (FORMAT_HAS_NO_ALPHA(dstfmt_val)) {
@@ -129,6 +129,12 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
             }
             if (flags & SDL_COPY_MODULATE_ALPHA) {
                 srcA = (srcA * modulateA) / 255;
+                if (flags & SDL_COPY_BLEND_PREMULTIPLIED) {
+                    /* The color is premultiplied, so it fades with the alpha */
+                    srcR = (srcR * modulateA) / 255;
+                    srcG = (srcG * modulateA) / 255;
+                    srcB = (srcB * modulateA) / 255;
+                }
             }
             if (flags & (SDL_COPY_BLEND | SDL_COPY_ADD)) {
                 /* This goes away if we ever use premultiplied alpha */
@@ -138,7 +144,7 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
                     srcB = (srcB * srcA) / 255;
                 }
             }
-            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+            switch (flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED)) {
             case 0:
                 dstR = srcR;
                 dstG = srcG;
@@ -151,6 +157,9 @@ void SDL_Blit_Slow(SDL_BlitInfo *info)
                 dstB = srcB + ((255 - srcA) * dstB) / 255;
                 dstA = srcA + ((255 - srcA) * dstA) / 255;
                 break;
+            case SDL_COPY_BLEND_PREMULTIPLIED:
+                PREMULTIPLIED_ALPHA_BLEND_RGBA(srcR, srcG, srcB, srcA, dstR, dstG, dstB, dstA);
+                break;
             case SDL_COPY_ADD:
                 dstR = srcR + dstR;
                 if (dstR > 255) {
@@ -36,9 +36,13 @@
 #include "SDL_video.h"
 #include "SDL_endian.h"
 #include "SDL_pixels_c.h"
+#include "SDL_blit.h"
 
 #define SAVE_32BIT_BMP
 
+/* Pixels are read and written in blocks of rows of about this many bytes */
+#define BMP_BLOCK_SIZE (64 * 1024)
+
 /* Compression encodings for BMP files */
 #ifndef BI_RGB
 #define BI_RGB       0
@@ -166,33 +170,101 @@ static SDL_bool readRlePixels(SDL_Surface *surface, SDL_RWops *src, int isRle8)
     }
 }
 
-static void CorrectAlphaChannel(SDL_Surface *surface)
+/* Puts n 32-bit pixels, or pairs of 16-bit ones, from the little endian order
+   of the file into the native one if swap is 32 or 16, and returns the OR of
+   all of them to tell if any pixel has alpha */
+static Uint32 BmpDecodeRow(Uint32 *row, unsigned n, int swap)
 {
-    /* Check to see if there is any alpha channel data */
-    SDL_bool hasAlpha = SDL_FALSE;
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-    int alphaChannelOffset = 0;
-#else
-    int alphaChannelOffset = 3;
-#endif
-    Uint8 *alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-    Uint8 *end = alpha + surface->h * surface->pitch;
-
-    while (alpha < end) {
-        if (*alpha != 0) {
-            hasAlpha = SDL_TRUE;
-            break;
+    Uint32 any = 0;
+    unsigned i;
+
+    for (i = 0; i < n; ++i) {
+        Uint32 pixel = row[i];
+        if (swap == 32) {
+            pixel = SDL_Swap32(pixel);
+            row[i] = pixel;
+        } else if (swap == 16) {
+            pixel = ((pixel >> 8) & 0x00FF00FF) | ((pixel << 8) & 0xFF00FF00);
+            row[i] = pixel;
         }
-        alpha += 4;
+        any |= pixel;
+    }
+    return any;
+}
+
+/* Makes n 32-bit pixels opaque, for images without any alpha in the channel */
+static void BmpFillAlpha(Uint32 *pixels, size_t n, Uint32 amask)
+{
+    size_t i;
+
+    for (i = 0; i < n; ++i) {
+        pixels[i] |= amask;
     }
+}
 
-    if (!hasAlpha) {
-        alpha = ((Uint8 *)surface->pixels) + alphaChannelOffset;
-        while (alpha < end) {
-            *alpha = SDL_ALPHA_OPAQUE;
-            alpha += 4;
-        }
+#if defined(__SSE2__)
+#define BLITV_SSE2
+#include "SDL_blit_simd.h"
+#include "SDL_bmp_simd.h"
+#undef BLITV_SSE2
+#endif
+#if defined(SDL_AVX2_INTRINSICS)
+#define BLITV_AVX2
+#include "SDL_blit_simd.h"
+#include "SDL_bmp_simd.h"
+#undef BLITV_AVX2
+#endif
+#if defined(__ARM_NEON)
+#define BLITV_NEON
+#include "SDL_blit_simd.h"
+#include "SDL_bmp_simd.h"
+#undef BLITV_NEON
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+#define BLITV_ALTIVEC
+#include "SDL_blit_simd.h"
+#include "SDL_bmp_simd.h"
+#undef BLITV_ALTIVEC
+#endif
+
+typedef Uint32 (*BmpDecodeRowFunc)(Uint32 *row, unsigned n, int swap);
+typedef void (*BmpFillAlphaFunc)(Uint32 *pixels, size_t n, Uint32 amask);
+
+static void GetBmpDecoders(BmpDecodeRowFunc *decode_row, BmpFillAlphaFunc *fill_alpha)
+{
+    const int features = SDL_GetBlitCPUFeatures();
+
+#if defined(SDL_AVX2_INTRINSICS)
+    if (features & SDL_CPU_AVX2) {
+        *decode_row = BmpDecodeRow_AVX2;
+        *fill_alpha = BmpFillAlpha_AVX2;
+        return;
     }
+#endif
+#if defined(__SSE2__)
+    if (features & SDL_CPU_SSE2) {
+        *decode_row = BmpDecodeRow_SSE2;
+        *fill_alpha = BmpFillAlpha_SSE2;
+        return;
+    }
+#endif
+#if defined(__ARM_NEON)
+    if (features & SDL_CPU_NEON) {
+        *decode_row = BmpDecodeRow_NEON;
+        *fill_alpha = BmpFillAlpha_NEON;
+        return;
+    }
+#endif
+#if defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN
+    if (features & SDL_CPU_ALTIVEC) {
+        *decode_row = BmpDecodeRow_AltiVec;
+        *fill_alpha = BmpFillAlpha_AltiVec;
+        return;
+    }
+#endif
+    (void)features;
+    *decode_row = BmpDecodeRow;
+    *fill_alpha = BmpFillAlpha;
 }
 
 SDL_Surface *SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
@@ -209,6 +281,7 @@ SDL_Surface *SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
     SDL_Palette *palette;
     Uint8 *bits;
     Uint8 *top, *end;
+    Uint8 *rowbuf = NULL;
     SDL_bool topDown;
     int ExpandBMP;
     SDL_bool haveRGBMasks = SDL_FALSE;
@@ -496,112 +569,106 @@ SDL_Surface *SDL_LoadBMP_RW(SDL_RWops *src, int freesrc)
     }
     top = (Uint8 *)surface->pixels;
     end = (Uint8 *)surface->pixels + (surface->h * surface->pitch);
-    switch (ExpandBMP) {
-    case 1:
-        bmpPitch = (biWidth + 7) >> 3;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    case 2:
-        bmpPitch = (biWidth + 3) >> 2;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    case 4:
-        bmpPitch = (biWidth + 1) >> 1;
-        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
-        break;
-    default:
-        pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
-        break;
-    }
-    if (topDown) {
-        bits = top;
-    } else {
-        bits = end - surface->pitch;
-    }
-    while (bits >= top && bits < end) {
-        switch (ExpandBMP) {
-        case 1:
-        case 2:
-        case 4:
-        {
-            Uint8 pixel = 0;
-            int shift = (8 - ExpandBMP);
-            for (i = 0; i < surface->w; ++i) {
-                if (i % (8 / ExpandBMP) == 0) {
-                    if (!SDL_RWread(src, &pixel, 1, 1)) {
-                        SDL_Error(SDL_EFREAD);
-                        was_error = SDL_TRUE;
-                        goto done;
-                    }
-                }
-                bits[i] = (pixel >> shift);
-                if (bits[i] >= biClrUsed) {
-                    SDL_SetError("A BMP image contains a pixel with a color out of the palette");
-                    was_error = SDL_TRUE;
-                    goto done;
-                }
-                pixel <<= ExpandBMP;
-            }
-        } break;
+    if (!ExpandBMP) {
+        /* The rows of the file are padded like ours, so a top-down image is
+           read straight into the surface in large blocks. The rows of a
+           bottom-up one are read one at a time into place: putting a block of
+           them in order afterwards costs more than the calls it saves. */
+        const int rowsPerBlock = topDown ? SDL_max(BMP_BLOCK_SIZE / surface->pitch, 1) : 1;
+        BmpDecodeRowFunc decode_row;
+        BmpFillAlphaFunc fill_alpha;
+        Uint32 anyPixels = 0;
+        int swap = 0;
+        int y, rows;
 
-        default:
-            if (SDL_RWread(src, bits, 1, surface->pitch) != surface->pitch) {
+#if SDL_BYTEORDER == SDL_BIG_ENDIAN
+        /* Byte-swap the pixels if needed. Note that the 24bpp
+           case has already been taken care of above. */
+        if (biBitCount == 15 || biBitCount == 16) {
+            swap = 16;
+        } else if (biBitCount == 32) {
+            swap = 32;
+        }
+#endif
+        GetBmpDecoders(&decode_row, &fill_alpha);
+
+        for (y = 0; y < surface->h; y += rows) {
+            size_t size;
+
+            rows = SDL_min(rowsPerBlock, surface->h - y);
+            size = (size_t)rows * surface->pitch;
+            if (topDown) {
+                bits = top + y * surface->pitch;
+            } else {
+                bits = end - (y + rows) * surface->pitch;
+            }
+            if (SDL_RWread(src, bits, 1, size) != size) {
                 SDL_Error(SDL_EFREAD);
                 was_error = SDL_TRUE;
                 goto done;
             }
             if (biBitCount == 8 && palette && biClrUsed < (1u << biBitCount)) {
-                for (i = 0; i < surface->w; ++i) {
-                    if (bits[i] >= biClrUsed) {
+                for (i = 0; i < (int)size; ++i) {
+                    if (bits[i] >= biClrUsed && (i % surface->pitch) < surface->w) {
                         SDL_SetError("A BMP image contains a pixel with a color out of the palette");
                         was_error = SDL_TRUE;
                         goto done;
                     }
                 }
             }
-#if SDL_BYTEORDER == SDL_BIG_ENDIAN
-            /* Byte-swap the pixels if needed. Note that the 24bpp
-               case has already been taken care of above. */
-            switch (biBitCount) {
-            case 15:
-            case 16:
-            {
-                Uint16 *pix = (Uint16 *)bits;
-                for (i = 0; i < surface->w; i++) {
-                    pix[i] = SDL_Swap16(pix[i]);
-                }
-                break;
+            if (swap || correctAlpha) {
+                anyPixels |= decode_row((Uint32 *)bits, (unsigned)(size / 4), swap);
             }
+        }
 
-            case 32:
-            {
-                Uint32 *pix = (Uint32 *)bits;
-                for (i = 0; i < surface->w; i++) {
-                    pix[i] = SDL_Swap32(pix[i]);
-                }
-                break;
-            }
-            }
-#endif
-            break;
+        /* An image without any alpha in the channel is opaque */
+        if (correctAlpha && !(anyPixels & Amask)) {
+            fill_alpha((Uint32 *)top, (size_t)surface->h * surface->pitch / 4, Amask);
         }
-        /* Skip padding bytes, ugh */
-        if (pad) {
-            Uint8 padbyte;
-            for (i = 0; i < pad; ++i) {
-                SDL_RWread(src, &padbyte, 1, 1);
-            }
+    } else {
+        /* Each row is read at once, and expanded to 8 bits per pixel */
+        const int shift = (8 - ExpandBMP);
+        const int perByte = (8 / ExpandBMP);
+
+        bmpPitch = (int)(((Sint64)biWidth * ExpandBMP + 7) >> 3);
+        pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
+        rowbuf = (Uint8 *)SDL_malloc(bmpPitch + pad);
+        if (!rowbuf) {
+            SDL_OutOfMemory();
+            was_error = SDL_TRUE;
+            goto done;
         }
+
         if (topDown) {
-            bits += surface->pitch;
+            bits = top;
         } else {
-            bits -= surface->pitch;
+            bits = end - surface->pitch;
+        }
+        while (bits >= top && bits < end) {
+            /* The padding of the last row may be missing */
+            if (SDL_RWread(src, rowbuf, 1, bmpPitch + pad) < (size_t)bmpPitch) {
+                SDL_Error(SDL_EFREAD);
+                was_error = SDL_TRUE;
+                goto done;
+            }
+            for (i = 0; i < surface->w; ++i) {
+                const Uint8 pixel = (Uint8)(rowbuf[i / perByte] << ((i % perByte) * ExpandBMP));
+                bits[i] = (pixel >> shift);
+                if (bits[i] >= biClrUsed) {
+                    SDL_SetError("A BMP image contains a pixel with a color out of the palette");
+                    was_error = SDL_TRUE;
+                    goto done;
+                }
+            }
+            if (topDown) {
+                bits += surface->pitch;
+            } else {
+                bits -= surface->pitch;
+            }
         }
-    }
-    if (correctAlpha) {
-        CorrectAlphaChannel(surface);
     }
 done:
+    SDL_free(rowbuf);
     if (was_error) {
         if (src) {
             SDL_RWseek(src, fp_offset, RW_SEEK_SET);
@@ -620,7 +687,7 @@ int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
     Sint64 fp_offset;
     int i, pad;
     SDL_Surface *intermediate_surface;
-    Uint8 *bits;
+    Uint32 file_format = SDL_PIXELFORMAT_UNKNOWN;
     SDL_bool save32bit = SDL_FALSE;
     SDL_bool saveLegacyBMP = SDL_FALSE;
 
@@ -686,6 +753,12 @@ int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
 #endif
         ) {
             intermediate_surface = surface;
+        } else if (!surface->format->palette &&
+                   !(surface->map->info.flags & SDL_COPY_COLORKEY)) {
+            /* The pixels are converted a block of rows at a time while
+               they're written, instead of into a copy of the surface */
+            intermediate_surface = surface;
+            file_format = save32bit ? SDL_PIXELFORMAT_BGRA32 : SDL_PIXELFORMAT_BGR24;
         } else {
             SDL_PixelFormat format;
 
@@ -713,7 +786,13 @@ int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
     }
 
     if (intermediate_surface && (SDL_LockSurface(intermediate_surface) == 0)) {
-        const int bw = intermediate_surface->w * intermediate_surface->format->BytesPerPixel;
+        int bw;
+
+        if (file_format == SDL_PIXELFORMAT_UNKNOWN) {
+            file_format = intermediate_surface->format->format;
+        }
+        bw = intermediate_surface->w * SDL_BYTESPERPIXEL(file_format);
+        pad = ((bw % 4) ? (4 - (bw % 4)) : 0);
 
         /* Set the BMP file header values */
         bfSize = 0; /* We'll write this when we're done */
@@ -735,9 +814,9 @@ int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
         biWidth = intermediate_surface->w;
         biHeight = intermediate_surface->h;
         biPlanes = 1;
-        biBitCount = intermediate_surface->format->BitsPerPixel;
+        biBitCount = SDL_BITSPERPIXEL(file_format);
         biCompression = BI_RGB;
-        biSizeImage = intermediate_surface->h * intermediate_surface->pitch;
+        biSizeImage = intermediate_surface->h * (bw + pad);
         biXPelsPerMeter = 0;
         biYPelsPerMeter = 0;
         if (intermediate_surface->format->palette) {
@@ -815,21 +894,50 @@ int SDL_SaveBMP_RW(SDL_Surface *surface, SDL_RWops *dst, int freedst)
             SDL_Error(SDL_EFSEEK);
         }
 
-        /* Write the bitmap image upside down */
-        bits = (Uint8 *)intermediate_surface->pixels + (intermediate_surface->h * intermediate_surface->pitch);
-        pad = ((bw % 4) ? (4 - (bw % 4)) : 0);
-        while (bits > (Uint8 *)intermediate_surface->pixels) {
-            bits -= intermediate_surface->pitch;
-            if (SDL_RWwrite(dst, bits, 1, bw) != bw) {
-                SDL_Error(SDL_EFWRITE);
-                break;
+        /* Write the bitmap image upside down. Pixels in another format are
+           converted a block of rows at a time into one buffer, which has the
+           zero padding of the file after every row. */
+        {
+            static const Uint8 padding[3] = { 0, 0, 0 };
+            const SDL_bool convert = (file_format != intermediate_surface->format->format);
+            const int stride = bw + pad;
+            const int rowsPerBlock = convert ? SDL_min(SDL_max(BMP_BLOCK_SIZE / stride, 1), intermediate_surface->h) : 1;
+            Uint8 *block = NULL;
+            SDL_bool failed = SDL_FALSE;
+            int y, rows;
+
+            if (convert) {
+                block = (Uint8 *)SDL_calloc(rowsPerBlock, stride);
+                if (!block) {
+                    SDL_OutOfMemory();
+                    failed = SDL_TRUE;
+                }
             }
-            if (pad) {
-                const Uint8 padbyte = 0;
-                for (i = 0; i < pad; ++i) {
-                    SDL_RWwrite(dst, &padbyte, 1, 1);
+            for (y = intermediate_surface->h; !failed && y > 0; y -= rows) {
+                const Uint8 *bits;
+
+                rows = SDL_min(rowsPerBlock, y);
+                bits = (const Uint8 *)intermediate_surface->pixels + (y - rows) * intermediate_surface->pitch;
+                if (convert) {
+                    if (SDL_ConvertPixels(intermediate_surface->w, rows, intermediate_surface->format->format, bits,
+                                          intermediate_surface->pitch, file_format, block, stride) < 0) {
+                        break;
+                    }
+                    for (i = rows; i-- > 0;) {
+                        if (SDL_RWwrite(dst, block + i * stride, 1, stride) != (size_t)stride) {
+                            failed = SDL_TRUE;
+                            break;
+                        }
+                    }
+                } else if (SDL_RWwrite(dst, bits, 1, bw) != (size_t)bw ||
+                           (pad && SDL_RWwrite(dst, padding, 1, pad) != (size_t)pad)) {
+                    failed = SDL_TRUE;
+                }
+                if (failed) {
+                    SDL_Error(SDL_EFWRITE);
                 }
             }
+            SDL_free(block);
         }
 
         /* Write the BMP file size */
@@ -0,0 +1,66 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+
+/*
+ * Decoding of BMP pixel rows, written with the operations of SDL_blit_simd.h.
+ * SDL_bmp.c includes this once for every instruction set it is built with.
+ *
+ * The results are exactly those of BmpDecodeRow() and BmpFillAlpha().
+ */
+
+BLITV_TARGET static Uint32 BLITV_NAME(BmpDecodeRow)(Uint32 *row, unsigned n, int swap)
+{
+    static const int swap16[4] = { 1, 0, 3, 2 };
+    static const int swap32[4] = { 3, 2, 1, 0 };
+    Uint32 lanes[BLITV_PIXELS];
+    BLITV any = BLITV_SPLAT32(0);
+    BLITV_PERM perm;
+    unsigned i;
+
+    BLITV_PERM_INIT(&perm, (swap == 16) ? swap16 : swap32);
+    for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+        BLITV v = BLITV_LOAD(row);
+        if (swap) {
+            v = BLITV_PERMUTE(v, &perm);
+            BLITV_STORE(row, v);
+        }
+        any = BLITV_OR(any, v);
+        row += BLITV_PIXELS;
+    }
+    BLITV_STORE(lanes, any);
+    for (i = 0; i < BLITV_PIXELS; ++i) {
+        lanes[0] |= lanes[i];
+    }
+    return lanes[0] | BmpDecodeRow(row, n, swap);
+}
+
+BLITV_TARGET static void BLITV_NAME(BmpFillAlpha)(Uint32 *pixels, size_t n, Uint32 amask)
+{
+    const BLITV alpha = BLITV_SPLAT32(amask);
+
+    for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+        BLITV_STORE(pixels, BLITV_OR(BLITV_LOAD(pixels), alpha));
+        pixels += BLITV_PIXELS;
+    }
+    BmpFillAlpha(pixels, n, amask);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
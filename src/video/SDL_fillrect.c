@@ -23,6 +23,7 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 #include "SDL_cpuinfo.h"
+#include "../thread/SDL_jobs_c.h"
 
 #ifdef __SSE__
 /* *INDENT-OFF* */ /* clang-format off */
@@ -297,6 +298,23 @@ static void fill_32_simd(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
 }
 #endif
 
+typedef struct
+{
+    void (*fill_function)(Uint8 *pixels, int pitch, Uint32 color, int w, int h);
+    Uint8 *pixels;
+    int pitch;
+    Uint32 color;
+    int w;
+} SDL_FillBands;
+
+/* Fills rows [start, end) of the rectangle */
+static void SDL_FillBand(void *userdata, int start, int end)
+{
+    const SDL_FillBands *bands = (const SDL_FillBands *)userdata;
+
+    bands->fill_function(bands->pixels + (size_t)start * bands->pitch, bands->pitch, bands->color, bands->w, end - start);
+}
+
 int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
                   Uint32 color)
 {
@@ -304,6 +322,7 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
     Uint8 *pixels;
     const SDL_Rect *rect;
     void (*fill_function)(Uint8 * pixels, int pitch, Uint32 color, int w, int h) = NULL;
+    int band_rows;
     int i;
 
     if (!dst) {
@@ -436,7 +455,19 @@ int SDL_FillRects(SDL_Surface *dst, const SDL_Rect *rects, int count,
         pixels = (Uint8 *)dst->pixels + rect->y * dst->pitch +
                  rect->x * dst->format->BytesPerPixel;
 
-        fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        band_rows = SDL_GetBlitBandRows(rect->w, rect->h);
+        if (band_rows > 0 && band_rows < rect->h) {
+            SDL_FillBands bands;
+
+            bands.fill_function = fill_function;
+            bands.pixels = pixels;
+            bands.pitch = dst->pitch;
+            bands.color = color;
+            bands.w = rect->w;
+            SDL_RunJobs(SDL_JOB_KERNEL_BLIT_ROWS, SDL_FillBand, &bands, rect->h, band_rows);
+        } else {
+            fill_function(pixels, dst->pitch, color, rect->w, rect->h);
+        }
     }
 
     /* We're done! */
@@ -129,6 +129,8 @@ const char *SDL_GetPixelFormatName(Uint32 format)
         CASE(SDL_PIXELFORMAT_YVYU)
         CASE(SDL_PIXELFORMAT_NV12)
         CASE(SDL_PIXELFORMAT_NV21)
+        CASE(SDL_PIXELFORMAT_P010)
+        CASE(SDL_PIXELFORMAT_P016)
         CASE(SDL_PIXELFORMAT_EXTERNAL_OES)
 
     default:
@@ -746,6 +748,7 @@ void SDL_FreePalette(SDL_Palette *palette)
     if (--palette->refcount > 0) {
         return;
     }
+    SDL_ForgetPaletteLookup(palette);
     SDL_free(palette->colors);
     SDL_free(palette);
 }
@@ -778,6 +781,176 @@ void SDL_DitherColors(SDL_Color *colors, int bpp)
     }
 }
 
+/*
+ * Nearest color lookup for palettes
+ *
+ * Opaque colors, which is what SDL_MapRGB() looks for, are found through a
+ * grid over the RGB cube. Each cell lists the palette colors that can be the
+ * nearest one to some color inside of it: those that are no farther from the
+ * cell than the farthest corner of the cell is from the best color. A cell is
+ * set up the first time a color in it is looked for, and the results are
+ * exactly those of a full scan.
+ *
+ * SDL_Palette has no room for this, so the most recently used palettes keep
+ * theirs here, along with a copy of their colors. Like the blit maps, a
+ * lookup is rebuilt when the palette version changes, so colors have to be
+ * changed with SDL_SetPaletteColors(). SDL_FreePalette() drops the lookup,
+ * so a new palette at the same address never finds a stale one.
+ */
+#define PALETTE_LOOKUP_CACHE_SIZE 4
+#define PALETTE_LOOKUP_BITS       3
+#define PALETTE_LOOKUP_CELLS      (1 << (3 * PALETTE_LOOKUP_BITS))
+#define PALETTE_LOOKUP_UNSET      0xFFFF
+
+typedef struct
+{
+    const SDL_Palette *palette;
+    Uint32 version;
+    int ncolors;
+    Uint32 last_used;
+    SDL_Color colors[256];
+    Uint16 cell_start[PALETTE_LOOKUP_CELLS]; /* offset of the candidates in the pool */
+    Uint16 cell_count[PALETTE_LOOKUP_CELLS];
+    Uint8 *pool;
+    int pool_used;
+    int pool_size;
+} PaletteLookup;
+
+static PaletteLookup palette_lookups[PALETTE_LOOKUP_CACHE_SIZE];
+static Uint32 palette_lookup_clock;
+static SDL_SpinLock palette_lookup_lock = 0;
+
+static void ResetPaletteLookup(PaletteLookup *lookup, const SDL_Palette *pal)
+{
+    lookup->palette = pal;
+    lookup->version = pal->version;
+    lookup->ncolors = pal->ncolors;
+    SDL_memcpy(lookup->colors, pal->colors, pal->ncolors * sizeof(*pal->colors));
+    SDL_memset(lookup->cell_start, 0xFF, sizeof(lookup->cell_start));
+    lookup->pool_used = 0;
+}
+
+/* Call with palette_lookup_lock held */
+static PaletteLookup *GetPaletteLookup(const SDL_Palette *pal)
+{
+    PaletteLookup *lookup = NULL;
+    int i;
+
+    for (i = 0; i < PALETTE_LOOKUP_CACHE_SIZE; ++i) {
+        if (palette_lookups[i].palette == pal) {
+            lookup = &palette_lookups[i];
+            break;
+        }
+        if (!lookup || palette_lookups[i].last_used < lookup->last_used) {
+            lookup = &palette_lookups[i];
+        }
+    }
+    if (lookup->palette != pal || lookup->version != pal->version || lookup->ncolors != pal->ncolors) {
+        ResetPaletteLookup(lookup, pal);
+    }
+    lookup->last_used = ++palette_lookup_clock;
+    return lookup;
+}
+
+/* The squared distances of a channel value to the nearest and the farthest end of a range */
+#define RANGE_DISTANCES(v, lo, hi, nearest, farthest)                        \
+    {                                                                        \
+        const int below = (int)(v) - (lo), above = (int)(v) - (hi);          \
+        nearest += (below < 0) ? below * below : (above > 0) ? above * above : 0; \
+        farthest += SDL_max(below * below, above * above);                   \
+    }
+
+/* Call with palette_lookup_lock held, returns SDL_FALSE if out of memory */
+static SDL_bool BuildPaletteLookupCell(PaletteLookup *lookup, int cell)
+{
+    const int size = 256 >> PALETTE_LOOKUP_BITS;
+    const int rlo = (cell >> (2 * PALETTE_LOOKUP_BITS)) * size;
+    const int glo = ((cell >> PALETTE_LOOKUP_BITS) & ((1 << PALETTE_LOOKUP_BITS) - 1)) * size;
+    const int blo = (cell & ((1 << PALETTE_LOOKUP_BITS) - 1)) * size;
+    unsigned int nearest[256];
+    unsigned int bound = ~0U;
+    int i, count = 0;
+
+    for (i = 0; i < lookup->ncolors; ++i) {
+        const SDL_Color *color = &lookup->colors[i];
+        const int ad = color->a - SDL_ALPHA_OPAQUE;
+        unsigned int near_distance = ad * ad, far_distance = ad * ad;
+
+        RANGE_DISTANCES(color->r, rlo, rlo + size - 1, near_distance, far_distance);
+        RANGE_DISTANCES(color->g, glo, glo + size - 1, near_distance, far_distance);
+        RANGE_DISTANCES(color->b, blo, blo + size - 1, near_distance, far_distance);
+        nearest[i] = near_distance;
+        bound = SDL_min(bound, far_distance);
+    }
+
+    if (lookup->pool_used + lookup->ncolors > lookup->pool_size) {
+        const int pool_size = SDL_max(lookup->pool_size * 2, lookup->pool_used + lookup->ncolors);
+        Uint8 *pool = (Uint8 *)SDL_realloc(lookup->pool, pool_size);
+        if (!pool) {
+            return SDL_FALSE;
+        }
+        lookup->pool = pool;
+        lookup->pool_size = pool_size;
+    }
+
+    /* In palette order, so the first of equally close colors wins like in a full scan */
+    for (i = 0; i < lookup->ncolors; ++i) {
+        if (nearest[i] <= bound) {
+            lookup->pool[lookup->pool_used + count++] = (Uint8)i;
+        }
+    }
+    lookup->cell_start[cell] = (Uint16)lookup->pool_used;
+    lookup->cell_count[cell] = (Uint16)count;
+    lookup->pool_used += count;
+    return SDL_TRUE;
+}
+#undef RANGE_DISTANCES
+
+/* Call with palette_lookup_lock held, returns -1 if the color can't be looked up */
+static int FindOpaqueColor(PaletteLookup *lookup, Uint8 r, Uint8 g, Uint8 b)
+{
+    const int shift = 8 - PALETTE_LOOKUP_BITS;
+    const int cell = ((r >> shift) << (2 * PALETTE_LOOKUP_BITS)) | ((g >> shift) << PALETTE_LOOKUP_BITS) | (b >> shift);
+    const Uint8 *candidates;
+    unsigned int smallest = ~0U;
+    int i, pixel = 0;
+
+    if (lookup->cell_start[cell] == PALETTE_LOOKUP_UNSET && !BuildPaletteLookupCell(lookup, cell)) {
+        return -1;
+    }
+    candidates = lookup->pool + lookup->cell_start[cell];
+    for (i = 0; i < lookup->cell_count[cell]; ++i) {
+        const SDL_Color *color = &lookup->colors[candidates[i]];
+        const int rd = color->r - r;
+        const int gd = color->g - g;
+        const int bd = color->b - b;
+        const int ad = color->a - SDL_ALPHA_OPAQUE;
+        const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+        if (distance < smallest) {
+            pixel = candidates[i];
+            if (distance == 0) { /* Perfect match! */
+                break;
+            }
+            smallest = distance;
+        }
+    }
+    return pixel;
+}
+
+void SDL_ForgetPaletteLookup(const SDL_Palette *pal)
+{
+    int i;
+
+    SDL_AtomicLock(&palette_lookup_lock);
+    for (i = 0; i < PALETTE_LOOKUP_CACHE_SIZE; ++i) {
+        if (palette_lookups[i].palette == pal) {
+            SDL_free(palette_lookups[i].pool);
+            SDL_zero(palette_lookups[i]);
+        }
+    }
+    SDL_AtomicUnlock(&palette_lookup_lock);
+}
+
 /*
  * Match an RGB value to a particular palette index
  */
@@ -790,6 +963,18 @@ Uint8 SDL_FindColor(SDL_Palette *pal, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
     int i;
     Uint8 pixel = 0;
 
+    /* A full scan is as fast for small palettes */
+    if (a == SDL_ALPHA_OPAQUE && pal->ncolors > 16 && pal->ncolors <= 256) {
+        int found;
+
+        SDL_AtomicLock(&palette_lookup_lock);
+        found = FindOpaqueColor(GetPaletteLookup(pal), r, g, b);
+        SDL_AtomicUnlock(&palette_lookup_lock);
+        if (found >= 0) {
+            return (Uint8)found;
+        }
+    }
+
     smallest = ~0;
     for (i = 0; i < pal->ncolors; ++i) {
         rd = pal->colors[i].r - r;
@@ -1015,11 +1200,118 @@ SDL_BlitMap *SDL_AllocBlitMap(void)
     map->info.g = 0xFF;
     map->info.b = 0xFF;
     map->info.a = 0xFF;
+    map->cached = SDL_TRUE;
 
     /* It's ready to go */
     return map;
 }
 
+/* Drops the references of a blit map entry, and the table of a kept blit */
+static void SDL_ReleaseBlitMapEntry(SDL_BlitMapEntry *entry)
+{
+    if (entry->dst_fmt) {
+        SDL_FreeFormat(entry->dst_fmt);
+    }
+    if (entry->src_palette) {
+        SDL_FreePalette(entry->src_palette);
+    }
+    if (entry->dst_palette) {
+        SDL_FreePalette(entry->dst_palette);
+    }
+    SDL_free(entry->table);
+    SDL_zerop(entry);
+}
+
+/* Records what the blit that was just set up is for, so it can be reused */
+static void SDL_RememberBlitMap(SDL_BlitMap *map, SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_BlitMapEntry *current = &map->current;
+
+    SDL_AtomicLock(&formats_lock);
+    ++dst->format->refcount;
+    SDL_AtomicUnlock(&formats_lock);
+    current->dst_fmt = dst->format;
+
+    current->src_palette = src->format->palette;
+    if (current->src_palette) {
+        ++current->src_palette->refcount;
+        current->src_palette_version = current->src_palette->version;
+    }
+    current->dst_palette = dst->format->palette;
+    if (current->dst_palette) {
+        ++current->dst_palette->refcount;
+        current->dst_palette_version = current->dst_palette->version;
+    }
+    current->flags = map->info.flags;
+    current->r = map->info.r;
+    current->g = map->info.g;
+    current->b = map->info.b;
+    current->a = map->info.a;
+}
+
+/* Moves the current blit into the cache, in place of the least recently used one */
+static void SDL_KeepBlitMap(SDL_BlitMap *map)
+{
+    SDL_BlitMapEntry *entry = &map->cache[0];
+    int i;
+
+    for (i = 1; i < SDL_arraysize(map->cache) && entry->dst_fmt; ++i) {
+        if (!map->cache[i].dst_fmt || map->cache[i].last_used < entry->last_used) {
+            entry = &map->cache[i];
+        }
+    }
+    SDL_ReleaseBlitMapEntry(entry);
+
+    *entry = map->current;
+    entry->last_used = ++map->cache_clock;
+    entry->identity = map->identity;
+    entry->table = map->info.table;
+    entry->data = map->data;
+    entry->blit = map->blit;
+    map->info.table = NULL;
+    SDL_zero(map->current);
+}
+
+/* Sets up a kept blit again if there is one for these surfaces */
+static SDL_bool SDL_ReuseBlitMap(SDL_BlitMap *map, SDL_Surface *src, SDL_Surface *dst)
+{
+    SDL_Palette *src_palette = src->format->palette;
+    SDL_Palette *dst_palette = dst->format->palette;
+    int i;
+
+    for (i = 0; i < SDL_arraysize(map->cache); ++i) {
+        SDL_BlitMapEntry *entry = &map->cache[i];
+
+        if (entry->dst_fmt != dst->format || entry->flags != map->info.flags ||
+            entry->src_palette != src_palette || (src_palette && entry->src_palette_version != src_palette->version) ||
+            entry->dst_palette != dst_palette || (dst_palette && entry->dst_palette_version != dst_palette->version)) {
+            continue;
+        }
+        /* The table of a palette source has the color and alpha modulation in it */
+        if (src_palette && (entry->r != map->info.r || entry->g != map->info.g ||
+                            entry->b != map->info.b || entry->a != map->info.a)) {
+            continue;
+        }
+
+        map->current = *entry;
+        map->identity = entry->identity;
+        map->info.table = entry->table;
+        map->data = entry->data;
+        map->blit = entry->blit;
+        map->current.table = NULL;
+        map->current.data = NULL;
+        map->current.blit = NULL;
+        SDL_zerop(entry);
+
+        map->info.src_fmt = src->format;
+        map->info.src_pitch = src->pitch;
+        map->info.dst_fmt = dst->format;
+        map->info.dst_pitch = dst->pitch;
+        return SDL_TRUE;
+    }
+    return SDL_FALSE;
+}
+
 void SDL_InvalidateAllBlitMap(SDL_Surface *surface)
 {
     SDL_ListNode *l = surface->list_blitmap;
@@ -1046,6 +1338,13 @@ void SDL_InvalidateMap(SDL_BlitMap *map)
     map->dst = NULL;
     map->src_palette_version = 0;
     map->dst_palette_version = 0;
+    if (map->current.dst_fmt) {
+        if (map->data) {
+            SDL_KeepBlitMap(map);
+        } else {
+            SDL_ReleaseBlitMapEntry(&map->current);
+        }
+    }
     SDL_free(map->info.table);
     map->info.table = NULL;
 }
@@ -1055,6 +1354,7 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     SDL_PixelFormat *srcfmt;
     SDL_PixelFormat *dstfmt;
     SDL_BlitMap *map;
+    SDL_bool cacheable, reused;
 
     /* Clear out any previous mapping */
     map = src->map;
@@ -1065,13 +1365,20 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
 #endif
     SDL_InvalidateMap(map);
 
+    /* Switching back to a destination, palette or flags this surface was
+       blitted with before doesn't need to set up the blit again */
+    cacheable = map->cached && !(map->info.flags & SDL_COPY_RLE_DESIRED);
+    reused = cacheable && SDL_ReuseBlitMap(map, src, dst);
+
     /* Figure out what kind of mapping we're doing */
-    map->identity = 0;
     srcfmt = src->format;
     dstfmt = dst->format;
-    if (SDL_ISPIXELFORMAT_INDEXED(srcfmt->format)) {
+    if (reused) {
+        /* Everything is set up already */
+    } else if (SDL_ISPIXELFORMAT_INDEXED(srcfmt->format)) {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             /* Palette --> Palette */
+            map->identity = 0;
             map->info.table =
                 Map1to1(srcfmt->palette, dstfmt->palette, &map->identity);
             if (!map->identity) {
@@ -1084,6 +1391,7 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
             }
         } else {
             /* Palette --> BitField */
+            map->identity = 0;
             map->info.table =
                 Map1toN(srcfmt, src->map->info.r, src->map->info.g,
                         src->map->info.b, src->map->info.a, dstfmt);
@@ -1094,6 +1402,7 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             /* BitField --> Palette */
+            map->identity = 0;
             map->info.table = MapNto1(srcfmt, dstfmt, &map->identity);
             if (!map->identity) {
                 if (!map->info.table) {
@@ -1103,9 +1412,7 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
             map->identity = 0; /* Don't optimize to copy */
         } else {
             /* BitField --> BitField */
-            if (srcfmt == dstfmt) {
-                map->identity = 1;
-            }
+            map->identity = (srcfmt == dstfmt);
         }
     }
 
@@ -1128,14 +1435,31 @@ int SDL_MapSurface(SDL_Surface *src, SDL_Surface *dst)
         map->src_palette_version = 0;
     }
 
+    if (reused) {
+        return 0;
+    }
+
     /* Choose your blitters wisely */
-    return SDL_CalculateBlit(src);
+    if (SDL_CalculateBlit(src) < 0) {
+        return -1;
+    }
+    if (cacheable) {
+        SDL_RememberBlitMap(map, src, dst);
+    }
+    return 0;
 }
 
 void SDL_FreeBlitMap(SDL_BlitMap *map)
 {
     if (map) {
+        int i;
+
         SDL_InvalidateMap(map);
+        for (i = 0; i < SDL_arraysize(map->cache); ++i) {
+            SDL_ReleaseBlitMapEntry(&map->cache[i]);
+        }
+        SDL_FreeSurface(map->scaled_rows);
+        SDL_FreeSurface(map->scaled_source);
         SDL_free(map);
     }
 }
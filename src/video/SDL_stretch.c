@@ -20,9 +20,12 @@
 */
 #include "../SDL_internal.h"
 
+#include "SDL_atomic.h"
 #include "SDL_video.h"
+#include "SDL_hints.h"
 #include "SDL_blit.h"
 #include "SDL_render.h"
+#include "../thread/SDL_jobs_c.h"
 
 static int SDL_LowerSoftStretchNearest(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
 static int SDL_LowerSoftStretchLinear(SDL_Surface *src, const SDL_Rect *srcrect, SDL_Surface *dst, const SDL_Rect *dstrect);
@@ -54,7 +57,8 @@ static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
     }
 
     if (scaleMode != SDL_ScaleModeNearest) {
-        if (src->format->BytesPerPixel != 4 || src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+        if ((src->format->BytesPerPixel != 4 && src->format->BytesPerPixel != 2) ||
+            src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
             return SDL_SetError("Wrong format");
         }
     }
@@ -147,48 +151,6 @@ static int SDL_UpperSoftStretch(SDL_Surface *src, const SDL_Rect *srcrect,
 #define FRAC_ONE       (1 << PRECISION)
 #define FP_ONE         FIXED_POINT(1)
 
-#define BILINEAR___START                                                              \
-    int i;                                                                            \
-    Sint64 fp_sum_h;                                                                  \
-    int fp_step_h, left_pad_h, right_pad_h;                                           \
-    Sint64 fp_sum_w;                                                                  \
-    int fp_step_w, left_pad_w, right_pad_w;                                           \
-    Sint64 fp_sum_w_init;                                                             \
-    int left_pad_w_init, right_pad_w_init, dst_gap, middle_init;                      \
-    get_scaler_datas(src_h, dst_h, &fp_sum_h, &fp_step_h, &left_pad_h, &right_pad_h); \
-    get_scaler_datas(src_w, dst_w, &fp_sum_w, &fp_step_w, &left_pad_w, &right_pad_w); \
-    fp_sum_w_init = fp_sum_w + left_pad_w * fp_step_w;                                \
-    left_pad_w_init = left_pad_w;                                                     \
-    right_pad_w_init = right_pad_w;                                                   \
-    dst_gap = dst_pitch - 4 * dst_w;                                                  \
-    middle_init = dst_w - left_pad_w - right_pad_w;
-
-#define BILINEAR___HEIGHT                                              \
-    int index_h, frac_h0, frac_h1, middle;                             \
-    const Uint32 *src_h0, *src_h1;                                     \
-    int no_padding;                                                    \
-    Uint64 incr_h0, incr_h1;                                           \
-                                                                       \
-    no_padding = !(i < left_pad_h || i > dst_h - 1 - right_pad_h);     \
-    index_h = SRC_INDEX(fp_sum_h);                                     \
-    frac_h0 = FRAC(fp_sum_h);                                          \
-                                                                       \
-    index_h = no_padding ? index_h : (i < left_pad_h ? 0 : src_h - 1); \
-    frac_h0 = no_padding ? frac_h0 : 0;                                \
-    incr_h1 = no_padding ? src_pitch : 0;                              \
-    incr_h0 = (Uint64)index_h * src_pitch;                             \
-                                                                       \
-    src_h0 = (const Uint32 *)((const Uint8 *)src + incr_h0);           \
-    src_h1 = (const Uint32 *)((const Uint8 *)src_h0 + incr_h1);        \
-                                                                       \
-    fp_sum_h += fp_step_h;                                             \
-                                                                       \
-    frac_h1 = FRAC_ONE - frac_h0;                                      \
-    fp_sum_w = fp_sum_w_init;                                          \
-    right_pad_w = right_pad_w_init;                                    \
-    left_pad_w = left_pad_w_init;                                      \
-    middle = middle_init;
-
 #if defined(__clang__)
 // Remove inlining of this function
 // Compiler crash with clang 9.0.8 / android-ndk-r21d
@@ -238,41 +200,17 @@ static void get_scaler_datas(int src_nb, int dst_nb, Sint64 *fp_start, int *fp_s
     //    SDL_Log("%d -> %d  x0=%d step=%d left_pad=%d right_pad=%d", src_nb, dst_nb, *fp_start, *fp_step, *left_pad, *right_pad);
 }
 
-typedef struct color_t
-{
-    Uint8 a;
-    Uint8 b;
-    Uint8 c;
-    Uint8 d;
-} color_t;
-
-#if 0
-static void printf_64(const char *str, void *var)
-{
-    uint8_t *val = (uint8_t*) var;
-    printf(" *   %s: %02x %02x %02x %02x _ %02x %02x %02x %02x\n",
-           str, val[0], val[1], val[2], val[3], val[4], val[5], val[6], val[7]);
-}
-#endif
-
 /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
 
 static SDL_INLINE void INTERPOL(const Uint32 *src_x0, const Uint32 *src_x1, int frac0, int frac1, Uint32 *dst)
 {
-    const color_t *c0 = (const color_t *)src_x0;
-    const color_t *c1 = (const color_t *)src_x1;
-    color_t *cx = (color_t *)dst;
-#if 0
-    cx->a = c0->a + INTEGER(frac0 * (c1->a - c0->a));
-    cx->b = c0->b + INTEGER(frac0 * (c1->b - c0->b));
-    cx->c = c0->c + INTEGER(frac0 * (c1->c - c0->c));
-    cx->d = c0->d + INTEGER(frac0 * (c1->d - c0->d));
-#else
-    cx->a = INTEGER(frac1 * c0->a + frac0 * c1->a);
-    cx->b = INTEGER(frac1 * c0->b + frac0 * c1->b);
-    cx->c = INTEGER(frac1 * c0->c + frac0 * c1->c);
-    cx->d = INTEGER(frac1 * c0->d + frac0 * c1->d);
-#endif
+    /* Two channels at a time, 255 * FRAC_ONE fits in the 16 bits each one has */
+    const Uint32 c0 = *src_x0;
+    const Uint32 c1 = *src_x1;
+    const Uint32 bd = INTEGER((c0 & 0x00FF00FF) * (Uint32)frac1 + (c1 & 0x00FF00FF) * (Uint32)frac0) & 0x00FF00FF;
+    const Uint32 ac = INTEGER(((c0 >> 8) & 0x00FF00FF) * (Uint32)frac1 + ((c1 >> 8) & 0x00FF00FF) * (Uint32)frac0) & 0x00FF00FF;
+
+    *dst = bd | (ac << 8);
 }
 
 static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int frac_w0, int frac_h0, int frac_h1, Uint32 *dst)
@@ -288,53 +226,32 @@ static SDL_INLINE void INTERPOL_BILINEAR(const Uint32 *s0, const Uint32 *s1, int
     INTERPOL(tmp, tmp + 1, frac_w0, frac_w1, dst);
 }
 
-static int scale_mat(const Uint32 *src, int src_w, int src_h, int src_pitch,
-                     Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
-{
-    BILINEAR___START
-
-    for (i = 0; i < dst_h; i++) {
-
-        BILINEAR___HEIGHT
-
-        while (left_pad_w--) {
-            INTERPOL_BILINEAR(src_h0, src_h1, FRAC_ZERO, frac_h0, frac_h1, dst);
-            dst += 1;
-        }
-
-        while (middle--) {
-            const Uint32 *s_00_01;
-            const Uint32 *s_10_11;
-            int index_w = 4 * SRC_INDEX(fp_sum_w);
-            int frac_w = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-
-            /*
-                        x00 ... x0_ ..... x01
-                        .       .         .
-                        .       x         .
-                        .       .         .
-                        .       .         .
-                        x10 ... x1_ ..... x11
-            */
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-
-            INTERPOL_BILINEAR(s_00_01, s_10_11, frac_w, frac_h0, frac_h1, dst);
-
-            dst += 1;
-        }
+/* Scales one destination row from the rows 's0' and 's1' of 32-bit pixels, 'frac_h0' is the weight of 's1'.
+   'columns' has the byte offset of the left pixel of the pair each destination pixel is interpolated from,
+   'weights' has their weights as (FRAC_ONE - frac) | (frac << 16), the layout _mm_madd_epi16() wants. */
+typedef void (*SDL_StretchLinearRowFunc)(const Uint32 *s0, const Uint32 *s1, int frac_h0,
+                                         const Uint32 *columns, const Uint32 *weights, Uint32 *dst, int dst_w);
 
-        while (right_pad_w--) {
-            int index_w = 4 * (src_w - 2);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR(s_00_01, s_10_11, FRAC_ONE, frac_h0, frac_h1, dst);
-            dst += 1;
-        }
-        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+static void scale_row(const Uint32 *s0, const Uint32 *s1, int frac_h0,
+                      const Uint32 *columns, const Uint32 *weights, Uint32 *dst, int dst_w)
+{
+    const int frac_h1 = FRAC_ONE - frac_h0;
+    int x;
+
+    for (x = 0; x < dst_w; x++) {
+        /*
+                    x00 ... x0_ ..... x01
+                    .       .         .
+                    .       x         .
+                    .       .         .
+                    .       .         .
+                    x10 ... x1_ ..... x11
+        */
+        const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)s0 + columns[x]);
+        const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)s1 + columns[x]);
+
+        INTERPOL_BILINEAR(s_00_01, s_10_11, weights[x] >> 16, frac_h0, frac_h1, dst + x);
     }
-    return 0;
 }
 
 #if defined(__SSE2__)
@@ -367,25 +284,12 @@ static void printf_128(const char *str, __m128i var)
 }
 #endif
 
-static SDL_INLINE int hasSSE2()
-{
-    static int val = -1;
-    if (val != -1) {
-        return val;
-    }
-    val = SDL_HasSSE2();
-    return val;
-}
-
-static SDL_INLINE void INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1, int frac_w, __m128i v_frac_h0, __m128i v_frac_h1, Uint32 *dst, __m128i zero)
+static SDL_INLINE void INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1, Uint32 weights, __m128i v_frac_h0, __m128i v_frac_h1, Uint32 *dst, __m128i zero)
 {
     __m128i x_00_01, x_10_11; /* Pixels in 4*uint8 in row */
     __m128i v_frac_w0, k0, l0, d0, e0;
 
-    int f, f2;
-    f = frac_w;
-    f2 = FRAC_ONE - frac_w;
-    v_frac_w0 = _mm_set_epi16(f, f2, f, f2, f, f2, f, f2);
+    v_frac_w0 = _mm_set1_epi32((int)weights);
 
     x_00_01 = _mm_loadl_epi64((const __m128i *)s0); /* Load x00 and x01 */
     x_10_11 = _mm_loadl_epi64((const __m128i *)s1);
@@ -414,137 +318,131 @@ static SDL_INLINE void INTERPOL_BILINEAR_SSE(const Uint32 *s0, const Uint32 *s1,
     *dst = _mm_cvtsi128_si32(e0);
 }
 
-static int scale_mat_SSE(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static void scale_row_SSE(const Uint32 *s0, const Uint32 *s1, int frac_h0,
+                          const Uint32 *columns, const Uint32 *weights, Uint32 *dst, int dst_w)
 {
-    BILINEAR___START
-
-    for (i = 0; i < dst_h; i++) {
-        int nb_block2;
-        __m128i v_frac_h0;
-        __m128i v_frac_h1;
-        __m128i zero;
-
-        BILINEAR___HEIGHT
-
-        nb_block2 = middle / 2;
-
-        v_frac_h0 = _mm_set_epi16(frac_h0, frac_h0, frac_h0, frac_h0, frac_h0, frac_h0, frac_h0, frac_h0);
-        v_frac_h1 = _mm_set_epi16(frac_h1, frac_h1, frac_h1, frac_h1, frac_h1, frac_h1, frac_h1, frac_h1);
-        zero = _mm_setzero_si128();
-
-        while (left_pad_w--) {
-            INTERPOL_BILINEAR_SSE(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst, zero);
-            dst += 1;
-        }
-
-        while (nb_block2--) {
-            int index_w_0, frac_w_0;
-            int index_w_1, frac_w_1;
-
-            const Uint32 *s_00_01, *s_02_03, *s_10_11, *s_12_13;
-
-            __m128i x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
-            __m128i v_frac_w0, k0, l0, d0, e0;
-            __m128i v_frac_w1, k1, l1, d1, e1;
-
-            int f, f2;
-            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_0 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_1 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            /*
-                        x00............ x01   x02...........x03
-                        .      .         .     .       .     .
-                        j0     f0        j1    j2      f1    j3
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        x10............ x11   x12...........x13
-             */
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_0);
-            s_02_03 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_1);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_0);
-            s_12_13 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_1);
-
-            f = frac_w_0;
-            f2 = FRAC_ONE - frac_w_0;
-            v_frac_w0 = _mm_set_epi16(f, f2, f, f2, f, f2, f, f2);
-
-            f = frac_w_1;
-            f2 = FRAC_ONE - frac_w_1;
-            v_frac_w1 = _mm_set_epi16(f, f2, f, f2, f, f2, f, f2);
-
-            x_00_01 = _mm_loadl_epi64((const __m128i *)s_00_01); /* Load x00 and x01 */
-            x_02_03 = _mm_loadl_epi64((const __m128i *)s_02_03);
-            x_10_11 = _mm_loadl_epi64((const __m128i *)s_10_11);
-            x_12_13 = _mm_loadl_epi64((const __m128i *)s_12_13);
-
-            /* Interpolation vertical */
-            k0 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_00_01, zero), v_frac_h1);
-            l0 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_10_11, zero), v_frac_h0);
-            k0 = _mm_add_epi16(k0, l0);
-            k1 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_02_03, zero), v_frac_h1);
-            l1 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_12_13, zero), v_frac_h0);
-            k1 = _mm_add_epi16(k1, l1);
-
-            /* Interpolation horizontal */
-            l0 = _mm_unpacklo_epi64(/* unused */ l0, k0);
-            k0 = _mm_madd_epi16(_mm_unpackhi_epi16(l0, k0), v_frac_w0);
-            l1 = _mm_unpacklo_epi64(/* unused */ l1, k1);
-            k1 = _mm_madd_epi16(_mm_unpackhi_epi16(l1, k1), v_frac_w1);
-
-            /* Store 1 pixel */
-            d0 = _mm_srli_epi32(k0, PRECISION * 2);
-            e0 = _mm_packs_epi32(d0, d0);
-            e0 = _mm_packus_epi16(e0, e0);
-            *dst++ = _mm_cvtsi128_si32(e0);
-
-            /* Store 1 pixel */
-            d1 = _mm_srli_epi32(k1, PRECISION * 2);
-            e1 = _mm_packs_epi32(d1, d1);
-            e1 = _mm_packus_epi16(e1, e1);
-            *dst++ = _mm_cvtsi128_si32(e1);
-        }
-
-        /* Last point */
-        if (middle & 0x1) {
-            const Uint32 *s_00_01;
-            const Uint32 *s_10_11;
-            int index_w = 4 * SRC_INDEX(fp_sum_w);
-            int frac_w = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst, zero);
-            dst += 1;
-        }
+    const __m128i v_frac_h0 = _mm_set1_epi16((short)frac_h0);
+    const __m128i v_frac_h1 = _mm_set1_epi16((short)(FRAC_ONE - frac_h0));
+    const __m128i zero = _mm_setzero_si128();
+    int x;
+
+    for (x = 0; x + 2 <= dst_w; x += 2) {
+        const Uint32 *s_00_01, *s_02_03, *s_10_11, *s_12_13;
+
+        __m128i x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
+        __m128i v_frac_w0, k0, l0, d0, e0;
+        __m128i v_frac_w1, k1, l1, d1, e1;
+
+        /*
+                    x00............ x01   x02...........x03
+                    .      .         .     .       .     .
+                    j0     f0        j1    j2      f1    j3
+                    .      .         .     .       .     .
+                    .      .         .     .       .     .
+                    .      .         .     .       .     .
+                    x10............ x11   x12...........x13
+         */
+        s_00_01 = (const Uint32 *)((const Uint8 *)s0 + columns[x]);
+        s_02_03 = (const Uint32 *)((const Uint8 *)s0 + columns[x + 1]);
+        s_10_11 = (const Uint32 *)((const Uint8 *)s1 + columns[x]);
+        s_12_13 = (const Uint32 *)((const Uint8 *)s1 + columns[x + 1]);
+
+        v_frac_w0 = _mm_set1_epi32((int)weights[x]);
+        v_frac_w1 = _mm_set1_epi32((int)weights[x + 1]);
+
+        x_00_01 = _mm_loadl_epi64((const __m128i *)s_00_01); /* Load x00 and x01 */
+        x_02_03 = _mm_loadl_epi64((const __m128i *)s_02_03);
+        x_10_11 = _mm_loadl_epi64((const __m128i *)s_10_11);
+        x_12_13 = _mm_loadl_epi64((const __m128i *)s_12_13);
+
+        /* Interpolation vertical */
+        k0 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_00_01, zero), v_frac_h1);
+        l0 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_10_11, zero), v_frac_h0);
+        k0 = _mm_add_epi16(k0, l0);
+        k1 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_02_03, zero), v_frac_h1);
+        l1 = _mm_mullo_epi16(_mm_unpacklo_epi8(x_12_13, zero), v_frac_h0);
+        k1 = _mm_add_epi16(k1, l1);
+
+        /* Interpolation horizontal */
+        l0 = _mm_unpacklo_epi64(/* unused */ l0, k0);
+        k0 = _mm_madd_epi16(_mm_unpackhi_epi16(l0, k0), v_frac_w0);
+        l1 = _mm_unpacklo_epi64(/* unused */ l1, k1);
+        k1 = _mm_madd_epi16(_mm_unpackhi_epi16(l1, k1), v_frac_w1);
+
+        /* Store 1 pixel */
+        d0 = _mm_srli_epi32(k0, PRECISION * 2);
+        e0 = _mm_packs_epi32(d0, d0);
+        e0 = _mm_packus_epi16(e0, e0);
+        dst[x] = _mm_cvtsi128_si32(e0);
+
+        /* Store 1 pixel */
+        d1 = _mm_srli_epi32(k1, PRECISION * 2);
+        e1 = _mm_packs_epi32(d1, d1);
+        e1 = _mm_packus_epi16(e1, e1);
+        dst[x + 1] = _mm_cvtsi128_si32(e1);
+    }
 
-        while (right_pad_w--) {
-            int index_w = 4 * (src_w - 2);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst, zero);
-            dst += 1;
-        }
-        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+    /* Last point */
+    if (x < dst_w) {
+        const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)s0 + columns[x]);
+        const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)s1 + columns[x]);
+        INTERPOL_BILINEAR_SSE(s_00_01, s_10_11, weights[x], v_frac_h0, v_frac_h1, dst + x, zero);
     }
-    return 0;
 }
 #endif
 
-#if defined(HAVE_NEON_INTRINSICS)
-
-static SDL_INLINE int hasNEON(void)
+#if defined(SDL_AVX2_INTRINSICS) && defined(HAVE_SSE2_INTRINSICS)
+/* The arithmetic of scale_row_SSE(), 4 pixels at a time, so the results are the same */
+SDL_TARGETING("avx2") static void scale_row_AVX2(const Uint32 *s0, const Uint32 *s1, int frac_h0,
+                           const Uint32 *columns, const Uint32 *weights, Uint32 *dst, int dst_w)
 {
-    static int val = -1;
-    if (val != -1) {
-        return val;
+    const __m256i v_frac_h0 = _mm256_set1_epi16((short)frac_h0);
+    const __m256i v_frac_h1 = _mm256_set1_epi16((short)(FRAC_ONE - frac_h0));
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i even_weights = _mm256_setr_epi32(0, 0, 0, 0, 2, 2, 2, 2);
+    const __m256i odd_weights = _mm256_setr_epi32(1, 1, 1, 1, 3, 3, 3, 3);
+    int x;
+
+    for (x = 0; x + 4 <= dst_w; x += 4) {
+        const Uint8 *p0 = (const Uint8 *)s0;
+        const Uint8 *p1 = (const Uint8 *)s1;
+        __m256i x0, x1, k_even, k_odd, w, e;
+
+        /* The pairs of pixels x and x + 1 in the low lane, x + 2 and x + 3 in the high lane */
+        x0 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p0 + columns[x])), _mm_loadl_epi64((const __m128i *)(p0 + columns[x + 1])))),
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p0 + columns[x + 2])), _mm_loadl_epi64((const __m128i *)(p0 + columns[x + 3]))), 1);
+        x1 = _mm256_inserti128_si256(_mm256_castsi128_si256(
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p1 + columns[x])), _mm_loadl_epi64((const __m128i *)(p1 + columns[x + 1])))),
+            _mm_unpacklo_epi64(_mm_loadl_epi64((const __m128i *)(p1 + columns[x + 2])), _mm_loadl_epi64((const __m128i *)(p1 + columns[x + 3]))), 1);
+
+        /* Interpolation vertical, pixels x and x + 2, then x + 1 and x + 3 */
+        k_even = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpacklo_epi8(x0, zero), v_frac_h1),
+                                  _mm256_mullo_epi16(_mm256_unpacklo_epi8(x1, zero), v_frac_h0));
+        k_odd = _mm256_add_epi16(_mm256_mullo_epi16(_mm256_unpackhi_epi8(x0, zero), v_frac_h1),
+                                 _mm256_mullo_epi16(_mm256_unpackhi_epi8(x1, zero), v_frac_h0));
+
+        /* Interpolation horizontal, each channel of the left pixel next to the same one of the right pixel */
+        w = _mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)(weights + x)));
+        k_even = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_even, _mm256_srli_si256(k_even, 8)),
+                                   _mm256_permutevar8x32_epi32(w, even_weights));
+        k_odd = _mm256_madd_epi16(_mm256_unpacklo_epi16(k_odd, _mm256_srli_si256(k_odd, 8)),
+                                  _mm256_permutevar8x32_epi32(w, odd_weights));
+
+        /* Store 4 pixels, packing leaves x, x + 1 in the low lane and x + 2, x + 3 in the high lane */
+        e = _mm256_packs_epi32(_mm256_srli_epi32(k_even, PRECISION * 2), _mm256_srli_epi32(k_odd, PRECISION * 2));
+        e = _mm256_packus_epi16(e, e);
+        e = _mm256_permute4x64_epi64(e, 0x08);
+        _mm_storeu_si128((__m128i *)(dst + x), _mm256_castsi256_si128(e));
+    }
+
+    if (x < dst_w) {
+        scale_row_SSE(s0, s1, frac_h0, columns + x, weights + x, dst + x, dst_w - x);
     }
-    val = SDL_HasNEON();
-    return val;
 }
+#endif
+
+#if defined(HAVE_NEON_INTRINSICS)
 
 static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1, int frac_w, uint8x8_t v_frac_h0, uint8x8_t v_frac_h1, Uint32 *dst)
 {
@@ -578,253 +476,567 @@ static SDL_INLINE void INTERPOL_BILINEAR_NEON(const Uint32 *s0, const Uint32 *s1
     *dst = vget_lane_u32(CAST_uint32x2_t e0, 0);
 }
 
-static int scale_mat_NEON(const Uint32 *src, int src_w, int src_h, int src_pitch, Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+static void scale_row_NEON(const Uint32 *s0, const Uint32 *s1, int frac_h0,
+                           const Uint32 *columns, const Uint32 *weights, Uint32 *dst, int dst_w)
 {
-    BILINEAR___START
-
-    for (i = 0; i < dst_h; i++) {
-        int nb_block4;
-        uint8x8_t v_frac_h0, v_frac_h1;
+    const uint8x8_t v_frac_h0 = vmov_n_u8(frac_h0);
+    const uint8x8_t v_frac_h1 = vmov_n_u8(FRAC_ONE - frac_h0);
+    int x;
+
+    for (x = 0; x + 4 <= dst_w; x += 4) {
+        const int frac_w_0 = weights[x] >> 16;
+        const int frac_w_1 = weights[x + 1] >> 16;
+        const int frac_w_2 = weights[x + 2] >> 16;
+        const int frac_w_3 = weights[x + 3] >> 16;
+
+        const Uint32 *s_00_01, *s_02_03, *s_04_05, *s_06_07;
+        const Uint32 *s_10_11, *s_12_13, *s_14_15, *s_16_17;
+
+        uint8x8_t x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
+        uint8x8_t x_04_05, x_14_15, x_06_07, x_16_17;
+
+        uint16x8_t k0, k1, k2, k3;
+        uint32x4_t l0, l1, l2, l3;
+        uint16x8_t d0, d1;
+        uint8x8_t e0, e1;
+        uint32x4_t f0;
+
+        s_00_01 = (const Uint32 *)((const Uint8 *)s0 + columns[x]);
+        s_02_03 = (const Uint32 *)((const Uint8 *)s0 + columns[x + 1]);
+        s_04_05 = (const Uint32 *)((const Uint8 *)s0 + columns[x + 2]);
+        s_06_07 = (const Uint32 *)((const Uint8 *)s0 + columns[x + 3]);
+        s_10_11 = (const Uint32 *)((const Uint8 *)s1 + columns[x]);
+        s_12_13 = (const Uint32 *)((const Uint8 *)s1 + columns[x + 1]);
+        s_14_15 = (const Uint32 *)((const Uint8 *)s1 + columns[x + 2]);
+        s_16_17 = (const Uint32 *)((const Uint8 *)s1 + columns[x + 3]);
+
+        /* Interpolation vertical */
+        x_00_01 = CAST_uint8x8_t vld1_u32(s_00_01); /* Load 2 pixels */
+        x_02_03 = CAST_uint8x8_t vld1_u32(s_02_03);
+        x_04_05 = CAST_uint8x8_t vld1_u32(s_04_05);
+        x_06_07 = CAST_uint8x8_t vld1_u32(s_06_07);
+        x_10_11 = CAST_uint8x8_t vld1_u32(s_10_11);
+        x_12_13 = CAST_uint8x8_t vld1_u32(s_12_13);
+        x_14_15 = CAST_uint8x8_t vld1_u32(s_14_15);
+        x_16_17 = CAST_uint8x8_t vld1_u32(s_16_17);
+
+        /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
+        k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
+        k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
+
+        k1 = vmull_u8(x_02_03, v_frac_h1);
+        k1 = vmlal_u8(k1, x_12_13, v_frac_h0);
+
+        k2 = vmull_u8(x_04_05, v_frac_h1);
+        k2 = vmlal_u8(k2, x_14_15, v_frac_h0);
+
+        k3 = vmull_u8(x_06_07, v_frac_h1);
+        k3 = vmlal_u8(k3, x_16_17, v_frac_h0);
+
+        /* k0 now contains 2 interpolated pixels { j0, j1 } */
+        /* k1 now contains 2 interpolated pixels { j2, j3 } */
+        /* k2 now contains 2 interpolated pixels { j4, j5 } */
+        /* k3 now contains 2 interpolated pixels { j6, j7 } */
+
+        l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
+        l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w_0);
+        l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w_0);
+
+        l1 = vshll_n_u16(vget_low_u16(k1), PRECISION);
+        l1 = vmlsl_n_u16(l1, vget_low_u16(k1), frac_w_1);
+        l1 = vmlal_n_u16(l1, vget_high_u16(k1), frac_w_1);
+
+        l2 = vshll_n_u16(vget_low_u16(k2), PRECISION);
+        l2 = vmlsl_n_u16(l2, vget_low_u16(k2), frac_w_2);
+        l2 = vmlal_n_u16(l2, vget_high_u16(k2), frac_w_2);
+
+        l3 = vshll_n_u16(vget_low_u16(k3), PRECISION);
+        l3 = vmlsl_n_u16(l3, vget_low_u16(k3), frac_w_3);
+        l3 = vmlal_n_u16(l3, vget_high_u16(k3), frac_w_3);
+
+        /* shift and narrow */
+        d0 = vcombine_u16(
+            /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
+            /* uint16x4_t */ vshrn_n_u32(l1, 2 * PRECISION));
+        /* narrow again */
+        e0 = vmovn_u16(d0);
+
+        /* Shift and narrow */
+        d1 = vcombine_u16(
+            /* uint16x4_t */ vshrn_n_u32(l2, 2 * PRECISION),
+            /* uint16x4_t */ vshrn_n_u32(l3, 2 * PRECISION));
+        /* Narrow again */
+        e1 = vmovn_u16(d1);
+
+        f0 = vcombine_u32(CAST_uint32x2_t e0, CAST_uint32x2_t e1);
+        /* Store 4 pixels */
+        vst1q_u32(dst + x, f0);
+    }
 
-        BILINEAR___HEIGHT
+    /* Last points */
+    for (; x < dst_w; x++) {
+        const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)s0 + columns[x]);
+        const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)s1 + columns[x]);
+        INTERPOL_BILINEAR_NEON(s_00_01, s_10_11, weights[x] >> 16, v_frac_h0, v_frac_h1, dst + x);
+    }
+}
+#endif
 
-        nb_block4 = middle / 4;
+static SDL_StretchLinearRowFunc SDL_ChooseStretchLinearRow(int features)
+{
+#if defined(SDL_AVX2_INTRINSICS) && defined(HAVE_SSE2_INTRINSICS)
+    if (features & SDL_CPU_AVX2) {
+        return scale_row_AVX2;
+    }
+#endif
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (features & SDL_CPU_SSE2) {
+        return scale_row_SSE;
+    }
+#endif
+#if defined(HAVE_NEON_INTRINSICS)
+    if (features & SDL_CPU_NEON) {
+        return scale_row_NEON;
+    }
+#endif
+    (void)features;
+    return scale_row;
+}
 
-        v_frac_h0 = vmov_n_u8(frac_h0);
-        v_frac_h1 = vmov_n_u8(frac_h1);
+typedef struct
+{
+    const Uint32 *src;
+    int src_w;
+    int src_h;
+    int src_pitch;
+    Uint32 *dst;
+    int dst_w;
+    int dst_h;
+    int dst_pitch;
+    int bpp;
+
+    /* Filtered scaling only */
+    const SDL_PixelFormat *format;
+    int cpu_features;
+    SDL_bool area;
+    Uint32 *columns; /* Bilinear: byte offset of the left pixel, area averaging: first column */
+    Uint32 *weights; /* Bilinear: weights of the left and right pixels, area averaging: number of columns */
+    SDL_StretchLinearRowFunc scale_row;
+    SDL_StretchRowFunc row_func;
+    void *row_data;
+    SDL_atomic_t failed; /* Set by bands that couldn't allocate their rows */
+} SDL_StretchBands;
+
+/* Filtering reads 16-bit pixels and single columns, which have no right neighbor, from 32-bit copies of the rows */
+#define STRETCH_COPY_ROWS(bands) ((bands)->bpp != 4 || (bands)->src_w < 2)
+
+/* Copies source row 'y' to 32-bit pixels, one channel per byte, and repeats its last pixel */
+static void SDL_CopyStretchRow(const SDL_StretchBands *bands, int y, Uint32 *row)
+{
+    const Uint8 *src = (const Uint8 *)bands->src + (size_t)y * bands->src_pitch;
+    const int src_w = bands->src_w;
+    int x;
 
-        while (left_pad_w--) {
-            INTERPOL_BILINEAR_NEON(src_h0, src_h1, FRAC_ZERO, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+    if (bands->bpp == 4) {
+        SDL_memcpy(row, src, (size_t)src_w * 4);
+    } else {
+        const SDL_PixelFormat *fmt = bands->format;
+        const Uint8 *Rexpand = SDL_expand_byte[fmt->Rloss];
+        const Uint8 *Gexpand = SDL_expand_byte[fmt->Gloss];
+        const Uint8 *Bexpand = SDL_expand_byte[fmt->Bloss];
+        const Uint8 *Aexpand = SDL_expand_byte[fmt->Aloss];
+        const Uint32 Rmask = fmt->Rmask, Gmask = fmt->Gmask, Bmask = fmt->Bmask, Amask = fmt->Amask;
+        const int Rshift = fmt->Rshift, Gshift = fmt->Gshift, Bshift = fmt->Bshift, Ashift = fmt->Ashift;
+
+        for (x = 0; x < src_w; x++) {
+            const Uint32 pixel = ((const Uint16 *)src)[x];
+
+            row[x] = Rexpand[(pixel & Rmask) >> Rshift] |
+                     ((Uint32)Gexpand[(pixel & Gmask) >> Gshift] << 8) |
+                     ((Uint32)Bexpand[(pixel & Bmask) >> Bshift] << 16);
         }
+        if (Amask) {
+            for (x = 0; x < src_w; x++) {
+                const Uint32 pixel = ((const Uint16 *)src)[x];
 
-        while (nb_block4--) {
-            int index_w_0, frac_w_0;
-            int index_w_1, frac_w_1;
-            int index_w_2, frac_w_2;
-            int index_w_3, frac_w_3;
-
-            const Uint32 *s_00_01, *s_02_03, *s_04_05, *s_06_07;
-            const Uint32 *s_10_11, *s_12_13, *s_14_15, *s_16_17;
-
-            uint8x8_t x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
-            uint8x8_t x_04_05, x_14_15, x_06_07, x_16_17;
-
-            uint16x8_t k0, k1, k2, k3;
-            uint32x4_t l0, l1, l2, l3;
-            uint16x8_t d0, d1;
-            uint8x8_t e0, e1;
-            uint32x4_t f0;
-
-            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_0 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_1 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_2 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_2 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_3 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_3 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_0);
-            s_02_03 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_1);
-            s_04_05 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_2);
-            s_06_07 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_3);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_0);
-            s_12_13 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_1);
-            s_14_15 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_2);
-            s_16_17 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_3);
-
-            /* Interpolation vertical */
-            x_00_01 = CAST_uint8x8_t vld1_u32(s_00_01); /* Load 2 pixels */
-            x_02_03 = CAST_uint8x8_t vld1_u32(s_02_03);
-            x_04_05 = CAST_uint8x8_t vld1_u32(s_04_05);
-            x_06_07 = CAST_uint8x8_t vld1_u32(s_06_07);
-            x_10_11 = CAST_uint8x8_t vld1_u32(s_10_11);
-            x_12_13 = CAST_uint8x8_t vld1_u32(s_12_13);
-            x_14_15 = CAST_uint8x8_t vld1_u32(s_14_15);
-            x_16_17 = CAST_uint8x8_t vld1_u32(s_16_17);
-
-            /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
-            k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
-            k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
-
-            k1 = vmull_u8(x_02_03, v_frac_h1);
-            k1 = vmlal_u8(k1, x_12_13, v_frac_h0);
-
-            k2 = vmull_u8(x_04_05, v_frac_h1);
-            k2 = vmlal_u8(k2, x_14_15, v_frac_h0);
-
-            k3 = vmull_u8(x_06_07, v_frac_h1);
-            k3 = vmlal_u8(k3, x_16_17, v_frac_h0);
-
-            /* k0 now contains 2 interpolated pixels { j0, j1 } */
-            /* k1 now contains 2 interpolated pixels { j2, j3 } */
-            /* k2 now contains 2 interpolated pixels { j4, j5 } */
-            /* k3 now contains 2 interpolated pixels { j6, j7 } */
-
-            l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
-            l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w_0);
-            l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w_0);
-
-            l1 = vshll_n_u16(vget_low_u16(k1), PRECISION);
-            l1 = vmlsl_n_u16(l1, vget_low_u16(k1), frac_w_1);
-            l1 = vmlal_n_u16(l1, vget_high_u16(k1), frac_w_1);
-
-            l2 = vshll_n_u16(vget_low_u16(k2), PRECISION);
-            l2 = vmlsl_n_u16(l2, vget_low_u16(k2), frac_w_2);
-            l2 = vmlal_n_u16(l2, vget_high_u16(k2), frac_w_2);
-
-            l3 = vshll_n_u16(vget_low_u16(k3), PRECISION);
-            l3 = vmlsl_n_u16(l3, vget_low_u16(k3), frac_w_3);
-            l3 = vmlal_n_u16(l3, vget_high_u16(k3), frac_w_3);
-
-            /* shift and narrow */
-            d0 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l1, 2 * PRECISION));
-            /* narrow again */
-            e0 = vmovn_u16(d0);
-
-            /* Shift and narrow */
-            d1 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l2, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l3, 2 * PRECISION));
-            /* Narrow again */
-            e1 = vmovn_u16(d1);
-
-            f0 = vcombine_u32(CAST_uint32x2_t e0, CAST_uint32x2_t e1);
-            /* Store 4 pixels */
-            vst1q_u32(dst, f0);
-
-            dst += 4;
+                row[x] |= (Uint32)Aexpand[(pixel & Amask) >> Ashift] << 24;
+            }
         }
+    }
+    row[src_w] = row[src_w - 1];
+}
 
-        if (middle & 0x2) {
-            int index_w_0, frac_w_0;
-            int index_w_1, frac_w_1;
-            const Uint32 *s_00_01, *s_02_03;
-            const Uint32 *s_10_11, *s_12_13;
-            uint8x8_t x_00_01, x_10_11, x_02_03, x_12_13; /* Pixels in 4*uint8 in row */
-            uint16x8_t k0, k1;
-            uint32x4_t l0, l1;
-            uint16x8_t d0;
-            uint8x8_t e0;
-
-            index_w_0 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_0 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            index_w_1 = 4 * SRC_INDEX(fp_sum_w);
-            frac_w_1 = FRAC(fp_sum_w);
-            fp_sum_w += fp_step_w;
-            /*
-                        x00............ x01   x02...........x03
-                        .      .         .     .       .     .
-                        j0   dest0       j1    j2    dest1   j3
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        .      .         .     .       .     .
-                        x10............ x11   x12...........x13
-            */
-            s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_0);
-            s_02_03 = (const Uint32 *)((const Uint8 *)src_h0 + index_w_1);
-            s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_0);
-            s_12_13 = (const Uint32 *)((const Uint8 *)src_h1 + index_w_1);
-
-            /* Interpolation vertical */
-            x_00_01 = CAST_uint8x8_t vld1_u32(s_00_01); /* Load 2 pixels */
-            x_02_03 = CAST_uint8x8_t vld1_u32(s_02_03);
-            x_10_11 = CAST_uint8x8_t vld1_u32(s_10_11);
-            x_12_13 = CAST_uint8x8_t vld1_u32(s_12_13);
-
-            /* Interpolated == x0 + frac * (x1 - x0) == x0 * (1 - frac) + x1 * frac */
-            k0 = vmull_u8(x_00_01, v_frac_h1);     /* k0 := x0 * (1 - frac)    */
-            k0 = vmlal_u8(k0, x_10_11, v_frac_h0); /* k0 += x1 * frac          */
-
-            k1 = vmull_u8(x_02_03, v_frac_h1);
-            k1 = vmlal_u8(k1, x_12_13, v_frac_h0);
-
-            /* k0 now contains 2 interpolated pixels { j0, j1 } */
-            /* k1 now contains 2 interpolated pixels { j2, j3 } */
-
-            l0 = vshll_n_u16(vget_low_u16(k0), PRECISION);
-            l0 = vmlsl_n_u16(l0, vget_low_u16(k0), frac_w_0);
-            l0 = vmlal_n_u16(l0, vget_high_u16(k0), frac_w_0);
-
-            l1 = vshll_n_u16(vget_low_u16(k1), PRECISION);
-            l1 = vmlsl_n_u16(l1, vget_low_u16(k1), frac_w_1);
-            l1 = vmlal_n_u16(l1, vget_high_u16(k1), frac_w_1);
-
-            /* Shift and narrow */
-
-            d0 = vcombine_u16(
-                /* uint16x4_t */ vshrn_n_u32(l0, 2 * PRECISION),
-                /* uint16x4_t */ vshrn_n_u32(l1, 2 * PRECISION));
-
-            /* Narrow again */
-            e0 = vmovn_u16(d0);
-
-            /* Store 2 pixels */
-            vst1_u32(dst, CAST_uint32x2_t e0);
-            dst += 2;
+/* Packs a row made by SDL_CopyStretchRow() back into 16-bit pixels */
+static void SDL_PackStretchRow(const SDL_StretchBands *bands, const Uint32 *row, Uint16 *dst)
+{
+    const SDL_PixelFormat *fmt = bands->format;
+    const int Rloss = fmt->Rloss, Gloss = fmt->Gloss, Bloss = fmt->Bloss, Aloss = fmt->Aloss;
+    const int Rshift = fmt->Rshift, Gshift = fmt->Gshift, Bshift = fmt->Bshift, Ashift = fmt->Ashift;
+    const int dst_w = bands->dst_w;
+    int x;
+
+    for (x = 0; x < dst_w; x++) {
+        const Uint32 value = row[x];
+
+        dst[x] = (Uint16)((((value & 0xFF) >> Rloss) << Rshift) |
+                          ((((value >> 8) & 0xFF) >> Gloss) << Gshift) |
+                          ((((value >> 16) & 0xFF) >> Bloss) << Bshift) |
+                          (((value >> 24) >> Aloss) << Ashift));
+    }
+}
+
+/* Hands a finished row over, and returns where the next one goes */
+static Uint8 *SDL_NextStretchRow(const SDL_StretchBands *bands, int y, Uint8 *dst)
+{
+    if (bands->row_func) {
+        return (Uint8 *)bands->row_func(bands->row_data, y, (Uint32 *)dst);
+    }
+    return dst + bands->dst_pitch;
+}
+
+/* Scales destination rows [y0, y1) with bilinear filtering */
+static int scale_mat_linear_rows(const SDL_StretchBands *bands, int y0, int y1)
+{
+    const SDL_bool copy_rows = STRETCH_COPY_ROWS(bands);
+    Uint8 *dst = (Uint8 *)bands->dst + (size_t)y0 * bands->dst_pitch;
+    Uint32 *tmp = NULL, *rows[2] = { NULL, NULL }, *out = NULL;
+    int rows_y[2] = { -1, -1 };
+    Sint64 fp_sum_h;
+    int fp_step_h, top_pad_h, bottom_pad_h;
+    int i;
+
+    if (copy_rows) {
+        tmp = (Uint32 *)SDL_malloc(sizeof(Uint32) * (2 * (bands->src_w + 1) + bands->dst_w));
+        if (!tmp) {
+            return SDL_OutOfMemory();
         }
+        rows[0] = tmp;
+        rows[1] = rows[0] + bands->src_w + 1;
+        out = rows[1] + bands->src_w + 1;
+    }
 
-        /* Last point */
-        if (middle & 0x1) {
-            int index_w = 4 * SRC_INDEX(fp_sum_w);
-            int frac_w = FRAC(fp_sum_w);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_NEON(s_00_01, s_10_11, frac_w, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+    get_scaler_datas(bands->src_h, bands->dst_h, &fp_sum_h, &fp_step_h, &top_pad_h, &bottom_pad_h);
+    fp_sum_h += (Sint64)y0 * fp_step_h;
+
+    for (i = y0; i < y1; i++, fp_sum_h += fp_step_h) {
+        int index_h, frac_h0, next_h;
+        const Uint32 *src_h0, *src_h1;
+
+        if (i < top_pad_h) {
+            index_h = 0;
+            frac_h0 = FRAC_ZERO;
+            next_h = 0;
+        } else if (i > bands->dst_h - 1 - bottom_pad_h) {
+            index_h = bands->src_h - 1;
+            frac_h0 = FRAC_ZERO;
+            next_h = 0;
+        } else {
+            index_h = SRC_INDEX(fp_sum_h);
+            frac_h0 = FRAC(fp_sum_h);
+            next_h = 1;
         }
 
-        while (right_pad_w--) {
-            int index_w = 4 * (src_w - 2);
-            const Uint32 *s_00_01 = (const Uint32 *)((const Uint8 *)src_h0 + index_w);
-            const Uint32 *s_10_11 = (const Uint32 *)((const Uint8 *)src_h1 + index_w);
-            INTERPOL_BILINEAR_NEON(s_00_01, s_10_11, FRAC_ONE, v_frac_h0, v_frac_h1, dst);
-            dst += 1;
+        if (copy_rows) {
+            /* Going down, the second row of one destination row is the first row of the next one */
+            if (rows_y[0] != index_h && rows_y[1] == index_h) {
+                Uint32 *row = rows[0];
+                rows[0] = rows[1];
+                rows[1] = row;
+                rows_y[1] = rows_y[0];
+                rows_y[0] = index_h;
+            }
+            if (rows_y[0] != index_h) {
+                SDL_CopyStretchRow(bands, index_h, rows[0]);
+                rows_y[0] = index_h;
+            }
+            if (next_h && rows_y[1] != index_h + 1) {
+                SDL_CopyStretchRow(bands, index_h + 1, rows[1]);
+                rows_y[1] = index_h + 1;
+            }
+            src_h0 = rows[0];
+            src_h1 = rows[next_h];
+        } else {
+            src_h0 = (const Uint32 *)((const Uint8 *)bands->src + (size_t)index_h * bands->src_pitch);
+            src_h1 = (const Uint32 *)((const Uint8 *)src_h0 + (next_h ? bands->src_pitch : 0));
         }
 
-        dst = (Uint32 *)((Uint8 *)dst + dst_gap);
+        if (bands->bpp == 4) {
+            bands->scale_row(src_h0, src_h1, frac_h0, bands->columns, bands->weights, (Uint32 *)dst, bands->dst_w);
+        } else {
+            bands->scale_row(src_h0, src_h1, frac_h0, bands->columns, bands->weights, out, bands->dst_w);
+            SDL_PackStretchRow(bands, out, (Uint16 *)dst);
+        }
+        dst = SDL_NextStretchRow(bands, i, dst);
     }
+
+    SDL_free(tmp);
     return 0;
 }
+
+/* Adds 'count' bytes to as many 16-bit sums, which holds 257 rows of them */
+#define STRETCH_SUM_ROWS 257
+
+static void SDL_SumStretchRow(const SDL_StretchBands *bands, const Uint8 *src, int count, Uint16 *sums)
+{
+    int i = 0;
+
+#if defined(HAVE_SSE2_INTRINSICS)
+    if (bands->cpu_features & SDL_CPU_SSE2) {
+        const __m128i zero = _mm_setzero_si128();
+
+        for (; i + 16 <= count; i += 16) {
+            const __m128i pixels = _mm_loadu_si128((const __m128i *)(src + i));
+            __m128i *s = (__m128i *)(sums + i);
+
+            _mm_storeu_si128(s, _mm_add_epi16(_mm_loadu_si128(s), _mm_unpacklo_epi8(pixels, zero)));
+            _mm_storeu_si128(s + 1, _mm_add_epi16(_mm_loadu_si128(s + 1), _mm_unpackhi_epi8(pixels, zero)));
+        }
+    }
 #endif
+    for (; i < count; i++) {
+        sums[i] = (Uint16)(sums[i] + src[i]);
+    }
+}
+
+/* Scales destination rows [y0, y1) down by averaging every source pixel under each destination pixel.
+   Bilinear filtering only reads 2x2 source pixels, so it skips some of them past a factor of 2. */
+static int scale_mat_area_rows(const SDL_StretchBands *bands, int y0, int y1)
+{
+    const int src_w = bands->src_w;
+    const int dst_w = bands->dst_w;
+    const int count = 4 * src_w;
+    const Uint32 min_columns = (Uint32)(src_w / dst_w);
+    Uint8 *dst = (Uint8 *)bands->dst + (size_t)y0 * bands->dst_pitch;
+    Uint32 *tmp, *sums, *row, *out;
+    Uint16 *partial;
+    int i, j, x, y, end_y;
+
+    tmp = (Uint32 *)SDL_malloc(sizeof(Uint32) * (count + src_w + 1 + dst_w) + sizeof(Uint16) * count);
+    if (!tmp) {
+        return SDL_OutOfMemory();
+    }
+    sums = tmp;
+    row = sums + count;
+    out = row + src_w + 1;
+    partial = (Uint16 *)(out + dst_w);
+
+    for (i = y0; i < y1; i++) {
+        const int first_y = (int)(((Sint64)i * bands->src_h) / bands->dst_h);
+        const int last_y = (int)(((Sint64)(i + 1) * bands->src_h) / bands->dst_h);
+        Uint8 *pixels = (bands->bpp == 4 && !bands->row_func) ? dst : (Uint8 *)out;
+        Uint64 counts[2];
+        Uint32 inverses[2];
+
+        /* Sum the columns, a few rows at a time in 16 bits */
+        for (y = first_y; y < last_y; y = end_y) {
+            end_y = SDL_min(y + STRETCH_SUM_ROWS, last_y);
+
+            SDL_memset(partial, 0, sizeof(Uint16) * count);
+            for (j = y; j < end_y; j++) {
+                if (bands->bpp == 4) {
+                    SDL_SumStretchRow(bands, (const Uint8 *)bands->src + (size_t)j * bands->src_pitch, count, partial);
+                } else {
+                    SDL_CopyStretchRow(bands, j, row);
+                    SDL_SumStretchRow(bands, (const Uint8 *)row, count, partial);
+                }
+            }
+            for (x = 0; x < count; x++) {
+                sums[x] = (y == first_y ? 0 : sums[x]) + partial[x];
+            }
+        }
+
+        /* Destination pixels cover one of two numbers of columns. Below 4096 pixels, multiplying
+           by 2^32 / count rounded up gives the exact quotient of sums up to 255 * count. */
+        for (x = 0; x < 2; x++) {
+            counts[x] = (Uint64)(min_columns + x) * (Uint64)(last_y - first_y);
+            inverses[x] = counts[x] < 4096 ? (Uint32)((SDL_MAX_UINT32 + counts[x]) / counts[x]) : 0;
+        }
+
+        for (x = 0; x < dst_w; x++) {
+            const Uint32 *s = sums + 4 * bands->columns[x];
+            const int n = (int)bands->weights[x];
+            const Uint64 total = counts[bands->weights[x] - min_columns];
+            const Uint32 inverse = inverses[bands->weights[x] - min_columns];
+            int c, k;
+
+            for (c = 0; c < 4; c++) {
+                Uint64 sum = total / 2;
+
+                for (k = 0; k < n; k++) {
+                    sum += s[4 * k + c];
+                }
+                pixels[4 * x + c] = (Uint8)(inverse ? ((sum * inverse) >> 32) : (sum / total));
+            }
+        }
+
+        if (bands->bpp != 4) {
+            SDL_PackStretchRow(bands, out, (Uint16 *)dst);
+        } else if (bands->row_func) {
+            SDL_memcpy(dst, out, (size_t)dst_w * 4);
+        }
+        dst = SDL_NextStretchRow(bands, i, dst);
+    }
+
+    SDL_free(tmp);
+    return 0;
+}
+
+/* Scales destination rows [y0, y1) */
+static int scale_mat_filtered_rows(const SDL_StretchBands *bands, int y0, int y1)
+{
+    if (bands->area) {
+        return scale_mat_area_rows(bands, y0, y1);
+    }
+    return scale_mat_linear_rows(bands, y0, y1);
+}
+
+static void SDL_StretchLinearBand(void *userdata, int start, int end)
+{
+    SDL_StretchBands *bands = (SDL_StretchBands *)userdata;
+
+    if (scale_mat_filtered_rows(bands, start, end) < 0) {
+        SDL_AtomicSet(&bands->failed, 1);
+    }
+}
+
+/* Works out the sampling of every destination column once, for all the rows.
+   The sizes in 'bands' must be set, the tables are freed with SDL_free(bands->columns). */
+static int SDL_SetupStretchLinear(SDL_StretchBands *bands, SDL_Surface *s, const SDL_Rect *srcrect)
+{
+    const int src_w = bands->src_w;
+    const int dst_w = bands->dst_w;
+    int x;
+
+    bands->format = s->format;
+    bands->bpp = s->format->BytesPerPixel;
+    bands->src_pitch = s->pitch;
+    bands->src = (const Uint32 *)((const Uint8 *)s->pixels + srcrect->x * bands->bpp + srcrect->y * bands->src_pitch);
+    bands->cpu_features = SDL_GetBlitCPUFeatures();
+    bands->area = (src_w > 2 * dst_w && bands->src_h > 2 * bands->dst_h &&
+                   SDL_GetHintBoolean(SDL_HINT_STRETCH_AREA_AVERAGE, SDL_FALSE));
+    bands->scale_row = SDL_ChooseStretchLinearRow(bands->cpu_features);
+    bands->columns = (Uint32 *)SDL_malloc(sizeof(Uint32) * 2 * dst_w);
+    if (!bands->columns) {
+        return SDL_OutOfMemory();
+    }
+    bands->weights = bands->columns + dst_w;
+
+    if (bands->area) {
+        for (x = 0; x < dst_w; x++) {
+            const int first_x = (int)(((Sint64)x * src_w) / dst_w);
+            const int last_x = (int)(((Sint64)(x + 1) * src_w) / dst_w);
+
+            bands->columns[x] = first_x;
+            bands->weights[x] = last_x - first_x;
+        }
+    } else {
+        Sint64 fp_sum_w;
+        int fp_step_w, left_pad_w, right_pad_w;
+
+        get_scaler_datas(src_w, dst_w, &fp_sum_w, &fp_step_w, &left_pad_w, &right_pad_w);
+        for (x = 0; x < dst_w; x++, fp_sum_w += fp_step_w) {
+            int index_w, frac_w;
+
+            if (x < left_pad_w) {
+                index_w = 0;
+                frac_w = FRAC_ZERO;
+            } else if (x > dst_w - 1 - right_pad_w) {
+                /* A single column is read from a copy that has it twice */
+                index_w = SDL_max(src_w - 2, 0);
+                frac_w = FRAC_ONE;
+            } else {
+                index_w = SRC_INDEX(fp_sum_w);
+                frac_w = FRAC(fp_sum_w);
+            }
+            bands->columns[x] = 4 * index_w;
+            bands->weights[x] = (FRAC_ONE - frac_w) | (frac_w << 16);
+        }
+    }
+    return 0;
+}
+
+/* Different rows can only be scaled in parallel if the source isn't also the destination */
+static int SDL_GetStretchBandRows(SDL_Surface *s, SDL_Surface *d, int dst_w, int dst_h)
+{
+    if (s->pixels == d->pixels) {
+        return 0;
+    }
+    return SDL_GetBlitBandRows(dst_w, dst_h);
+}
 
 int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
                                SDL_Surface *d, const SDL_Rect *dstrect)
 {
-    int ret = -1;
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * 4 + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * 4 + dstrect->y * dst_pitch);
+    SDL_StretchBands bands;
+    int band_rows;
+    int ret;
 
-#if defined(HAVE_NEON_INTRINSICS)
-    if (ret == -1 && hasNEON()) {
-        ret = scale_mat_NEON(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    SDL_zero(bands);
+    bands.src_w = srcrect->w;
+    bands.src_h = srcrect->h;
+    bands.dst_w = dstrect->w;
+    bands.dst_h = dstrect->h;
+    bands.dst_pitch = d->pitch;
+    bands.dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * d->format->BytesPerPixel + dstrect->y * bands.dst_pitch);
+    if (SDL_SetupStretchLinear(&bands, s, srcrect) < 0) {
+        return -1;
     }
-#endif
 
-#if defined(HAVE_SSE2_INTRINSICS)
-    if (ret == -1 && hasSSE2()) {
-        ret = scale_mat_SSE(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    band_rows = SDL_GetStretchBandRows(s, d, bands.dst_w, bands.dst_h);
+    if (band_rows > 0 && band_rows < bands.dst_h) {
+        SDL_RunJobs(SDL_JOB_KERNEL_BLIT_ROWS, SDL_StretchLinearBand, &bands, bands.dst_h, band_rows);
+        /* The error was set on the worker's thread */
+        ret = SDL_AtomicGet(&bands.failed) ? SDL_OutOfMemory() : 0;
+    } else {
+        ret = scale_mat_filtered_rows(&bands, 0, bands.dst_h);
+    }
+    SDL_free(bands.columns);
+    return ret;
+}
+
+int SDL_SoftStretchLinearRows(SDL_Surface *s, const SDL_Rect *srcrect, int dst_w, int dst_h,
+                              Uint32 *row, SDL_StretchRowFunc row_func, void *row_data)
+{
+    SDL_StretchBands bands;
+    int ret;
+    int src_locked = 0;
+
+    if (s->format->BytesPerPixel != 4 || s->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+        return SDL_SetError("Wrong format");
+    }
+    if (srcrect->w > SDL_MAX_UINT16 || srcrect->h > SDL_MAX_UINT16 ||
+        dst_w > SDL_MAX_UINT16 || dst_h > SDL_MAX_UINT16) {
+        return SDL_SetError("Size too large for scaling");
+    }
+    if (dst_w <= 0 || dst_h <= 0) {
+        return 0;
+    }
+
+    if (SDL_MUSTLOCK(s)) {
+        if (SDL_LockSurface(s) < 0) {
+            return SDL_SetError("Unable to lock source surface");
+        }
+        src_locked = 1;
     }
-#endif
 
-    if (ret == -1) {
-        ret = scale_mat(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+    SDL_zero(bands);
+    bands.src_w = srcrect->w;
+    bands.src_h = srcrect->h;
+    bands.dst = row;
+    bands.dst_w = dst_w;
+    bands.dst_h = dst_h;
+    bands.dst_pitch = 4 * dst_w;
+    bands.row_func = row_func;
+    bands.row_data = row_data;
+    ret = SDL_SetupStretchLinear(&bands, s, srcrect);
+    if (ret == 0) {
+        ret = scale_mat_filtered_rows(&bands, 0, dst_h);
     }
+    SDL_free(bands.columns);
 
+    if (src_locked) {
+        SDL_UnlockSurface(s);
+    }
     return ret;
 }
 
@@ -838,7 +1050,7 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     incy = ((Uint64)src_h << 16) / dst_h; \
     incx = ((Uint64)src_w << 16) / dst_w; \
     dst_gap = dst_pitch - bpp * dst_w;    \
-    posy = incy / 2;
+    posy = incy / 2 + y0 * incy;
 
 #define SDL_SCALE_NEAREST__HEIGHT                                         \
     srcy = (posy >> 16);                                                  \
@@ -848,11 +1060,11 @@ int SDL_LowerSoftStretchLinear(SDL_Surface *s, const SDL_Rect *srcrect,
     n = dst_w;
 
 static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 1;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -868,11 +1080,11 @@ static int scale_mat_nearest_1(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 2;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint16 *src;
@@ -888,11 +1100,11 @@ static int scale_mat_nearest_2(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 3;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint8 *src;
@@ -910,11 +1122,11 @@ static int scale_mat_nearest_3(const Uint32 *src_ptr, int src_w, int src_h, int
 }
 
 static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int src_pitch,
-                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch)
+                               Uint32 *dst, int dst_w, int dst_h, int dst_pitch, int y0, int y1)
 {
     Uint32 bpp = 4;
     SDL_SCALE_NEAREST__START
-    for (i = 0; i < dst_h; i++) {
+    for (i = y0; i < y1; i++) {
         SDL_SCALE_NEAREST__HEIGHT
         while (n--) {
             const Uint32 *src;
@@ -929,30 +1141,49 @@ static int scale_mat_nearest_4(const Uint32 *src_ptr, int src_w, int src_h, int
     return 0;
 }
 
-int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
-                                SDL_Surface *d, const SDL_Rect *dstrect)
+/* Scales destination rows [y0, y1) */
+static int scale_mat_nearest_rows(const SDL_StretchBands *bands, int y0, int y1)
 {
-    int src_w = srcrect->w;
-    int src_h = srcrect->h;
-    int dst_w = dstrect->w;
-    int dst_h = dstrect->h;
-    int src_pitch = s->pitch;
-    int dst_pitch = d->pitch;
-
-    const int bpp = d->format->BytesPerPixel;
+    Uint32 *dst = (Uint32 *)((Uint8 *)bands->dst + (size_t)y0 * bands->dst_pitch);
+
+    if (bands->bpp == 4) {
+        return scale_mat_nearest_4(bands->src, bands->src_w, bands->src_h, bands->src_pitch, dst, bands->dst_w, bands->dst_h, bands->dst_pitch, y0, y1);
+    } else if (bands->bpp == 3) {
+        return scale_mat_nearest_3(bands->src, bands->src_w, bands->src_h, bands->src_pitch, dst, bands->dst_w, bands->dst_h, bands->dst_pitch, y0, y1);
+    } else if (bands->bpp == 2) {
+        return scale_mat_nearest_2(bands->src, bands->src_w, bands->src_h, bands->src_pitch, dst, bands->dst_w, bands->dst_h, bands->dst_pitch, y0, y1);
+    } else {
+        return scale_mat_nearest_1(bands->src, bands->src_w, bands->src_h, bands->src_pitch, dst, bands->dst_w, bands->dst_h, bands->dst_pitch, y0, y1);
+    }
+}
 
-    Uint32 *src = (Uint32 *)((Uint8 *)s->pixels + srcrect->x * bpp + srcrect->y * src_pitch);
-    Uint32 *dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bpp + dstrect->y * dst_pitch);
+static void SDL_StretchNearestBand(void *userdata, int start, int end)
+{
+    scale_mat_nearest_rows((const SDL_StretchBands *)userdata, start, end);
+}
 
-    if (bpp == 4) {
-        return scale_mat_nearest_4(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
-    } else if (bpp == 3) {
-        return scale_mat_nearest_3(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
-    } else if (bpp == 2) {
-        return scale_mat_nearest_2(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
-    } else {
-        return scale_mat_nearest_1(src, src_w, src_h, src_pitch, dst, dst_w, dst_h, dst_pitch);
+int SDL_LowerSoftStretchNearest(SDL_Surface *s, const SDL_Rect *srcrect,
+                                SDL_Surface *d, const SDL_Rect *dstrect)
+{
+    SDL_StretchBands bands;
+    int band_rows;
+
+    bands.bpp = d->format->BytesPerPixel;
+    bands.src_w = srcrect->w;
+    bands.src_h = srcrect->h;
+    bands.src_pitch = s->pitch;
+    bands.src = (const Uint32 *)((const Uint8 *)s->pixels + srcrect->x * bands.bpp + srcrect->y * bands.src_pitch);
+    bands.dst_w = dstrect->w;
+    bands.dst_h = dstrect->h;
+    bands.dst_pitch = d->pitch;
+    bands.dst = (Uint32 *)((Uint8 *)d->pixels + dstrect->x * bands.bpp + dstrect->y * bands.dst_pitch);
+
+    band_rows = SDL_GetStretchBandRows(s, d, bands.dst_w, bands.dst_h);
+    if (band_rows > 0 && band_rows < bands.dst_h) {
+        SDL_RunJobs(SDL_JOB_KERNEL_BLIT_ROWS, SDL_StretchNearestBand, &bands, bands.dst_h, band_rows);
+        return 0;
     }
+    return scale_mat_nearest_rows(&bands, 0, bands.dst_h);
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
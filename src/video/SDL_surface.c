@@ -80,9 +80,6 @@ SDL_Surface *SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height,
     size_t pitch;
     SDL_Surface *surface;
 
-    /* The flags are no longer used, make the compiler happy */
-    (void)flags;
-
     if (width < 0) {
         SDL_InvalidParamError("width");
         return NULL;
@@ -98,6 +95,16 @@ SDL_Surface *SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height,
         return NULL;
     } else {
         pitch = SDL_CalculatePitch(format, width, SDL_FALSE);
+        if (flags & SDL_SIMD_PITCH) {
+            /* Start every row on a SIMD boundary, like the pixels themselves */
+            const size_t alignment = SDL_SIMDGetAlignment();
+
+            if (SDL_size_add_overflow(pitch, alignment - 1, &pitch)) {
+                pitch = SDL_SIZE_MAX;
+            } else {
+                pitch -= pitch % alignment;
+            }
+        }
         if (pitch > SDL_MAX_SINT32) {
             /* Overflow... */
             SDL_OutOfMemory();
@@ -120,6 +127,7 @@ SDL_Surface *SDL_CreateRGBSurfaceWithFormat(Uint32 flags, int width, int height,
     surface->w = width;
     surface->h = height;
     surface->pitch = (int)pitch;
+    surface->flags |= (flags & SDL_SIMD_PITCH);
     SDL_SetClipRect(surface, NULL);
 
     if (SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
@@ -578,7 +586,7 @@ int SDL_SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode)
     status = 0;
     flags = surface->map->info.flags;
     surface->map->info.flags &=
-        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+        ~(SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED);
     switch (blendMode) {
     case SDL_BLENDMODE_NONE:
         break;
@@ -594,6 +602,9 @@ int SDL_SetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode blendMode)
     case SDL_BLENDMODE_MUL:
         surface->map->info.flags |= SDL_COPY_MUL;
         break;
+    case SDL_BLENDMODE_BLEND_PREMULTIPLIED:
+        surface->map->info.flags |= SDL_COPY_BLEND_PREMULTIPLIED;
+        break;
     default:
         status = SDL_Unsupported();
         break;
@@ -616,7 +627,7 @@ int SDL_GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode)
         return 0;
     }
 
-    switch (surface->map->info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL)) {
+    switch (surface->map->info.flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL | SDL_COPY_BLEND_PREMULTIPLIED)) {
     case SDL_COPY_BLEND:
         *blendMode = SDL_BLENDMODE_BLEND;
         break;
@@ -629,6 +640,9 @@ int SDL_GetSurfaceBlendMode(SDL_Surface *surface, SDL_BlendMode *blendMode)
     case SDL_COPY_MUL:
         *blendMode = SDL_BLENDMODE_MUL;
         break;
+    case SDL_COPY_BLEND_PREMULTIPLIED:
+        *blendMode = SDL_BLENDMODE_BLEND_PREMULTIPLIED;
+        break;
     default:
         *blendMode = SDL_BLENDMODE_NONE;
         break;
@@ -956,12 +970,100 @@ int SDL_LowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
     return SDL_PrivateLowerBlitScaled(src, srcrect, dst, dstrect, SDL_ScaleModeNearest);
 }
 
+/* Scaled rows are blitted in chunks of about this size, so they are still in the cache */
+#define SCALED_CHUNK_BYTES (16 * 1024)
+
+typedef struct
+{
+    SDL_Surface *chunk;
+    SDL_Surface *dst;
+    const SDL_Rect *dstrect;
+    SDL_Rect cliprect;
+    int chunk_y;
+    int ret;
+} SDL_ScaledRowBlit;
+
+static Uint32 *SDL_BlitScaledRow(void *userdata, int y, Uint32 *pixels)
+{
+    SDL_ScaledRowBlit *blit = (SDL_ScaledRowBlit *)userdata;
+    SDL_Surface *chunk = blit->chunk;
+    const SDL_Rect *dstrect = blit->dstrect;
+    SDL_Rect srcrows, dstrows;
+    int y0, y1;
+
+    if (y - blit->chunk_y + 1 < chunk->h && y + 1 < dstrect->h) {
+        return (Uint32 *)((Uint8 *)pixels + chunk->pitch);
+    }
+
+    /* The chunk is full, blit the part of it that is inside the clip rectangle */
+    y0 = SDL_max(dstrect->y + blit->chunk_y, blit->cliprect.y);
+    y1 = SDL_min(dstrect->y + y + 1, blit->cliprect.y + blit->cliprect.h);
+    if (y0 < y1 && blit->ret == 0) {
+        srcrows.x = blit->cliprect.x - dstrect->x;
+        srcrows.y = y0 - dstrect->y - blit->chunk_y;
+        srcrows.w = blit->cliprect.w;
+        srcrows.h = y1 - y0;
+        dstrows.x = blit->cliprect.x;
+        dstrows.y = y0;
+        dstrows.w = blit->cliprect.w;
+        dstrows.h = y1 - y0;
+        blit->ret = SDL_LowerBlit(chunk, &srcrows, blit->dst, &dstrows);
+    }
+    blit->chunk_y = y + 1;
+    return (Uint32 *)chunk->pixels;
+}
+
+/*
+ * Scales with bilinear filtering and blits the result with the modulation and
+ * blend mode of 'src', a few rows at a time. The rows are kept in the blit map of
+ * 'src', so drawing the same surface again doesn't allocate anything.
+ * 'dstrect' is the whole scaled image, only its part inside 'cliprect' is drawn.
+ */
+int SDL_PrivateBlitScaledLinearRows(SDL_Surface *src, const SDL_Rect *srcrect,
+                                    SDL_Surface *dst, const SDL_Rect *dstrect, const SDL_Rect *cliprect)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_Surface *chunk = map->scaled_rows;
+    SDL_ScaledRowBlit blit;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, alpha;
+    int rows, ret;
+
+    if (!SDL_IntersectRect(dstrect, cliprect ? cliprect : &dst->clip_rect, &blit.cliprect)) {
+        return 0;
+    }
+
+    rows = SDL_clamp(SCALED_CHUNK_BYTES / (dstrect->w * 4), 1, dstrect->h);
+    if (!chunk || chunk->w < dstrect->w || chunk->h < rows || chunk->format->format != src->format->format) {
+        SDL_FreeSurface(chunk);
+        chunk = map->scaled_rows = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, rows, 0, src->format->format);
+        if (!chunk) {
+            return -1;
+        }
+    }
+
+    SDL_GetSurfaceColorMod(src, &r, &g, &b);
+    SDL_GetSurfaceAlphaMod(src, &alpha);
+    SDL_GetSurfaceBlendMode(src, &blendMode);
+    SDL_SetSurfaceColorMod(chunk, r, g, b);
+    SDL_SetSurfaceAlphaMod(chunk, alpha);
+    SDL_SetSurfaceBlendMode(chunk, blendMode);
+
+    blit.chunk = chunk;
+    blit.dst = dst;
+    blit.dstrect = dstrect;
+    blit.chunk_y = 0;
+    blit.ret = 0;
+    ret = SDL_SoftStretchLinearRows(src, srcrect, dstrect->w, dstrect->h, (Uint32 *)chunk->pixels, SDL_BlitScaledRow, &blit);
+    return ret < 0 ? ret : blit.ret;
+}
+
 int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
                                SDL_Surface *dst, SDL_Rect *dstrect, SDL_ScaleMode scaleMode)
 {
     static const Uint32 complex_copy_flags = (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
                                               SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL |
-                                              SDL_COPY_COLORKEY);
+                                              SDL_COPY_BLEND_PREMULTIPLIED | SDL_COPY_COLORKEY);
 
     if (srcrect->w > SDL_MAX_UINT16 || srcrect->h > SDL_MAX_UINT16 ||
         dstrect->w > SDL_MAX_UINT16 || dstrect->h > SDL_MAX_UINT16) {
@@ -985,13 +1087,13 @@ int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
         if (!(src->map->info.flags & complex_copy_flags) &&
             src->format->format == dst->format->format &&
             !SDL_ISPIXELFORMAT_INDEXED(src->format->format) &&
-            src->format->BytesPerPixel == 4 &&
+            (src->format->BytesPerPixel == 4 || src->format->BytesPerPixel == 2) &&
             src->format->format != SDL_PIXELFORMAT_ARGB2101010) {
             /* fast path */
             return SDL_SoftStretchLinear(src, srcrect, dst, dstrect);
         } else {
             /* Use intermediate surface(s) */
-            SDL_Surface *tmp1 = NULL;
+            SDL_Surface *tmp1;
             int ret;
             SDL_Rect srcrect2;
             int is_complex_copy_flags = (src->map->info.flags & complex_copy_flags);
@@ -1013,18 +1115,30 @@ int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
 
             /* Change source format if not appropriate for scaling */
             if (src->format->BytesPerPixel != 4 || src->format->format == SDL_PIXELFORMAT_ARGB2101010) {
+                SDL_BlitMap *map = src->map;
                 SDL_Rect tmprect;
-                int fmt;
+                Uint32 fmt;
                 tmprect.x = 0;
                 tmprect.y = 0;
-                tmprect.w = src->w;
-                tmprect.h = src->h;
+                tmprect.w = srcrect->w;
+                tmprect.h = srcrect->h;
                 if (dst->format->BytesPerPixel == 4 && dst->format->format != SDL_PIXELFORMAT_ARGB2101010) {
                     fmt = dst->format->format;
                 } else {
                     fmt = SDL_PIXELFORMAT_ARGB8888;
                 }
-                tmp1 = SDL_CreateRGBSurfaceWithFormat(flags, src->w, src->h, 0, fmt);
+                /* The converted pixels are kept in the blit map of 'src', so drawing it again doesn't allocate anything */
+                tmp1 = map->scaled_source;
+                if (!tmp1 || tmp1->w < srcrect->w || tmp1->h < srcrect->h || tmp1->format->format != fmt) {
+                    SDL_FreeSurface(tmp1);
+                    tmp1 = map->scaled_source = SDL_CreateRGBSurfaceWithFormat(flags, srcrect->w, srcrect->h, 0, fmt);
+                    if (!tmp1) {
+                        return -1;
+                    }
+                } else if (is_complex_copy_flags) {
+                    /* Blending or a color key leave some of what was there, start from the same blank pixels as a new surface */
+                    SDL_FillRect(tmp1, &tmprect, 0);
+                }
                 SDL_LowerBlit(src, srcrect, tmp1, &tmprect);
 
                 srcrect2.x = 0;
@@ -1036,8 +1150,11 @@ int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
                 src = tmp1;
             }
 
-            /* Intermediate scaling */
-            if (is_complex_copy_flags || src->format->format != dst->format->format) {
+            /* Scale a row at a time, and blit each row while it's still in the cache */
+            if ((is_complex_copy_flags || src->format->format != dst->format->format) && src != dst) {
+                ret = SDL_PrivateBlitScaledLinearRows(src, &srcrect2, dst, dstrect, dstrect);
+            } else if (is_complex_copy_flags || src->format->format != dst->format->format) {
+                /* Reading and writing the same pixels, scale everything first */
                 SDL_Rect tmprect;
                 SDL_Surface *tmp2 = SDL_CreateRGBSurfaceWithFormat(flags, dstrect->w, dstrect->h, 0, src->format->format);
                 SDL_SoftStretchLinear(src, &srcrect2, tmp2, NULL);
@@ -1055,8 +1172,6 @@ int SDL_PrivateLowerBlitScaled(SDL_Surface *src, SDL_Rect *srcrect,
             } else {
                 ret = SDL_SoftStretchLinear(src, &srcrect2, dst, dstrect);
             }
-
-            SDL_FreeSurface(tmp1);
             return ret;
         }
     }
@@ -1331,10 +1446,11 @@ SDL_Surface *SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * f
     SDL_SetClipRect(convert, &surface->clip_rect);
 
     /* Enable alpha blending by default if the new surface has an
-     * alpha channel or alpha modulation */
-    if ((surface->format->Amask && format->Amask) ||
-        (palette_has_alpha && format->Amask) ||
-        (copy_flags & SDL_COPY_MODULATE_ALPHA)) {
+     * alpha channel or alpha modulation, unless it is premultiplied */
+    if (!(copy_flags & SDL_COPY_BLEND_PREMULTIPLIED) &&
+        ((surface->format->Amask && format->Amask) ||
+         (palette_has_alpha && format->Amask) ||
+         (copy_flags & SDL_COPY_MODULATE_ALPHA))) {
         SDL_SetSurfaceBlendMode(convert, SDL_BLENDMODE_BLEND);
     }
     if ((copy_flags & SDL_COPY_RLE_DESIRED) || (flags & SDL_RLEACCEL)) {
@@ -1474,10 +1590,58 @@ int SDL_ConvertPixels(int width, int height,
     return ret;
 }
 
+/* The alpha shift of 32-bit formats with 8-bit channels and alpha, or -1 */
+static int GetPremultiplyAlphaShift(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_ARGB8888:
+    case SDL_PIXELFORMAT_ABGR8888:
+        return 24;
+    case SDL_PIXELFORMAT_RGBA8888:
+    case SDL_PIXELFORMAT_BGRA8888:
+        return 0;
+    default:
+        return -1;
+    }
+}
+
+static void PremultiplyAlpha8888(int width, int height, int ashift,
+                                 const void *src, int src_pitch,
+                                 void *dst, int dst_pitch)
+{
+    int c;
+    Uint32 srcpixel;
+    Uint32 srcA;
+    Uint32 dstpixel;
+    /* The shifts of the three color channels */
+    const int shift0 = (ashift == 0) ? 8 : 0;
+    const int shift1 = shift0 + 8;
+    const int shift2 = shift0 + 16;
+
+    while (height--) {
+        const Uint32 *src_px = (const Uint32 *)src;
+        Uint32 *dst_px = (Uint32 *)dst;
+        for (c = width; c; --c) {
+            srcpixel = *src_px++;
+            srcA = (srcpixel >> ashift) & 0xFF;
+
+            /* Alpha pre-multiplication of each component. */
+            dstpixel = srcA << ashift;
+            dstpixel |= ((((srcpixel >> shift0) & 0xFF) * srcA) / 255) << shift0;
+            dstpixel |= ((((srcpixel >> shift1) & 0xFF) * srcA) / 255) << shift1;
+            dstpixel |= ((((srcpixel >> shift2) & 0xFF) * srcA) / 255) << shift2;
+            *dst_px++ = dstpixel;
+        }
+        src = (const Uint8 *)src + src_pitch;
+        dst = (Uint8 *)dst + dst_pitch;
+    }
+}
+
 /*
  * Premultiply the alpha on a block of pixels
  *
- * This is currently only implemented for SDL_PIXELFORMAT_ARGB8888
+ * 32-bit formats with 8-bit channels and alpha are premultiplied directly,
+ * everything else goes through SDL_PIXELFORMAT_ARGB8888.
  *
  * Here are some ideas for optimization:
  * https://github.com/Wizermil/premultiply_alpha/tree/master/premultiply_alpha
@@ -1487,11 +1651,10 @@ int SDL_PremultiplyAlpha(int width, int height,
                          Uint32 src_format, const void *src, int src_pitch,
                          Uint32 dst_format, void *dst, int dst_pitch)
 {
-    int c;
-    Uint32 srcpixel;
-    Uint32 srcR, srcG, srcB, srcA;
-    Uint32 dstpixel;
-    Uint32 dstR, dstG, dstB, dstA;
+    const int ashift = GetPremultiplyAlphaShift(dst_format);
+    void *tmp;
+    int tmp_pitch;
+    int retval;
 
     if (!src) {
         return SDL_InvalidParamError("src");
@@ -1505,35 +1668,57 @@ int SDL_PremultiplyAlpha(int width, int height,
     if (!dst_pitch) {
         return SDL_InvalidParamError("dst_pitch");
     }
-    if (src_format != SDL_PIXELFORMAT_ARGB8888) {
+    if (SDL_ISPIXELFORMAT_INDEXED(src_format) || SDL_ISPIXELFORMAT_FOURCC(src_format)) {
         return SDL_InvalidParamError("src_format");
     }
-    if (dst_format != SDL_PIXELFORMAT_ARGB8888) {
+    if (SDL_ISPIXELFORMAT_INDEXED(dst_format) || SDL_ISPIXELFORMAT_FOURCC(dst_format)) {
         return SDL_InvalidParamError("dst_format");
     }
 
-    while (height--) {
-        const Uint32 *src_px = (const Uint32 *)src;
-        Uint32 *dst_px = (Uint32 *)dst;
-        for (c = width; c; --c) {
-            /* Component bytes extraction. */
-            srcpixel = *src_px++;
-            RGBA_FROM_ARGB8888(srcpixel, srcR, srcG, srcB, srcA);
+    if (ashift >= 0) {
+        /* Convert into the destination, then premultiply it in place */
+        if (src_format != dst_format) {
+            if (SDL_ConvertPixels(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch) < 0) {
+                return -1;
+            }
+            src = dst;
+            src_pitch = dst_pitch;
+        }
+        PremultiplyAlpha8888(width, height, ashift, src, src_pitch, dst, dst_pitch);
+        return 0;
+    }
 
-            /* Alpha pre-multiplication of each component. */
-            dstA = srcA;
-            dstR = (srcA * srcR) / 255;
-            dstG = (srcA * srcG) / 255;
-            dstB = (srcA * srcB) / 255;
+    /* The destination has no alpha, or another layout, go through ARGB8888 */
+    tmp_pitch = width * 4;
+    tmp = SDL_malloc((size_t)tmp_pitch * height);
+    if (!tmp) {
+        return SDL_OutOfMemory();
+    }
+    retval = SDL_ConvertPixels(width, height, src_format, src, src_pitch, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
+    if (retval == 0) {
+        PremultiplyAlpha8888(width, height, 24, tmp, tmp_pitch, tmp, tmp_pitch);
+        retval = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+    }
+    SDL_free(tmp);
+    return retval;
+}
 
-            /* ARGB8888 pixel recomposition. */
-            ARGB8888_FROM_RGBA(dstpixel, dstR, dstG, dstB, dstA);
-            *dst_px++ = dstpixel;
-        }
-        src = (const Uint8 *)src + src_pitch;
-        dst = (Uint8 *)dst + dst_pitch;
+int SDL_PremultiplySurfaceAlpha(SDL_Surface *surface)
+{
+    int retval;
+
+    if (!surface) {
+        return SDL_InvalidParamError("surface");
     }
-    return 0;
+
+    if (SDL_LockSurface(surface) < 0) {
+        return -1;
+    }
+    retval = SDL_PremultiplyAlpha(surface->w, surface->h,
+                                  surface->format->format, surface->pixels, surface->pitch,
+                                  surface->format->format, surface->pixels, surface->pitch);
+    SDL_UnlockSurface(surface);
+    return retval;
 }
 
 /*
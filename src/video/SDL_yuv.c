@@ -24,6 +24,7 @@
 #include "SDL_video.h"
 #include "SDL_pixels_c.h"
 #include "SDL_yuv_c.h"
+#include "../thread/SDL_jobs_c.h"
 
 #include "yuv2rgb/yuv_rgb.h"
 
@@ -33,6 +34,7 @@ static SDL_YUV_CONVERSION_MODE SDL_YUV_ConversionMode = SDL_YUV_CONVERSION_BT601
 
 #if SDL_HAVE_YUV
 static SDL_bool IsPlanar2x2Format(Uint32 format);
+static SDL_bool IsP01xFormat(Uint32 format);
 #endif
 
 void SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_MODE mode)
@@ -69,7 +71,7 @@ int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch)
 #if SDL_HAVE_YUV
     int sz_plane = 0, sz_plane_chroma = 0, sz_plane_packed = 0;
 
-    if (IsPlanar2x2Format(format) == SDL_TRUE) {
+    if (IsPlanar2x2Format(format) == SDL_TRUE || IsP01xFormat(format) == SDL_TRUE) {
         {
             /* sz_plane == w * h; */
             size_t s1;
@@ -175,6 +177,33 @@ int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch)
         }
         break;
 
+    case SDL_PIXELFORMAT_P010: /**< Planar mode: Y + U/V interleaved, 16-bit samples  (2 planes) */
+    case SDL_PIXELFORMAT_P016: /**< Planar mode: Y + U/V interleaved, 16-bit samples  (2 planes) */
+        if (pitch) {
+            /* pitch == 2 * w; */
+            size_t p1;
+            if (SDL_size_mul_overflow(w, 2, &p1) < 0) {
+                return -1;
+            }
+            *pitch = (int) p1;
+        }
+
+        if (size) {
+            /* dst_size == 2 * (sz_plane + sz_plane_chroma + sz_plane_chroma); */
+            size_t s1, s2, s3;
+            if (SDL_size_add_overflow(sz_plane, sz_plane_chroma, &s1) < 0) {
+                return -1;
+            }
+            if (SDL_size_add_overflow(s1, sz_plane_chroma, &s2) < 0) {
+                return -1;
+            }
+            if (SDL_size_mul_overflow(s2, 2, &s3) < 0) {
+                return -1;
+            }
+            *size = (int) s3;
+        }
+        break;
+
     default:
         return -1;
     }
@@ -215,6 +244,12 @@ static SDL_bool IsPacked4Format(Uint32 format)
     return format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU;
 }
 
+/* The NV12 layout with 16-bit little endian samples, P010 only uses their high 10 bits */
+static SDL_bool IsP01xFormat(Uint32 format)
+{
+    return format == SDL_PIXELFORMAT_P010 || format == SDL_PIXELFORMAT_P016;
+}
+
 static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, int yuv_pitch,
                         const Uint8 **y, const Uint8 **u, const Uint8 **v, Uint32 *y_stride, Uint32 *uv_stride)
 {
@@ -244,6 +279,14 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         planes[0] = (const Uint8 *)yuv;
         planes[1] = planes[0] + pitches[0] * height;
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        /* Like NV12, counting in 16-bit samples */
+        pitches[0] = yuv_pitch;
+        pitches[1] = 2 * (2 * ((pitches[0] / 2 + 1) / 2));
+        planes[0] = (const Uint8 *)yuv;
+        planes[1] = planes[0] + pitches[0] * height;
+        break;
     default:
         return SDL_SetError("GetYUVPlanes(): Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
     }
@@ -298,6 +341,14 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
         *u = *v + 1;
         *uv_stride = pitches[1];
         break;
+    case SDL_PIXELFORMAT_P010:
+    case SDL_PIXELFORMAT_P016:
+        *y = planes[0];
+        *y_stride = pitches[0];
+        *u = planes[1];
+        *v = *u + 2;
+        *uv_stride = pitches[1];
+        break;
     default:
         /* Should have caught this above */
         return SDL_SetError("GetYUVPlanes[2]: Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
@@ -305,6 +356,115 @@ static int GetYUVPlanes(int width, int height, Uint32 format, const void *yuv, i
     return 0;
 }
 
+static SDL_bool yuv_rgb_avx2(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+#ifdef SDL_AVX2_INTRINSICS
+    if (!(SDL_GetBlitCPUFeatures() & SDL_CPU_AVX2)) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_avx2(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_sse(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -313,7 +473,7 @@ static SDL_bool yuv_rgb_sse(
     YCbCrType yuv_type)
 {
 #ifdef __SSE2__
-    if (!SDL_HasSSE2()) {
+    if (!(SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2)) {
         return SDL_FALSE;
     }
 
@@ -414,6 +574,115 @@ static SDL_bool yuv_rgb_sse(
     return SDL_FALSE;
 }
 
+static SDL_bool yuv_rgb_altivec(
+    Uint32 src_format, Uint32 dst_format,
+    Uint32 width, Uint32 height,
+    const Uint8 *y, const Uint8 *u, const Uint8 *v, Uint32 y_stride, Uint32 uv_stride,
+    Uint8 *rgb, Uint32 rgb_stride,
+    YCbCrType yuv_type)
+{
+#ifdef YUV_RGB_ALTIVEC
+    if (!(SDL_GetBlitCPUFeatures() & SDL_CPU_ALTIVEC)) {
+        return SDL_FALSE;
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YV12 ||
+        src_format == SDL_PIXELFORMAT_IYUV) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv420_rgb565_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv420_rgb24_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv420_rgba_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv420_bgra_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv420_argb_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv420_abgr_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_YUY2 ||
+        src_format == SDL_PIXELFORMAT_UYVY ||
+        src_format == SDL_PIXELFORMAT_YVYU) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuv422_rgb565_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuv422_rgb24_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuv422_rgba_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuv422_bgra_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuv422_argb_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuv422_abgr_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+
+    if (src_format == SDL_PIXELFORMAT_NV12 ||
+        src_format == SDL_PIXELFORMAT_NV21) {
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_RGB565:
+            yuvnv12_rgb565_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB24:
+            yuvnv12_rgb24_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGBX8888:
+        case SDL_PIXELFORMAT_RGBA8888:
+            yuvnv12_rgba_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGRX8888:
+        case SDL_PIXELFORMAT_BGRA8888:
+            yuvnv12_bgra_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_RGB888:
+        case SDL_PIXELFORMAT_ARGB8888:
+            yuvnv12_argb_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        case SDL_PIXELFORMAT_BGR888:
+        case SDL_PIXELFORMAT_ABGR8888:
+            yuvnv12_abgr_altivec(width, height, y, u, v, y_stride, uv_stride, rgb, rgb_stride, yuv_type);
+            return SDL_TRUE;
+        default:
+            break;
+        }
+    }
+#endif
+    return SDL_FALSE;
+}
+
 static SDL_bool yuv_rgb_lsx(
     Uint32 src_format, Uint32 dst_format,
     Uint32 width, Uint32 height,
@@ -559,6 +828,304 @@ static SDL_bool yuv_rgb_std(
     return SDL_FALSE;
 }
 
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    Uint32 width;
+    const Uint8 *y;
+    const Uint8 *u;
+    const Uint8 *v;
+    Uint32 y_stride;
+    Uint32 uv_stride;
+    Uint8 *rgb;
+    Uint32 rgb_stride;
+    YCbCrType yuv_type;
+    int first_row;
+} YUVToRGBBands;
+
+/* Converts rows [start, end), start must be even for the 2x2 subsampled formats */
+static SDL_bool yuv_rgb_rows(const YUVToRGBBands *bands, int start, int end)
+{
+    const Uint32 height = (Uint32)(end - start);
+    const size_t uv_row = IsPlanar2x2Format(bands->src_format) ? (size_t)start / 2 : (size_t)start;
+    const Uint8 *y = bands->y + (size_t)start * bands->y_stride;
+    const Uint8 *u = bands->u + uv_row * bands->uv_stride;
+    const Uint8 *v = bands->v + uv_row * bands->uv_stride;
+    Uint8 *rgb = bands->rgb + (size_t)start * bands->rgb_stride;
+
+    return yuv_rgb_avx2(bands->src_format, bands->dst_format, bands->width, height, y, u, v, bands->y_stride, bands->uv_stride, rgb, bands->rgb_stride, bands->yuv_type) ||
+           yuv_rgb_sse(bands->src_format, bands->dst_format, bands->width, height, y, u, v, bands->y_stride, bands->uv_stride, rgb, bands->rgb_stride, bands->yuv_type) ||
+           yuv_rgb_altivec(bands->src_format, bands->dst_format, bands->width, height, y, u, v, bands->y_stride, bands->uv_stride, rgb, bands->rgb_stride, bands->yuv_type) ||
+           yuv_rgb_lsx(bands->src_format, bands->dst_format, bands->width, height, y, u, v, bands->y_stride, bands->uv_stride, rgb, bands->rgb_stride, bands->yuv_type) ||
+           yuv_rgb_std(bands->src_format, bands->dst_format, bands->width, height, y, u, v, bands->y_stride, bands->uv_stride, rgb, bands->rgb_stride, bands->yuv_type);
+}
+
+static void yuv_rgb_band(void *userdata, int start, int end)
+{
+    const YUVToRGBBands *bands = (const YUVToRGBBands *)userdata;
+
+    yuv_rgb_rows(bands, bands->first_row + start, bands->first_row + end);
+}
+
+/* Rounds a 16-bit little endian sample to 8 bits */
+static SDL_INLINE Uint8 P01xSample8(const Uint8 *sample)
+{
+    return (Uint8)(SDL_min((sample[0] | (sample[1] << 8)) + 0x80, 0xFFFF) >> 8);
+}
+
+/* Rounds rows of 16-bit little endian samples to 8 bits */
+static void P01xToNV12Rows(int count, int rows, const Uint8 *src, int src_pitch, Uint8 *dst, int dst_pitch, SDL_bool sse2)
+{
+    while (rows--) {
+        int i = 0;
+
+#ifdef __SSE2__
+        if (sse2) {
+            const __m128i round = _mm_set1_epi16(0x80);
+
+            for (; i + 16 <= count; i += 16) {
+                const __m128i a = _mm_adds_epu16(_mm_loadu_si128((const __m128i *)(src + 2 * i)), round);
+                const __m128i b = _mm_adds_epu16(_mm_loadu_si128((const __m128i *)(src + 2 * i + 16)), round);
+
+                _mm_storeu_si128((__m128i *)(dst + i), _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8)));
+            }
+        }
+#endif
+        for (; i < count; ++i) {
+            dst[i] = P01xSample8(src + 2 * i);
+        }
+        src += src_pitch;
+        dst += dst_pitch;
+    }
+}
+
+static SDL_bool P01xToNV12UseSSE2(void)
+{
+#ifdef __SSE2__
+    return (SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2) ? SDL_TRUE : SDL_FALSE;
+#else
+    return SDL_FALSE;
+#endif
+}
+
+static int SDL_ConvertPixels_P01x_to_NV12(int width, int height,
+                                          Uint32 src_format, const void *src, int src_pitch,
+                                          void *dst, int dst_pitch)
+{
+    const SDL_bool sse2 = P01xToNV12UseSSE2();
+    const Uint8 *src_y, *src_u, *src_v;
+    const Uint8 *dst_y, *dst_u, *dst_v;
+    Uint32 src_y_stride, src_uv_stride, dst_y_stride, dst_uv_stride;
+
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &src_y, &src_u, &src_v, &src_y_stride, &src_uv_stride) < 0) {
+        return -1;
+    }
+    if (GetYUVPlanes(width, height, SDL_PIXELFORMAT_NV12, dst, dst_pitch, &dst_y, &dst_u, &dst_v, &dst_y_stride, &dst_uv_stride) < 0) {
+        return -1;
+    }
+    P01xToNV12Rows(width, height, src_y, src_y_stride, (Uint8 *)dst_y, dst_y_stride, sse2);
+    P01xToNV12Rows(2 * ((width + 1) / 2), (height + 1) / 2, src_u, src_uv_stride, (Uint8 *)dst_u, dst_uv_stride, sse2);
+    return 0;
+}
+
+/* Formats without a converter of their own go through NV12 this many rows at a time,
+   in a buffer that stays in the cache */
+#define YUV_STRIP_ROWS 32
+
+static int SDL_ConvertPixels_P01x_to_RGB(int width, int height,
+                                         Uint32 src_format, const void *src, int src_pitch,
+                                         Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const SDL_bool sse2 = P01xToNV12UseSSE2();
+    const int uv_width = 2 * ((width + 1) / 2);
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+    YUVToRGBBands strip;
+    Uint8 *tmp;
+    int row;
+
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+        return -1;
+    }
+
+    SDL_zero(strip);
+    strip.src_format = SDL_PIXELFORMAT_NV12;
+    strip.dst_format = dst_format;
+    strip.width = width;
+    strip.y_stride = width;
+    strip.uv_stride = uv_width;
+    strip.rgb_stride = dst_pitch;
+    if (GetYUVConversionType(width, height, &strip.yuv_type) < 0) {
+        return -1;
+    }
+
+    tmp = (Uint8 *)SDL_malloc((size_t)width * YUV_STRIP_ROWS + (size_t)uv_width * (YUV_STRIP_ROWS / 2));
+    if (!tmp) {
+        return SDL_OutOfMemory();
+    }
+    strip.y = tmp;
+    strip.u = tmp + (size_t)width * YUV_STRIP_ROWS;
+    strip.v = strip.u + 1;
+
+    for (row = 0; row < height; row += YUV_STRIP_ROWS) {
+        const int rows = SDL_min(YUV_STRIP_ROWS, height - row);
+
+        P01xToNV12Rows(width, rows, y + (size_t)row * y_stride, y_stride, tmp, width, sse2);
+        P01xToNV12Rows(uv_width, (rows + 1) / 2, u + (size_t)(row / 2) * uv_stride, uv_stride, (Uint8 *)strip.u, uv_width, sse2);
+        strip.rgb = (Uint8 *)dst + (size_t)row * dst_pitch;
+        if (!yuv_rgb_rows(&strip, 0, rows)) {
+            break;
+        }
+    }
+    SDL_free(tmp);
+
+    if (row < height) {
+        /* No fast path for the RGB format, the first strip didn't convert, instead convert using an intermediate buffer */
+        int ret;
+        int tmp_pitch = (width * sizeof(Uint32));
+
+        tmp = (Uint8 *)SDL_malloc((size_t)tmp_pitch * height);
+        if (!tmp) {
+            return SDL_OutOfMemory();
+        }
+        ret = SDL_ConvertPixels_P01x_to_RGB(width, height, src_format, src, src_pitch, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch);
+        if (ret == 0) {
+            ret = SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_ARGB8888, tmp, tmp_pitch, dst_format, dst, dst_pitch);
+        }
+        SDL_free(tmp);
+        return ret;
+    }
+    return 0;
+}
+
+/* Samples count bytes, or 16-bit samples rounded to bytes, at the given offsets of a row */
+static void YUVSampleRow(const Uint8 *src, const Uint32 *offsets, int count, SDL_bool p01x, Uint8 *dst, int dst_step)
+{
+    int i;
+
+    if (p01x) {
+        for (i = 0; i < count; ++i) {
+            dst[i * dst_step] = P01xSample8(src + offsets[i]);
+        }
+    } else {
+        for (i = 0; i < count; ++i) {
+            dst[i * dst_step] = src[offsets[i]];
+        }
+    }
+}
+
+SDL_bool SDL_StretchPixels_YUV_to_RGB(int width, int height, Uint32 src_format, const void *src, int src_pitch,
+                                      const SDL_Rect *srcrect, int dst_w, int dst_h,
+                                      Uint32 dst_format, void *dst, int dst_pitch)
+{
+    const SDL_bool p01x = IsP01xFormat(src_format);
+    const int uv_width = 2 * ((dst_w + 1) / 2);
+    const Uint8 *y, *u, *v;
+    Uint32 y_stride, uv_stride;
+    int y_step, uv_step, uv_shift;
+    Uint64 incx, incy, pos;
+    YUVToRGBBands strip;
+    Uint32 *x_offsets, *uv_offsets;
+    void *tmp;
+    int row, i;
+
+    if (dst_w <= 0 || dst_h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return SDL_TRUE;
+    }
+    if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
+        return SDL_FALSE;
+    }
+    if (IsPlanar2x2Format(src_format)) {
+        y_step = 1;
+        uv_step = (src_format == SDL_PIXELFORMAT_NV12 || src_format == SDL_PIXELFORMAT_NV21) ? 2 : 1;
+        uv_shift = 1;
+    } else if (IsPacked4Format(src_format)) {
+        y_step = 2;
+        uv_step = 4;
+        uv_shift = 0;
+    } else if (p01x) {
+        y_step = 2;
+        uv_step = 4;
+        uv_shift = 1;
+    } else {
+        return SDL_FALSE;
+    }
+
+    SDL_zero(strip);
+    strip.src_format = SDL_PIXELFORMAT_NV12;
+    strip.dst_format = dst_format;
+    strip.width = dst_w;
+    strip.y_stride = dst_w;
+    strip.uv_stride = uv_width;
+    strip.rgb_stride = dst_pitch;
+    if (GetYUVConversionType(width, height, &strip.yuv_type) < 0) {
+        return SDL_FALSE;
+    }
+
+    tmp = SDL_malloc(sizeof(Uint32) * (dst_w + uv_width / 2) + (size_t)dst_w * YUV_STRIP_ROWS + (size_t)uv_width * (YUV_STRIP_ROWS / 2));
+    if (!tmp) {
+        return SDL_FALSE;
+    }
+    x_offsets = (Uint32 *)tmp;
+    uv_offsets = x_offsets + dst_w;
+    strip.y = (const Uint8 *)(uv_offsets + uv_width / 2);
+    strip.u = strip.y + (size_t)dst_w * YUV_STRIP_ROWS;
+    strip.v = strip.u + 1;
+
+    /* The source columns of SDL_SoftStretch(), and the chroma at the middle of each pair of them */
+    incx = ((Uint64)srcrect->w << 16) / dst_w;
+    for (i = 0, pos = incx / 2; i < dst_w; ++i, pos += incx) {
+        x_offsets[i] = (Uint32)((srcrect->x + (int)(pos >> 16)) * y_step);
+    }
+    for (i = 0, pos = incx; i < uv_width / 2; ++i, pos += 2 * incx) {
+        const int x = srcrect->x + SDL_min((int)(pos >> 16), srcrect->w - 1);
+
+        uv_offsets[i] = (Uint32)((x / 2) * uv_step);
+    }
+    incy = ((Uint64)srcrect->h << 16) / dst_h;
+
+    for (row = 0; row < dst_h; row += YUV_STRIP_ROWS) {
+        const int rows = SDL_min(YUV_STRIP_ROWS, dst_h - row);
+        int last_y = -1, last_uv = -1;
+
+        for (i = 0; i < rows; ++i) {
+            const int src_y = srcrect->y + (int)((incy / 2 + (Uint64)(row + i) * incy) >> 16);
+            Uint8 *dst_y = (Uint8 *)strip.y + (size_t)i * dst_w;
+
+            /* Rows shown more than once are sampled once */
+            if (src_y == last_y) {
+                SDL_memcpy(dst_y, dst_y - dst_w, dst_w);
+            } else {
+                YUVSampleRow(y + (size_t)src_y * y_stride, x_offsets, dst_w, p01x, dst_y, 1);
+            }
+            last_y = src_y;
+
+            if (!(i & 1)) {
+                const int src_uv = (srcrect->y + SDL_min((int)(((Uint64)(row + i + 1) * incy) >> 16), srcrect->h - 1)) >> uv_shift;
+                Uint8 *dst_uv = (Uint8 *)strip.u + (size_t)(i / 2) * uv_width;
+
+                if (src_uv == last_uv) {
+                    SDL_memcpy(dst_uv, dst_uv - uv_width, uv_width);
+                } else {
+                    YUVSampleRow(u + (size_t)src_uv * uv_stride, uv_offsets, uv_width / 2, p01x, dst_uv, 2);
+                    YUVSampleRow(v + (size_t)src_uv * uv_stride, uv_offsets, uv_width / 2, p01x, dst_uv + 1, 2);
+                }
+                last_uv = src_uv;
+            }
+        }
+
+        strip.rgb = (Uint8 *)dst + (size_t)row * dst_pitch;
+        if (!yuv_rgb_rows(&strip, 0, rows)) {
+            /* Only the first strip can fail, before anything was written */
+            SDL_free(tmp);
+            return SDL_FALSE;
+        }
+    }
+    SDL_free(tmp);
+    return SDL_TRUE;
+}
+
 int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -569,6 +1136,11 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
     Uint32 y_stride = 0;
     Uint32 uv_stride = 0;
     YCbCrType yuv_type = YCBCR_601;
+    int band_rows;
+
+    if (IsP01xFormat(src_format)) {
+        return SDL_ConvertPixels_P01x_to_RGB(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    }
 
     if (GetYUVPlanes(width, height, src_format, src, src_pitch, &y, &u, &v, &y_stride, &uv_stride) < 0) {
         return -1;
@@ -578,10 +1150,49 @@ int SDL_ConvertPixels_YUV_to_RGB(int width, int height,
         return -1;
     }
 
+    /* Bands start on even rows, so they never split a 2x2 chroma block */
+    band_rows = (SDL_GetBlitBandRows(width, height) + 1) & ~1;
+    /* The vector 4:2:2 converters do the last row of every call with the C code,
+       which rounds differently, so splitting them would change the output */
+    if (IsPacked4Format(src_format) &&
+        (SDL_GetBlitCPUFeatures() & (SDL_CPU_SSE2 | SDL_CPU_AVX2 | SDL_CPU_ALTIVEC))) {
+        band_rows = 0;
+    }
+    if (band_rows > 0 && band_rows < height) {
+        YUVToRGBBands bands;
+
+        bands.src_format = src_format;
+        bands.dst_format = dst_format;
+        bands.width = width;
+        bands.y = y;
+        bands.u = u;
+        bands.v = v;
+        bands.y_stride = y_stride;
+        bands.uv_stride = uv_stride;
+        bands.rgb = (Uint8 *)dst;
+        bands.rgb_stride = dst_pitch;
+        bands.yuv_type = yuv_type;
+        bands.first_row = band_rows;
+
+        /* The first band shows whether there is a direct conversion at all */
+        if (yuv_rgb_rows(&bands, 0, band_rows)) {
+            SDL_RunJobs(SDL_JOB_KERNEL_YUV_CONVERT, yuv_rgb_band, &bands, height - band_rows, band_rows);
+            return 0;
+        }
+    }
+
+    if (yuv_rgb_avx2(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        return 0;
+    }
+
     if (yuv_rgb_sse(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
 
+    if (yuv_rgb_altivec(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
+        return 0;
+    }
+
     if (yuv_rgb_lsx(src_format, dst_format, width, height, y, u, v, y_stride, uv_stride, (Uint8 *)dst, dst_pitch, yuv_type)) {
         return 0;
     }
@@ -625,6 +1236,30 @@ struct RGB2YUVFactors
     float v[3]; /* Rfactor, Gfactor, Bfactor */
 };
 
+static const struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] = {
+    /* ITU-T T.871 (JPEG) */
+    {
+        0,
+        { 0.2990f, 0.5870f, 0.1140f },
+        { -0.1687f, -0.3313f, 0.5000f },
+        { 0.5000f, -0.4187f, -0.0813f },
+    },
+    /* ITU-R BT.601-7 */
+    {
+        16,
+        { 0.2568f, 0.5041f, 0.0979f },
+        { -0.1482f, -0.2910f, 0.4392f },
+        { 0.4392f, -0.3678f, -0.0714f },
+    },
+    /* ITU-R BT.709-6 */
+    {
+        16,
+        { 0.1826f, 0.6142f, 0.0620f },
+        { -0.1006f, -0.3386f, 0.4392f },
+        { 0.4392f, -0.3989f, -0.0403f },
+    },
+};
+
 static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch)
 {
     const int src_pitch_x_2 = src_pitch * 2;
@@ -634,29 +1269,6 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
     const int width_remainder = (width & 0x1);
     int i, j;
 
-    static struct RGB2YUVFactors RGB2YUVFactorTables[SDL_YUV_CONVERSION_BT709 + 1] = {
-        /* ITU-T T.871 (JPEG) */
-        {
-            0,
-            { 0.2990f, 0.5870f, 0.1140f },
-            { -0.1687f, -0.3313f, 0.5000f },
-            { 0.5000f, -0.4187f, -0.0813f },
-        },
-        /* ITU-R BT.601-7 */
-        {
-            16,
-            { 0.2568f, 0.5041f, 0.0979f },
-            { -0.1482f, -0.2910f, 0.4392f },
-            { 0.4392f, -0.3678f, -0.0714f },
-        },
-        /* ITU-R BT.709-6 */
-        {
-            16,
-            { 0.1826f, 0.6142f, 0.0620f },
-            { -0.1006f, -0.3386f, 0.4392f },
-            { 0.4392f, -0.3989f, -0.0403f },
-        },
-    };
     const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
 
 #define MAKE_Y(r, g, b) (Uint8)((int)(cvt->y[0] * (r) + cvt->y[1] * (g) + cvt->y[2] * (b) + 0.5f) + cvt->y_offset)
@@ -939,6 +1551,292 @@ static int SDL_ConvertPixels_ARGB8888_to_YUV(int width, int height, const void *
     return 0;
 }
 
+/* Only SSE2 has a vector RGB to YUV encoder. AltiVec and NEON versions would take the same
+   fixed point factors, but they can't be built or checked against this code here, so those
+   CPUs keep using the scalar encoders below. */
+#ifdef __SSE2__
+/* RGB2YUVFactorTables as 1.15 fixed point, for a source format with 8-bit channels in 32-bit pixels */
+typedef struct
+{
+    int r_shift;
+    int g_shift;
+    int b_shift;
+    int y_offset;
+    Sint16 y[3];
+    Sint16 u[3];
+    Sint16 v[3];
+} RGB2YUVFixed;
+
+#define RGB2YUV_FIXED(f) (Sint16)((f) * 32768.0f + (((f) < 0.0f) ? -0.5f : 0.5f))
+
+static SDL_bool GetRGB2YUVFixed(int width, int height, Uint32 src_format, RGB2YUVFixed *fixed)
+{
+    const struct RGB2YUVFactors *cvt = &RGB2YUVFactorTables[SDL_GetYUVConversionModeForResolution(width, height)];
+    Uint32 masks[3];
+    int *shifts[3];
+    Uint32 Amask;
+    int bpp, i, shift;
+
+    if (SDL_BYTESPERPIXEL(src_format) != 4 ||
+        !SDL_PixelFormatEnumToMasks(src_format, &bpp, &masks[0], &masks[1], &masks[2], &Amask)) {
+        return SDL_FALSE;
+    }
+
+    shifts[0] = &fixed->r_shift;
+    shifts[1] = &fixed->g_shift;
+    shifts[2] = &fixed->b_shift;
+    for (i = 0; i < 3; ++i) {
+        for (shift = 0; shift < 32; shift += 8) {
+            if (masks[i] == (0xFFu << shift)) {
+                break;
+            }
+        }
+        if (shift == 32) {
+            return SDL_FALSE;
+        }
+        *shifts[i] = shift;
+    }
+
+    fixed->y_offset = cvt->y_offset;
+    for (i = 0; i < 3; ++i) {
+        fixed->y[i] = RGB2YUV_FIXED(cvt->y[i]);
+        fixed->u[i] = RGB2YUV_FIXED(cvt->u[i]);
+        fixed->v[i] = RGB2YUV_FIXED(cvt->v[i]);
+    }
+    return SDL_TRUE;
+}
+
+#undef RGB2YUV_FIXED
+
+/* Rounds to nearest with the fixed point factors, so it can differ by one from MAKE_Y() and friends */
+static SDL_INLINE Uint8 RGB2YUVFixedValue(const Sint16 factors[3], int offset, int r, int g, int b)
+{
+    const int value = ((factors[0] * r + factors[1] * g + factors[2] * b + (1 << 14)) >> 15) + offset;
+    return (Uint8)SDL_clamp(value, 0, 255);
+}
+
+typedef struct
+{
+    __m128i y;
+    __m128i u;
+    __m128i v;
+    __m128i round;
+    __m128i y_offset;
+    __m128i uv_offset;
+} RGB2YUVSSE2;
+
+/* The factors are laid out like the bytes of two pixels, with a zero for the byte that isn't R, G or B */
+static void GetRGB2YUVSSE2(const RGB2YUVFixed *fixed, RGB2YUVSSE2 *k)
+{
+    Sint16 y[8], u[8], v[8];
+    const int shifts[3] = { fixed->r_shift, fixed->g_shift, fixed->b_shift };
+    int i;
+
+    SDL_zeroa(y);
+    SDL_zeroa(u);
+    SDL_zeroa(v);
+    for (i = 0; i < 3; ++i) {
+        const int byte = shifts[i] / 8;
+
+        y[byte] = y[byte + 4] = fixed->y[i];
+        u[byte] = u[byte + 4] = fixed->u[i];
+        v[byte] = v[byte + 4] = fixed->v[i];
+    }
+    k->y = _mm_loadu_si128((const __m128i *)y);
+    k->u = _mm_loadu_si128((const __m128i *)u);
+    k->v = _mm_loadu_si128((const __m128i *)v);
+    k->round = _mm_set1_epi32(1 << 14);
+    k->y_offset = _mm_set1_epi32(fixed->y_offset);
+    k->uv_offset = _mm_set1_epi32(128);
+}
+
+/* One of Y, U or V for the 4 pixels of two pairs of pixels with 16-bit channels, as 32-bit lanes.
+   Each madd gives two partial sums per pixel, the shuffles bring them together. */
+static SDL_INLINE __m128i RGB2YUVValue4_SSE2(__m128i p01, __m128i p23, __m128i factors, __m128i round, __m128i offset)
+{
+    const __m128 a = _mm_castsi128_ps(_mm_madd_epi16(p01, factors));
+    const __m128 b = _mm_castsi128_ps(_mm_madd_epi16(p23, factors));
+    const __m128i sum = _mm_add_epi32(_mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))),
+                                      _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1))));
+
+    return _mm_add_epi32(_mm_srai_epi32(_mm_add_epi32(sum, round), 15), offset);
+}
+
+/* Y of 16 pixels, from their channels as 16-bit lanes, two pixels per vector */
+static SDL_INLINE __m128i RGB2YUVLuma16_SSE2(const RGB2YUVSSE2 *k, const __m128i p[8])
+{
+    const __m128i y0 = RGB2YUVValue4_SSE2(p[0], p[1], k->y, k->round, k->y_offset);
+    const __m128i y1 = RGB2YUVValue4_SSE2(p[2], p[3], k->y, k->round, k->y_offset);
+    const __m128i y2 = RGB2YUVValue4_SSE2(p[4], p[5], k->y, k->round, k->y_offset);
+    const __m128i y3 = RGB2YUVValue4_SSE2(p[6], p[7], k->y, k->round, k->y_offset);
+
+    return _mm_packus_epi16(_mm_packs_epi32(y0, y1), _mm_packs_epi32(y2, y3));
+}
+
+/* Converts 16 pixels at a time of one row, or of two rows when src2 is set, and returns how many pixels were done.
+   The averages of the chroma are the same as the ones of SDL_ConvertPixels_ARGB8888_to_YUV(). */
+static int SDL_ConvertPixels_RGB32_to_YUV_Row_SSE2(const RGB2YUVSSE2 *k, int width, Uint32 dst_format,
+                                                   const Uint8 *src1, const Uint8 *src2,
+                                                   Uint8 *y1, Uint8 *y2, Uint8 *u, Uint8 *v)
+{
+    const __m128i zero = _mm_setzero_si128();
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        __m128i p1[8], p2[8], c[4];
+        __m128i ya, u8, v8;
+        int i;
+
+        for (i = 0; i < 4; ++i) {
+            const __m128i s = _mm_loadu_si128((const __m128i *)(src1 + 4 * x + 16 * i));
+
+            p1[2 * i] = _mm_unpacklo_epi8(s, zero);
+            p1[2 * i + 1] = _mm_unpackhi_epi8(s, zero);
+        }
+        if (src2) {
+            for (i = 0; i < 4; ++i) {
+                const __m128i s = _mm_loadu_si128((const __m128i *)(src2 + 4 * x + 16 * i));
+
+                p2[2 * i] = _mm_unpacklo_epi8(s, zero);
+                p2[2 * i + 1] = _mm_unpackhi_epi8(s, zero);
+            }
+        }
+
+        /* The channels of each pair of pixels, and of the pair below it, added up and averaged */
+        for (i = 0; i < 4; ++i) {
+            __m128i a = p1[2 * i], b = p1[2 * i + 1];
+
+            if (src2) {
+                a = _mm_add_epi16(a, p2[2 * i]);
+                b = _mm_add_epi16(b, p2[2 * i + 1]);
+            }
+            a = _mm_add_epi16(a, _mm_unpackhi_epi64(a, a));
+            b = _mm_add_epi16(b, _mm_unpackhi_epi64(b, b));
+            c[i] = _mm_srli_epi16(_mm_unpacklo_epi64(a, b), src2 ? 2 : 1);
+        }
+        u8 = _mm_packs_epi32(RGB2YUVValue4_SSE2(c[0], c[1], k->u, k->round, k->uv_offset),
+                             RGB2YUVValue4_SSE2(c[2], c[3], k->u, k->round, k->uv_offset));
+        u8 = _mm_packus_epi16(u8, u8);
+        v8 = _mm_packs_epi32(RGB2YUVValue4_SSE2(c[0], c[1], k->v, k->round, k->uv_offset),
+                             RGB2YUVValue4_SSE2(c[2], c[3], k->v, k->round, k->uv_offset));
+        v8 = _mm_packus_epi16(v8, v8);
+
+        ya = RGB2YUVLuma16_SSE2(k, p1);
+
+        switch (dst_format) {
+        case SDL_PIXELFORMAT_YV12:
+        case SDL_PIXELFORMAT_IYUV:
+            _mm_storeu_si128((__m128i *)(y1 + x), ya);
+            _mm_storel_epi64((__m128i *)(u + x / 2), u8);
+            _mm_storel_epi64((__m128i *)(v + x / 2), v8);
+            break;
+        case SDL_PIXELFORMAT_NV12:
+            _mm_storeu_si128((__m128i *)(y1 + x), ya);
+            _mm_storeu_si128((__m128i *)(u + x), _mm_unpacklo_epi8(u8, v8));
+            break;
+        case SDL_PIXELFORMAT_NV21:
+            _mm_storeu_si128((__m128i *)(y1 + x), ya);
+            _mm_storeu_si128((__m128i *)(v + x), _mm_unpacklo_epi8(v8, u8));
+            break;
+        case SDL_PIXELFORMAT_YUY2:
+            u8 = _mm_unpacklo_epi8(u8, v8);
+            _mm_storeu_si128((__m128i *)(y1 + 2 * x), _mm_unpacklo_epi8(ya, u8));
+            _mm_storeu_si128((__m128i *)(y1 + 2 * x + 16), _mm_unpackhi_epi8(ya, u8));
+            break;
+        case SDL_PIXELFORMAT_UYVY:
+            u8 = _mm_unpacklo_epi8(u8, v8);
+            _mm_storeu_si128((__m128i *)(u + 2 * x), _mm_unpacklo_epi8(u8, ya));
+            _mm_storeu_si128((__m128i *)(u + 2 * x + 16), _mm_unpackhi_epi8(u8, ya));
+            break;
+        case SDL_PIXELFORMAT_YVYU:
+            v8 = _mm_unpacklo_epi8(v8, u8);
+            _mm_storeu_si128((__m128i *)(y1 + 2 * x), _mm_unpacklo_epi8(ya, v8));
+            _mm_storeu_si128((__m128i *)(y1 + 2 * x + 16), _mm_unpackhi_epi8(ya, v8));
+            break;
+        default:
+            break;
+        }
+
+        if (src2) {
+            _mm_storeu_si128((__m128i *)(y2 + x), RGB2YUVLuma16_SSE2(k, p2));
+        }
+    }
+    return x;
+}
+
+/* Converts from any 32-bit RGB format without an intermediate ARGB8888 buffer */
+static int SDL_ConvertPixels_RGB32_to_YUV_SSE2(int width, int height, const void *src, int src_pitch,
+                                               Uint32 dst_format, void *dst, int dst_pitch, const RGB2YUVFixed *fixed)
+{
+    const Uint32 mask = 0xFF;
+    const int packed = IsPacked4Format(dst_format);
+    const int rows = packed ? 1 : 2;
+    const int y_step = packed ? 2 : 1;
+    const int uv_step = packed ? 4 : ((dst_format == SDL_PIXELFORMAT_NV12 || dst_format == SDL_PIXELFORMAT_NV21) ? 2 : 1);
+    RGB2YUVSSE2 k;
+    Uint8 *plane_y, *plane_u, *plane_v;
+    Uint32 y_stride, uv_stride;
+    int row, x;
+
+    if (GetYUVPlanes(width, height, dst_format, dst, dst_pitch,
+                     (const Uint8 **)&plane_y, (const Uint8 **)&plane_u, (const Uint8 **)&plane_v,
+                     &y_stride, &uv_stride) < 0) {
+        return -1;
+    }
+    if (packed && dst_pitch < 4 * ((width + 1) / 2)) {
+        return SDL_SetError("Destination pitch is too small, expected at least %d\n", 4 * ((width + 1) / 2));
+    }
+    GetRGB2YUVSSE2(fixed, &k);
+
+    for (row = 0; row < height; row += rows) {
+        const Uint8 *src1 = (const Uint8 *)src + (size_t)row * src_pitch;
+        const Uint8 *src2 = (rows == 2 && row + 1 < height) ? src1 + src_pitch : NULL;
+        Uint8 *y1 = plane_y + (size_t)row * y_stride;
+        Uint8 *y2 = y1 + y_stride;
+        Uint8 *u = plane_u + (size_t)(row / rows) * uv_stride;
+        Uint8 *v = plane_v + (size_t)(row / rows) * uv_stride;
+
+        x = SDL_ConvertPixels_RGB32_to_YUV_Row_SSE2(&k, width, dst_format, src1, src2, y1, y2, u, v);
+
+        /* The last few pixels, two at a time, or one at the end of an odd width */
+        for (; x < width; x += 2) {
+            const int n = (x + 1 < width) ? 2 : 1;
+            int r = 0, g = 0, b = 0, count = 0, i;
+
+            for (i = 0; i < n; ++i) {
+                const Uint32 p1 = ((const Uint32 *)src1)[x + i];
+                const int r1 = (p1 >> fixed->r_shift) & mask, g1 = (p1 >> fixed->g_shift) & mask, b1 = (p1 >> fixed->b_shift) & mask;
+
+                y1[(x + i) * y_step] = RGB2YUVFixedValue(fixed->y, fixed->y_offset, r1, g1, b1);
+                if (packed && n == 1) {
+                    y1[(x + 1) * y_step] = y1[x * y_step];
+                }
+                r += r1;
+                g += g1;
+                b += b1;
+                ++count;
+                if (src2) {
+                    const Uint32 p2 = ((const Uint32 *)src2)[x + i];
+                    const int r2 = (p2 >> fixed->r_shift) & mask, g2 = (p2 >> fixed->g_shift) & mask, b2 = (p2 >> fixed->b_shift) & mask;
+
+                    y2[x + i] = RGB2YUVFixedValue(fixed->y, fixed->y_offset, r2, g2, b2);
+                    r += r2;
+                    g += g2;
+                    b += b2;
+                    ++count;
+                }
+            }
+            r /= count;
+            g /= count;
+            b /= count;
+            u[(x / 2) * uv_step] = RGB2YUVFixedValue(fixed->u, 128, r, g, b);
+            v[(x / 2) * uv_step] = RGB2YUVFixedValue(fixed->v, 128, r, g, b);
+        }
+    }
+    return 0;
+}
+#endif /* __SSE2__ */
+
 int SDL_ConvertPixels_RGB_to_YUV(int width, int height,
                                  Uint32 src_format, const void *src, int src_pitch,
                                  Uint32 dst_format, void *dst, int dst_pitch)
@@ -966,6 +1864,18 @@ int SDL_ConvertPixels_RGB_to_YUV(int width, int height,
     }
 #endif
 
+#ifdef __SSE2__
+    /* 32-bit RGB to FOURCC, in a single pass */
+    if ((SDL_GetBlitCPUFeatures() & SDL_CPU_SSE2) &&
+        (IsPlanar2x2Format(dst_format) || IsPacked4Format(dst_format))) {
+        RGB2YUVFixed fixed;
+
+        if (GetRGB2YUVFixed(width, height, src_format, &fixed)) {
+            return SDL_ConvertPixels_RGB32_to_YUV_SSE2(width, height, src, src_pitch, dst_format, dst, dst_pitch, &fixed);
+        }
+    }
+#endif
+
     /* ARGB8888 to FOURCC */
     if (src_format == SDL_PIXELFORMAT_ARGB8888) {
         return SDL_ConvertPixels_ARGB8888_to_YUV(width, height, src, src_pitch, dst_format, dst, dst_pitch);
@@ -1046,6 +1956,27 @@ static int SDL_ConvertPixels_YUV_to_YUV_Copy(int width, int height, Uint32 forma
         return 0;
     }
 
+    if (IsP01xFormat(format)) {
+        /* Y plane */
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, (size_t)width * 2);
+            src = (const Uint8 *)src + src_pitch;
+            dst = (Uint8 *)dst + dst_pitch;
+        }
+
+        /* U/V plane is half the height of the Y plane, rounded up, like NV12 in 16-bit samples */
+        height = (height + 1) / 2;
+        width = 4 * ((width + 1) / 2);
+        src_pitch = 2 * (2 * ((src_pitch / 2 + 1) / 2));
+        dst_pitch = 2 * (2 * ((dst_pitch / 2 + 1) / 2));
+        for (i = height; i--;) {
+            SDL_memcpy(dst, src, width);
+            src = (const Uint8 *)src + src_pitch;
+            dst = (Uint8 *)dst + dst_pitch;
+        }
+        return 0;
+    }
+
     return SDL_SetError("SDL_ConvertPixels_YUV_to_YUV_Copy: Unsupported YUV format: %s", SDL_GetPixelFormatName(format));
 }
 
@@ -1977,6 +2908,8 @@ int SDL_ConvertPixels_YUV_to_YUV(int width, int height,
         return SDL_ConvertPixels_Planar2x2_to_Packed4(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
     } else if (IsPacked4Format(src_format) && IsPlanar2x2Format(dst_format)) {
         return SDL_ConvertPixels_Packed4_to_Planar2x2(width, height, src_format, src, src_pitch, dst_format, dst, dst_pitch);
+    } else if (IsP01xFormat(src_format) && dst_format == SDL_PIXELFORMAT_NV12) {
+        return SDL_ConvertPixels_P01x_to_NV12(width, height, src_format, src, src_pitch, dst, dst_pitch);
     } else {
         return SDL_SetError("SDL_ConvertPixels_YUV_to_YUV: Unsupported YUV conversion: %s -> %s", SDL_GetPixelFormatName(src_format),
                             SDL_GetPixelFormatName(dst_format));
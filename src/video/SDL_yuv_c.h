@@ -30,6 +30,13 @@ extern int SDL_ConvertPixels_YUV_to_RGB(int width, int height, Uint32 src_format
 extern int SDL_ConvertPixels_RGB_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 extern int SDL_ConvertPixels_YUV_to_YUV(int width, int height, Uint32 src_format, const void *src, int src_pitch, Uint32 dst_format, void *dst, int dst_pitch);
 
+/* Scales srcrect of a width x height YUV image to dst_w x dst_h RGB pixels while converting it, with nearest
+   neighbor sampling like SDL_SoftStretch(). Returns SDL_FALSE without writing anything if there is no direct
+   conversion to dst_format or memory runs out, for the caller to convert and stretch separately. */
+extern SDL_bool SDL_StretchPixels_YUV_to_RGB(int width, int height, Uint32 src_format, const void *src, int src_pitch,
+                                             const SDL_Rect *srcrect, int dst_w, int dst_h,
+                                             Uint32 dst_format, void *dst, int dst_pitch);
+
 
 extern int SDL_CalculateYUVSize(Uint32 format, int w, int h, size_t *size, int *pitch);
 
@@ -85,6 +85,25 @@ my %set_rgba_string = (
     "BGRA8888" => "_pixel = (_B << 24) | (_G << 16) | (_R << 8) | _A;",
 );
 
+# The bit position of every channel, the unused byte of the 888 formats counts as alpha
+my %channel_shift = (
+    "RGB888" => { "A" => 24, "R" => 16, "G" => 8, "B" => 0 },
+    "BGR888" => { "A" => 24, "B" => 16, "G" => 8, "R" => 0 },
+    "ARGB8888" => { "A" => 24, "R" => 16, "G" => 8, "B" => 0 },
+    "RGBA8888" => { "R" => 24, "G" => 16, "B" => 8, "A" => 0 },
+    "ABGR8888" => { "A" => 24, "B" => 16, "G" => 8, "R" => 0 },
+    "BGRA8888" => { "B" => 24, "G" => 16, "R" => 8, "A" => 0 },
+);
+
+# The vector blitters, built from SDL_blit_simd.h:
+# backend define, function suffix, blit CPU flag, compile time condition
+my @simd_backends = (
+    [ "BLITV_AVX2", "AVX2", "SDL_CPU_AVX2", "defined(SDL_AVX2_INTRINSICS)" ],
+    [ "BLITV_SSE2", "SSE2", "SDL_CPU_SSE2", "defined(__SSE2__)" ],
+    [ "BLITV_NEON", "NEON", "SDL_CPU_NEON", "defined(__ARM_NEON)" ],
+    [ "BLITV_ALTIVEC", "AltiVec", "SDL_CPU_ALTIVEC", "defined(SDL_ALTIVEC_BLITTERS) && SDL_BYTEORDER == SDL_BIG_ENDIAN" ],
+);
+
 sub open_file {
     my $name = shift;
     open(FILE, ">$name.new") || die "Cant' open $name.new: $!";
@@ -170,6 +189,27 @@ sub output_copyfuncname
     print FILE "$suffix";
 }
 
+sub simd_funcname
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+
+    my $name = "SDL_Blit_${src}_${dst}";
+    if ( $modulate ) {
+        $name = "${name}_Modulate";
+    }
+    if ( $blend ) {
+        $name = "${name}_Blend";
+    }
+    if ( $scale ) {
+        $name = "${name}_Scale";
+    }
+    return $name;
+}
+
 sub get_rgba
 {
     my $prefix = shift;
@@ -576,6 +616,332 @@ __EOF__
 __EOF__
 }
 
+sub output_simd_helpers
+{
+    print FILE <<__EOF__;
+/*
+ * Vector versions of the blitters in SDL_blit_auto.c, written with the
+ * operations of SDL_blit_simd.h. SDL_blit_auto.c includes this once for
+ * every instruction set it is built with.
+ *
+ * The pixels are moved into the channel order of the destination, with
+ * alpha in the top byte, and give exactly the results of the scalar code.
+ */
+
+/* Copies the alpha byte of every pixel to its other bytes */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_SpreadAlpha)(BLITV v)
+{
+    v = BLITV_SRL32(v, 24);
+    v = BLITV_OR(v, BLITV_SLL32(v, 8));
+    return BLITV_OR(v, BLITV_SLL32(v, 16));
+}
+
+/* The modulation for every byte, 255 for what isn't modulated */
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_Modulation)(const SDL_BlitInfo *info, int Rshift, int Gshift, int Bshift)
+{
+    Uint32 modulate = 0xFFFFFFFF;
+
+    if (info->flags & SDL_COPY_MODULATE_COLOR) {
+        modulate = 0xFF000000 | ((Uint32)info->r << Rshift) | ((Uint32)info->g << Gshift) | ((Uint32)info->b << Bshift);
+    }
+    if (info->flags & SDL_COPY_MODULATE_ALPHA) {
+        modulate = (modulate & 0x00FFFFFF) | ((Uint32)info->a << 24);
+    }
+    return BLITV_SPLAT32(modulate);
+}
+
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(SDL_Blit_Blend)(BLITV s, BLITV d, int mode)
+{
+    const BLITV amask = BLITV_SPLAT32(0xFF000000);
+    const BLITV sA = BLITV_NAME(SDL_Blit_SpreadAlpha)(s);
+    const BLITV inv_sA = BLITV_ANDNOT(BLITV_SPLAT32(0xFFFFFFFF), sA);
+
+    switch (mode) {
+    case SDL_COPY_BLEND:
+        /* This goes away if we ever use premultiplied alpha */
+        s = BLITV_SELECT(amask, s, BLITV_MULDIV255(s, sA));
+        return BLITV_ADD8(s, BLITV_MULDIV255(inv_sA, d));
+    case SDL_COPY_ADD:
+        s = BLITV_MULDIV255(s, sA);
+        return BLITV_SELECT(amask, d, BLITV_ADDS8(s, d));
+    case SDL_COPY_MOD:
+        return BLITV_SELECT(amask, d, BLITV_MULDIV255(s, d));
+    case SDL_COPY_MUL:
+        /* d * (s + 255 - sA) / 255, split at 255 so the products fit in 16 bits */
+        s = BLITV_ADDS8(BLITV_MULDIV255(d, BLITV_ADDS8(s, inv_sA)),
+                        BLITV_MULDIV255(d, BLITV_SUBS8(s, sA)));
+        return BLITV_SELECT(amask, d, s);
+    default:
+        return d;
+    }
+}
+
+__EOF__
+}
+
+# Moves the channels of the source pixels to where the destination has them
+sub simd_convert
+{
+    my $src = shift;
+    my $dst = shift;
+    my %masks;
+    my $expr = "";
+
+    foreach my $channel ("R", "G", "B", "A") {
+        my $shift = $channel_shift{$dst}{$channel} - $channel_shift{$src}{$channel};
+        $masks{$shift} = ($masks{$shift} || 0) | (0xFF << $channel_shift{$src}{$channel});
+    }
+    if (scalar(keys %masks) == 1 && defined $masks{0}) {
+        return;
+    }
+    foreach my $shift (sort { $a <=> $b } keys %masks) {
+        my $mask = $masks{$shift};
+        my $whole = ($shift >= 0) ? (0xFFFFFFFF >> $shift) : ((0xFFFFFFFF << -$shift) & 0xFFFFFFFF);
+        my $term = ($mask == $whole) ? "s" : sprintf("BLITV_AND(s, BLITV_SPLAT32(0x%08X))", $mask);
+        if ($shift > 0) {
+            $term = "BLITV_SLL32($term, $shift)";
+        } elsif ($shift < 0) {
+            $term = "BLITV_SRL32($term, " . -$shift . ")";
+        }
+        $expr = ($expr eq "") ? $term : "BLITV_OR($expr, $term)";
+    }
+    print FILE <<__EOF__;
+    s = $expr;
+__EOF__
+}
+
+sub simd_pixels_args
+{
+    my $blend = shift;
+    my $modulate = shift;
+    my $s = shift;
+    my $d = shift;
+    my $args = $s;
+
+    if ( $blend ) {
+        $args = "$args, $d";
+    }
+    if ( $modulate ) {
+        $args = "$args, modulate";
+    }
+    if ( $blend ) {
+        $args = "$args, mode";
+    }
+    return $args;
+}
+
+sub output_simd_pixels
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $name = simd_funcname($src, $dst, $modulate, $blend, 0);
+    my $dst_has_alpha = ($dst =~ /A/) ? 1 : 0;
+    my $src_has_alpha = ($src =~ /A/) ? 1 : 0;
+    my $params = "BLITV s";
+
+    if ( $blend ) {
+        $params = "$params, BLITV d";
+    }
+    if ( $modulate ) {
+        $params = "$params, BLITV modulate";
+    }
+    if ( $blend ) {
+        $params = "$params, int mode";
+    }
+    print FILE <<__EOF__;
+BLITV_TARGET SDL_FORCE_INLINE BLITV BLITV_NAME(${name}_Pixels)($params)
+{
+__EOF__
+    if ( !$modulate && !$blend && $src eq $dst ) {
+        print FILE <<__EOF__;
+    return s;
+}
+
+__EOF__
+        return;
+    }
+    simd_convert($src, $dst);
+    if ( !$src_has_alpha && ($dst_has_alpha || $blend) ) {
+        print FILE <<__EOF__;
+    s = BLITV_OR(s, BLITV_SPLAT32(0xFF000000));
+__EOF__
+    }
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    s = BLITV_MULDIV255(s, modulate);
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    s = BLITV_NAME(SDL_Blit_Blend)(s, d, mode);
+__EOF__
+    }
+    if ( $dst_has_alpha ) {
+        print FILE <<__EOF__;
+    return s;
+}
+
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+    return BLITV_AND(s, BLITV_SPLAT32(0x00FFFFFF));
+}
+
+__EOF__
+    }
+}
+
+sub output_simd_func
+{
+    my $src = shift;
+    my $dst = shift;
+    my $modulate = shift;
+    my $blend = shift;
+    my $scale = shift;
+    my $name = simd_funcname($src, $dst, $modulate, $blend, $scale);
+    my $pixels = "BLITV_NAME(" . simd_funcname($src, $dst, $modulate, $blend, 0) . "_Pixels)";
+    my $args = simd_pixels_args($blend, $modulate, "BLITV_LOAD(src)", "BLITV_LOAD(dst)");
+    my $aligned_args = simd_pixels_args($blend, $modulate, "BLITV_LOADA(src)", "BLITV_LOADA(dst)");
+    my $bufargs = simd_pixels_args($blend, $modulate, "BLITV_LOAD(srcbuf)", "BLITV_LOAD(dstbuf)");
+
+    print FILE <<__EOF__;
+BLITV_TARGET static void BLITV_NAME($name)(SDL_BlitInfo *info)
+{
+__EOF__
+    if ( $modulate ) {
+        print FILE <<__EOF__;
+    const BLITV modulate = BLITV_NAME(SDL_Blit_Modulation)(info, $channel_shift{$dst}{"R"}, $channel_shift{$dst}{"G"}, $channel_shift{$dst}{"B"});
+__EOF__
+    }
+    if ( $blend ) {
+        print FILE <<__EOF__;
+    const int mode = info->flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD | SDL_COPY_MUL);
+__EOF__
+    }
+    print FILE <<__EOF__;
+    Uint32 srcbuf[BLITV_PIXELS], dstbuf[BLITV_PIXELS];
+__EOF__
+    if ( $scale ) {
+        $args = simd_pixels_args($blend, $modulate, "BLITV_LOAD(srcbuf)", "BLITV_LOAD(dst)");
+        print FILE <<__EOF__;
+    Uint64 srcx;
+    Uint64 posy, posx;
+    Uint64 incy, incx;
+
+    incy = ((Uint64)info->src_h << 16) / info->dst_h;
+    incx = ((Uint64)info->src_w << 16) / info->dst_w;
+    posy = incy / 2;
+
+    while (info->dst_h--) {
+        const Uint8 *src = info->src + ((posy >> 16) * info->src_pitch);
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+        posx = incx / 2;
+
+        for (; n > 0; n -= BLITV_PIXELS) {
+            const int count = SDL_min(n, BLITV_PIXELS);
+            int i;
+
+            for (i = 0; i < count; ++i) {
+                srcx = posx >> 16;
+                srcbuf[i] = *(const Uint32 *)(src + (srcx * 4));
+                posx += incx;
+            }
+            if (count == BLITV_PIXELS) {
+                BLITV_STORE(dst, $pixels($args));
+                dst += BLITV_PIXELS;
+            } else {
+                /* The last few pixels go through a full vector */
+                for (; i < BLITV_PIXELS; ++i) {
+                    srcbuf[i] = 0;
+                }
+                SDL_zeroa(dstbuf);
+                SDL_memcpy(dstbuf, dst, count * sizeof(Uint32));
+                BLITV_STORE(dstbuf, $pixels($bufargs));
+                SDL_memcpy(dst, dstbuf, count * sizeof(Uint32));
+            }
+        }
+        posy += incy;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    } else {
+        print FILE <<__EOF__;
+
+    while (info->dst_h--) {
+        const Uint32 *src = (const Uint32 *)info->src;
+        Uint32 *dst = (Uint32 *)info->dst;
+        int n = info->dst_w;
+
+        if (BLITV_ALIGNED(src) && BLITV_ALIGNED(dst)) {
+            /* Rows of surfaces created with SDL_SIMD_PITCH */
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STOREA(dst, $pixels($aligned_args));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        } else {
+            for (; n >= BLITV_PIXELS; n -= BLITV_PIXELS) {
+                BLITV_STORE(dst, $pixels($args));
+                src += BLITV_PIXELS;
+                dst += BLITV_PIXELS;
+            }
+        }
+        if (n > 0) {
+            /* The last few pixels go through a full vector */
+            SDL_zeroa(srcbuf);
+            SDL_zeroa(dstbuf);
+            SDL_memcpy(srcbuf, src, n * sizeof(Uint32));
+            SDL_memcpy(dstbuf, dst, n * sizeof(Uint32));
+            BLITV_STORE(dstbuf, $pixels($bufargs));
+            SDL_memcpy(dst, dstbuf, n * sizeof(Uint32));
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+
+__EOF__
+    }
+}
+
+sub output_simd_c
+{
+    my $src = shift;
+    my $dst = shift;
+
+    for (my $modulate = 0; $modulate <= 1; ++$modulate) {
+        for (my $blend = 0; $blend <= 1; ++$blend) {
+            output_simd_pixels($src, $dst, $modulate, $blend);
+            for (my $scale = 0; $scale <= 1; ++$scale) {
+                if ( $modulate || $blend || $scale ) {
+                    output_simd_func($src, $dst, $modulate, $blend, $scale);
+                }
+            }
+        }
+    }
+}
+
+sub output_simd_includes
+{
+    foreach my $backend (@simd_backends) {
+        my ($define, $suffix, $cpu, $condition) = @$backend;
+        print FILE <<__EOF__;
+#if $condition
+#define $define
+#include "SDL_blit_simd.h"
+#include "SDL_blit_auto_simd.h"
+#undef $define
+#endif
+__EOF__
+    }
+    print FILE "\n";
+}
+
 sub output_copyfunc_h
 {
 }
@@ -590,11 +956,11 @@ sub output_copyinc
 __EOF__
 }
 
-sub output_copyfunctable
+sub output_copyfunctable_entries
 {
-    print FILE <<__EOF__;
-SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
-__EOF__
+    my $cpu = shift;
+    my $suffix = shift;
+
     for (my $i = 0; $i <= $#src_formats; ++$i) {
         my $src = $src_formats[$i];
         for (my $j = 0; $j <= $#dst_formats; ++$j) {
@@ -633,14 +999,28 @@ __EOF__
                             if ( $flags eq "" ) {
                                 $flags = "0";
                             }
-                            print FILE "($flags), SDL_CPU_ANY,";
-                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, " },\n");
+                            print FILE "($flags), $cpu,";
+                            output_copyfuncname("", $src_formats[$i], $dst_formats[$j], $modulate, $blend, $scale, 0, "$suffix },\n");
                         }
                     }
                 }
             }
         }
     }
+}
+
+sub output_copyfunctable
+{
+    print FILE <<__EOF__;
+SDL_BlitFuncEntry SDL_GeneratedBlitFuncTable[] = {
+__EOF__
+    foreach my $backend (@simd_backends) {
+        my ($define, $suffix, $cpu, $condition) = @$backend;
+        print FILE "#if $condition\n";
+        output_copyfunctable_entries($cpu, "_$suffix");
+        print FILE "#endif\n";
+    }
+    output_copyfunctable_entries("SDL_CPU_ANY", "");
     print FILE <<__EOF__;
     { 0, 0, 0, 0, NULL }
 };
@@ -681,5 +1061,15 @@ for (my $i = 0; $i <= $#src_formats; ++$i) {
         output_copyfunc_c($src_formats[$i], $dst_formats[$j]);
     }
 }
+output_simd_includes();
 output_copyfunctable();
 close_file("SDL_blit_auto.c");
+
+open_file("SDL_blit_auto_simd.h");
+output_simd_helpers();
+for (my $i = 0; $i <= $#src_formats; ++$i) {
+    for (my $j = 0; $j <= $#dst_formats; ++$j) {
+        output_simd_c($src_formats[$i], $dst_formats[$j]);
+    }
+}
+close_file("SDL_blit_auto_simd.h");
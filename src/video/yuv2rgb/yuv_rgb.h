@@ -30,4 +30,10 @@
 // yuv to rgb, lsx implementation
 #include "yuv_rgb_lsx.h"
 
+// yuv to rgb, avx2 implementation
+#include "yuv_rgb_avx2.h"
+
+// yuv to rgb, altivec implementation
+#include "yuv_rgb_altivec.h"
+
 #endif /* YUV_RGB_H_ */
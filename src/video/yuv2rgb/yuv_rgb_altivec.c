@@ -0,0 +1,276 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "../../SDL_internal.h"
+
+#if SDL_HAVE_YUV
+#include "yuv_rgb.h"
+#include "yuv_rgb_internal.h"
+
+#ifdef YUV_RGB_ALTIVEC
+#ifdef HAVE_ALTIVEC_H
+#include <altivec.h>
+#endif
+
+typedef struct
+{
+	vector signed short y_shift;
+	vector signed short y_factor;
+	vector signed short uv_shift;
+	vector signed short v_r_factor;
+	vector signed short u_g_factor;
+	vector signed short v_g_factor;
+	vector signed short u_b_factor;
+	/* Two permutes per output vector for RGB24, see yuv_altivec_save_rgb24() */
+	vector unsigned char rgb24_perm[6];
+} YUVAltiVecConstants;
+
+static SDL_INLINE vector signed short yuv_altivec_splat16(int16_t value)
+{
+	union {
+		vector signed short v;
+		int16_t s[8];
+	} u;
+	int i;
+
+	for (i = 0; i < 8; ++i) {
+		u.s[i] = value;
+	}
+	return u.v;
+}
+
+static void yuv_altivec_init(const YUV2RGBParam *param, YUVAltiVecConstants *constants)
+{
+	union {
+		vector unsigned char v;
+		uint8_t b[16];
+	} u;
+	int k, j;
+
+	constants->y_shift = yuv_altivec_splat16(param->y_shift);
+	constants->y_factor = yuv_altivec_splat16(param->y_factor);
+	constants->uv_shift = yuv_altivec_splat16(128);
+	constants->v_r_factor = yuv_altivec_splat16(param->v_r_factor);
+	constants->u_g_factor = yuv_altivec_splat16(param->u_g_factor);
+	constants->v_g_factor = yuv_altivec_splat16(param->v_g_factor);
+	constants->u_b_factor = yuv_altivec_splat16(param->u_b_factor);
+
+	/* Byte j of output vector k is channel n % 3 of pixel n / 3, with n = 16 * k + j.
+	   The first permute takes R and G from their vectors, the second one adds B. */
+	for (k = 0; k < 3; ++k) {
+		for (j = 0; j < 16; ++j) {
+			const int n = 16 * k + j;
+			const int pixel = n / 3, channel = n % 3;
+			u.b[j] = (uint8_t)(channel == 1 ? 16 + pixel : pixel);
+		}
+		constants->rgb24_perm[2 * k] = u.v;
+		for (j = 0; j < 16; ++j) {
+			const int n = 16 * k + j;
+			const int pixel = n / 3, channel = n % 3;
+			u.b[j] = (uint8_t)(channel == 2 ? 16 + pixel : j);
+		}
+		constants->rgb24_perm[2 * k + 1] = u.v;
+	}
+}
+
+/* AltiVec only loads and stores aligned vectors, so shift the data into place */
+static SDL_INLINE vector unsigned char yuv_altivec_load(const uint8_t *p)
+{
+	const vector unsigned char MSQ = vec_ld(0, p);
+	const vector unsigned char LSQ = vec_ld(15, p);
+	return vec_perm(MSQ, LSQ, vec_lvsl(0, p));
+}
+
+static SDL_INLINE void yuv_altivec_store(uint8_t *p, vector unsigned char v)
+{
+	if (((uintptr_t)p & 15) == 0) {
+		vec_st(v, 0, p);
+	} else {
+		union {
+			vector unsigned char v;
+			uint8_t b[16];
+		} u;
+		u.v = v;
+		SDL_memcpy(p, u.b, 16);
+	}
+}
+
+/* Adds the Y terms of 16 pixels to the U and V terms of the 8 pairs of pixels they share,
+   and returns the 16 R, G and B values as bytes */
+static SDL_INLINE void yuv_altivec_y2rgb(const YUVAltiVecConstants *constants,
+	vector signed short y_1, vector signed short y_2,
+	vector signed short r_uv, vector signed short g_uv, vector signed short b_uv,
+	vector unsigned char *r, vector unsigned char *g, vector unsigned char *b)
+{
+	const vector signed short zero = vec_splat_s16(0);
+	const vector unsigned short shift = vec_splat_u16(PRECISION);
+
+	y_1 = vec_mladd(vec_sub(y_1, constants->y_shift), constants->y_factor, zero);
+	y_2 = vec_mladd(vec_sub(y_2, constants->y_shift), constants->y_factor, zero);
+
+	*r = vec_packsu(
+		vec_sra(vec_add(vec_mergeh(r_uv, r_uv), y_1), shift),
+		vec_sra(vec_add(vec_mergel(r_uv, r_uv), y_2), shift));
+	*g = vec_packsu(
+		vec_sra(vec_add(vec_mergeh(g_uv, g_uv), y_1), shift),
+		vec_sra(vec_add(vec_mergel(g_uv, g_uv), y_2), shift));
+	*b = vec_packsu(
+		vec_sra(vec_add(vec_mergeh(b_uv, b_uv), y_1), shift),
+		vec_sra(vec_add(vec_mergel(b_uv, b_uv), y_2), shift));
+}
+
+/* Interleaves 16 pixels of four byte channels, given in memory order */
+static SDL_INLINE void yuv_altivec_save_32(vector unsigned char c0, vector unsigned char c1,
+	vector unsigned char c2, vector unsigned char c3, uint8_t *rgb_ptr)
+{
+	const vector unsigned short lo_01 = (vector unsigned short)vec_mergeh(c0, c1);
+	const vector unsigned short hi_01 = (vector unsigned short)vec_mergel(c0, c1);
+	const vector unsigned short lo_23 = (vector unsigned short)vec_mergeh(c2, c3);
+	const vector unsigned short hi_23 = (vector unsigned short)vec_mergel(c2, c3);
+
+	yuv_altivec_store(rgb_ptr, (vector unsigned char)vec_mergeh(lo_01, lo_23));
+	yuv_altivec_store(rgb_ptr+16, (vector unsigned char)vec_mergel(lo_01, lo_23));
+	yuv_altivec_store(rgb_ptr+32, (vector unsigned char)vec_mergeh(hi_01, hi_23));
+	yuv_altivec_store(rgb_ptr+48, (vector unsigned char)vec_mergel(hi_01, hi_23));
+}
+
+static SDL_INLINE void yuv_altivec_save_rgb24(vector unsigned char r, vector unsigned char g,
+	vector unsigned char b, const YUVAltiVecConstants *constants, uint8_t *rgb_ptr)
+{
+	int k;
+
+	for (k = 0; k < 3; ++k) {
+		const vector unsigned char rg = vec_perm(r, g, constants->rgb24_perm[2 * k]);
+		yuv_altivec_store(rgb_ptr+16*k, vec_perm(rg, b, constants->rgb24_perm[2 * k + 1]));
+	}
+}
+
+static SDL_INLINE void yuv_altivec_save_rgb565(vector unsigned char r, vector unsigned char g,
+	vector unsigned char b, uint8_t *rgb_ptr)
+{
+	const vector unsigned char zero = vec_splat_u8(0);
+	/* The high byte of a 16-bit lane comes first, so merging R first shifts it left by 8 */
+	const vector unsigned short r_11 = vec_splat_u16(11);
+	const vector unsigned short lo = vec_or(vec_or(
+		vec_sl(vec_sr((vector unsigned short)vec_mergeh(r, zero), r_11), r_11),
+		vec_sl(vec_sr((vector unsigned short)vec_mergeh(zero, g), vec_splat_u16(2)), vec_splat_u16(5))),
+		vec_sr((vector unsigned short)vec_mergeh(zero, b), vec_splat_u16(3)));
+	const vector unsigned short hi = vec_or(vec_or(
+		vec_sl(vec_sr((vector unsigned short)vec_mergel(r, zero), r_11), r_11),
+		vec_sl(vec_sr((vector unsigned short)vec_mergel(zero, g), vec_splat_u16(2)), vec_splat_u16(5))),
+		vec_sr((vector unsigned short)vec_mergel(zero, b), vec_splat_u16(3)));
+
+	yuv_altivec_store(rgb_ptr, (vector unsigned char)lo);
+	yuv_altivec_store(rgb_ptr+16, (vector unsigned char)hi);
+}
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_rgb565_altivec
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_rgb24_altivec
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_rgba_altivec
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_bgra_altivec
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_argb_altivec
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv420_abgr_altivec
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_rgb565_altivec
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_rgb24_altivec
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_rgba_altivec
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_bgra_altivec
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_argb_altivec
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuv422_abgr_altivec
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_rgb565_altivec
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_rgb24_altivec
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_rgba_altivec
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_bgra_altivec
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_argb_altivec
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_altivec_func.h"
+
+#define ALTIVEC_FUNCTION_NAME	yuvnv12_abgr_altivec
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_altivec_func.h"
+
+#endif /* YUV_RGB_ALTIVEC */
+
+#endif /* SDL_HAVE_YUV */
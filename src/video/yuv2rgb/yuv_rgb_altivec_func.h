@@ -0,0 +1,268 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	ALTIVEC_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* The arithmetic is that of yuv_rgb_sse_func.h, 32 pixels of two lines at a time, done as
+   two halves of 16 pixels. Vectors are big endian, so the first byte of a 16-bit or 32-bit
+   lane is its most significant one. */
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+/* The Y values of 16 pixels as two vectors of 16-bit lanes */
+#define READ_Y(y_ptr, half, Y1, Y2) \
+{ \
+	const vector unsigned char y_8 = yuv_altivec_load((y_ptr)+16*(half)); \
+	Y1 = (vector signed short)vec_mergeh(zero_8, y_8); \
+	Y2 = (vector signed short)vec_mergel(zero_8, y_8); \
+}
+
+/* The 8 U and V values of 16 pixels */
+#define READ_UV(half) \
+{ \
+	const vector unsigned char u_8 = yuv_altivec_load(u_ptr); \
+	const vector unsigned char v_8 = yuv_altivec_load(v_ptr); \
+	u = (vector signed short)((half) ? vec_mergel(zero_8, u_8) : vec_mergeh(zero_8, u_8)); \
+	v = (vector signed short)((half) ? vec_mergel(zero_8, v_8) : vec_mergeh(zero_8, v_8)); \
+}
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+#define READ_Y(y_ptr, half, Y1, Y2) \
+	Y1 = (vector signed short)vec_sr((vector unsigned short)yuv_altivec_load((y_ptr)+32*(half)), vec_splat_u16(8)); \
+	Y2 = (vector signed short)vec_sr((vector unsigned short)yuv_altivec_load((y_ptr)+32*(half)+16), vec_splat_u16(8)); \
+
+/* vec_splat_u32() takes -16..15, shifts only use the low five bits of the count, so -8 shifts by 24 */
+#define READ_UV(half) \
+	u = (vector signed short)vec_pack( \
+		vec_sr((vector unsigned int)yuv_altivec_load(u_ptr+32*(half)), vec_splat_u32(-8)), \
+		vec_sr((vector unsigned int)yuv_altivec_load(u_ptr+32*(half)+16), vec_splat_u32(-8))); \
+	v = (vector signed short)vec_pack( \
+		vec_sr((vector unsigned int)yuv_altivec_load(v_ptr+32*(half)), vec_splat_u32(-8)), \
+		vec_sr((vector unsigned int)yuv_altivec_load(v_ptr+32*(half)+16), vec_splat_u32(-8))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr, half, Y1, Y2) \
+{ \
+	const vector unsigned char y_8 = yuv_altivec_load((y_ptr)+16*(half)); \
+	Y1 = (vector signed short)vec_mergeh(zero_8, y_8); \
+	Y2 = (vector signed short)vec_mergel(zero_8, y_8); \
+}
+
+#define READ_UV(half) \
+	u = (vector signed short)vec_sr((vector unsigned short)yuv_altivec_load(u_ptr+16*(half)), vec_splat_u16(8)); \
+	v = (vector signed short)vec_sr((vector unsigned short)yuv_altivec_load(v_ptr+16*(half)), vec_splat_u16(8)); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_rgb565(R, G, B, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_rgb24(R, G, B, &constants, rgb_ptr); \
+
+/* The packed formats are written as bytes, in memory order */
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_32(R, G, B, alpha_8, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_32(B, G, R, alpha_8, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_32(alpha_8, R, G, B, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_altivec_save_32(alpha_8, B, G, R, rgb_ptr); \
+
+#else
+#error SAVE_LINE unimplemented
+#endif
+
+#define YUV2RGB_16(half) \
+	vector signed short u, v, r_uv, g_uv, b_uv, y_1, y_2; \
+	vector unsigned char r_8_1, g_8_1, b_8_1, r_8_2, g_8_2, b_8_2; \
+	\
+	READ_UV(half) \
+	u = vec_sub(u, constants.uv_shift); \
+	v = vec_sub(v, constants.uv_shift); \
+	r_uv = vec_mladd(v, constants.v_r_factor, zero_16); \
+	g_uv = vec_mladd(u, constants.u_g_factor, vec_mladd(v, constants.v_g_factor, zero_16)); \
+	b_uv = vec_mladd(u, constants.u_b_factor, zero_16); \
+	\
+	READ_Y(y_ptr1, half, y_1, y_2) \
+	yuv_altivec_y2rgb(&constants, y_1, y_2, r_uv, g_uv, b_uv, &r_8_1, &g_8_1, &b_8_1); \
+	if (uv_y_sample_interval > 1) \
+	{ \
+		READ_Y(y_ptr2, half, y_1, y_2) \
+		yuv_altivec_y2rgb(&constants, y_1, y_2, r_uv, g_uv, b_uv, &r_8_2, &g_8_2, &b_8_2); \
+	} \
+	else \
+	{ \
+		r_8_2 = g_8_2 = b_8_2 = zero_8; \
+	} \
+
+
+void ALTIVEC_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+	const vector unsigned char zero_8 = vec_splat_u8(0);
+	const vector signed short zero_16 = vec_splat_s16(0);
+	const vector unsigned char alpha_8 = vec_splat_u8(-1);
+	YUVAltiVecConstants constants;
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+	/* The same lines and columns as the SSE functions are left to the C code.
+	   AltiVec loads can't read past the aligned block holding the last byte they need,
+	   but this keeps the output the same on every platform. */
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	const int fix_read_nv12 = ((width & 31) == 0);
+#else
+	const int fix_read_nv12 = 0;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	const int fix_read_422 = 1;
+#else
+	const int fix_read_422 = 0;
+#endif
+
+	(void)alpha_8;
+	yuv_altivec_init(param, &constants);
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)) - fix_read_422; ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31) - fix_read_nv12; xpos+=32)
+			{
+				{
+					YUV2RGB_16(0)
+					SAVE_LINE(r_8_1, g_8_1, b_8_1, rgb_ptr1)
+					if (uv_y_sample_interval > 1)
+					{
+						SAVE_LINE(r_8_2, g_8_2, b_8_2, rgb_ptr2)
+					}
+				}
+				{
+					YUV2RGB_16(1)
+					SAVE_LINE(r_8_1, g_8_1, b_8_1, rgb_ptr1+16*rgb_pixel_stride)
+					if (uv_y_sample_interval > 1)
+					{
+						SAVE_LINE(r_8_2, g_8_2, b_8_2, rgb_ptr2+16*rgb_pixel_stride)
+					}
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		if (fix_read_422) {
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+			ypos += uv_y_sample_interval;
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		uint32_t converted = (width & ~31);
+		if (fix_read_nv12) {
+			converted -= 32;
+		}
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef ALTIVEC_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef READ_Y
+#undef READ_UV
+#undef SAVE_LINE
+#undef YUV2RGB_16
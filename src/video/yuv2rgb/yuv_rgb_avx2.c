@@ -0,0 +1,215 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+#include "../../SDL_internal.h"
+
+#if SDL_HAVE_YUV
+#include "yuv_rgb.h"
+#include "yuv_rgb_internal.h"
+#include "SDL_cpuinfo.h"
+
+#ifdef SDL_AVX2_INTRINSICS
+
+/* Adds the Y terms of 32 pixels to the U and V terms of the 16 pairs of pixels they share,
+   and returns the 32 R, G and B values as bytes in order */
+SDL_TARGETING("avx2") static SDL_INLINE void yuv_avx2_y2rgb(const YUV2RGBParam *param, __m256i y,
+	__m256i r_uv, __m256i g_uv, __m256i b_uv, __m256i *r, __m256i *g, __m256i *b)
+{
+	/* Unpacking works within 128-bit lanes, so the low halves hold pixels 0-7 and 16-23,
+	   and the high halves pixels 8-15 and 24-31, for the U and V terms as well as for Y */
+	__m256i y_1 = _mm256_unpacklo_epi8(y, _mm256_setzero_si256());
+	__m256i y_2 = _mm256_unpackhi_epi8(y, _mm256_setzero_si256());
+
+	y_1 = _mm256_mullo_epi16(_mm256_sub_epi16(y_1, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor));
+	y_2 = _mm256_mullo_epi16(_mm256_sub_epi16(y_2, _mm256_set1_epi16(param->y_shift)), _mm256_set1_epi16(param->y_factor));
+
+	*r = _mm256_packus_epi16(
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpacklo_epi16(r_uv, r_uv), y_1), PRECISION),
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpackhi_epi16(r_uv, r_uv), y_2), PRECISION));
+	*g = _mm256_packus_epi16(
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpacklo_epi16(g_uv, g_uv), y_1), PRECISION),
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpackhi_epi16(g_uv, g_uv), y_2), PRECISION));
+	*b = _mm256_packus_epi16(
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpacklo_epi16(b_uv, b_uv), y_1), PRECISION),
+		_mm256_srai_epi16(_mm256_add_epi16(_mm256_unpackhi_epi16(b_uv, b_uv), y_2), PRECISION));
+}
+
+/* Interleaves 32 pixels of four byte channels, given in memory order, into four vectors of 8 pixels */
+SDL_TARGETING("avx2") static SDL_INLINE void yuv_avx2_interleave_32(__m256i c0, __m256i c1, __m256i c2, __m256i c3, __m256i out[4])
+{
+	const __m256i lo_01 = _mm256_unpacklo_epi8(c0, c1);
+	const __m256i hi_01 = _mm256_unpackhi_epi8(c0, c1);
+	const __m256i lo_23 = _mm256_unpacklo_epi8(c2, c3);
+	const __m256i hi_23 = _mm256_unpackhi_epi8(c2, c3);
+	/* Pixels 0-3 and 16-19, 4-7 and 20-23, 8-11 and 24-27, 12-15 and 28-31 */
+	const __m256i q0 = _mm256_unpacklo_epi16(lo_01, lo_23);
+	const __m256i q1 = _mm256_unpackhi_epi16(lo_01, lo_23);
+	const __m256i q2 = _mm256_unpacklo_epi16(hi_01, hi_23);
+	const __m256i q3 = _mm256_unpackhi_epi16(hi_01, hi_23);
+
+	out[0] = _mm256_permute2x128_si256(q0, q1, 0x20);
+	out[1] = _mm256_permute2x128_si256(q2, q3, 0x20);
+	out[2] = _mm256_permute2x128_si256(q0, q1, 0x31);
+	out[3] = _mm256_permute2x128_si256(q2, q3, 0x31);
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE void yuv_avx2_save_32(__m256i c0, __m256i c1, __m256i c2, __m256i c3, uint8_t *rgb_ptr)
+{
+	__m256i out[4];
+
+	yuv_avx2_interleave_32(c0, c1, c2, c3, out);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), out[0]);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+32), out[1]);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+64), out[2]);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+96), out[3]);
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE void yuv_avx2_save_rgb24(__m256i r, __m256i g, __m256i b, uint8_t *rgb_ptr)
+{
+	/* Drop the fourth byte of every pixel, then move the 12 bytes left in the high lane next to those of the low one */
+	const __m256i shuffle = _mm256_setr_epi8(
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1,
+		0, 1, 2, 4, 5, 6, 8, 9, 10, 12, 13, 14, -1, -1, -1, -1);
+	const __m256i compact = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7);
+	__m256i out[4];
+	int i;
+
+	yuv_avx2_interleave_32(r, g, b, _mm256_setzero_si256(), out);
+	for (i = 0; i < 4; ++i) {
+		out[i] = _mm256_permutevar8x32_epi32(_mm256_shuffle_epi8(out[i], shuffle), compact);
+	}
+	/* Every store but the last writes 8 bytes that the next one replaces */
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), out[0]);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+24), out[1]);
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+48), out[2]);
+	_mm_storeu_si128((__m128i*)(rgb_ptr+72), _mm256_castsi256_si128(out[3]));
+	_mm_storel_epi64((__m128i*)(rgb_ptr+88), _mm256_extracti128_si256(out[3], 1));
+}
+
+SDL_TARGETING("avx2") static SDL_INLINE void yuv_avx2_save_rgb565(__m256i r, __m256i g, __m256i b, uint8_t *rgb_ptr)
+{
+	const __m256i zero = _mm256_setzero_si256();
+	/* Pixels 0-7 and 16-23, then 8-15 and 24-31, as for the 32-bit formats */
+	const __m256i lo = _mm256_or_si256(_mm256_or_si256(
+		_mm256_and_si256(_mm256_unpacklo_epi8(zero, r), _mm256_set1_epi16((short)0xF800)),
+		_mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpacklo_epi8(g, zero), 2), 5)),
+		_mm256_srli_epi16(_mm256_unpacklo_epi8(b, zero), 3));
+	const __m256i hi = _mm256_or_si256(_mm256_or_si256(
+		_mm256_and_si256(_mm256_unpackhi_epi8(zero, r), _mm256_set1_epi16((short)0xF800)),
+		_mm256_slli_epi16(_mm256_srli_epi16(_mm256_unpackhi_epi8(g, zero), 2), 5)),
+		_mm256_srli_epi16(_mm256_unpackhi_epi8(b, zero), 3));
+
+	_mm256_storeu_si256((__m256i*)(rgb_ptr), _mm256_permute2x128_si256(lo, hi, 0x20));
+	_mm256_storeu_si256((__m256i*)(rgb_ptr+32), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+#define AVX2_FUNCTION_NAME	yuv420_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv420_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_rgb24_avx2
+#define STD_FUNCTION_NAME	yuv420_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_rgba_avx2
+#define STD_FUNCTION_NAME	yuv420_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_bgra_avx2
+#define STD_FUNCTION_NAME	yuv420_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_argb_avx2
+#define STD_FUNCTION_NAME	yuv420_argb_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv420_abgr_avx2
+#define STD_FUNCTION_NAME	yuv420_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_420
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgb565_avx2
+#define STD_FUNCTION_NAME	yuv422_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgb24_avx2
+#define STD_FUNCTION_NAME	yuv422_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_rgba_avx2
+#define STD_FUNCTION_NAME	yuv422_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_bgra_avx2
+#define STD_FUNCTION_NAME	yuv422_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_argb_avx2
+#define STD_FUNCTION_NAME	yuv422_argb_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuv422_abgr_avx2
+#define STD_FUNCTION_NAME	yuv422_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_422
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgb565_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgb565_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB565
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgb24_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgb24_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGB24
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_rgba_avx2
+#define STD_FUNCTION_NAME	yuvnv12_rgba_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_RGBA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_bgra_avx2
+#define STD_FUNCTION_NAME	yuvnv12_bgra_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_BGRA
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_argb_avx2
+#define STD_FUNCTION_NAME	yuvnv12_argb_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ARGB
+#include "yuv_rgb_avx2_func.h"
+
+#define AVX2_FUNCTION_NAME	yuvnv12_abgr_avx2
+#define STD_FUNCTION_NAME	yuvnv12_abgr_std
+#define YUV_FORMAT			YUV_FORMAT_NV12
+#define RGB_FORMAT			RGB_FORMAT_ABGR
+#include "yuv_rgb_avx2_func.h"
+
+#endif //SDL_AVX2_INTRINSICS
+
+#endif /* SDL_HAVE_YUV */
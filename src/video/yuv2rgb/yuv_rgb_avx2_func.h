@@ -0,0 +1,241 @@
+// Copyright 2016 Adrien Descamps
+// Distributed under BSD 3-Clause License
+
+/* You need to define the following macros before including this file:
+	AVX2_FUNCTION_NAME
+	STD_FUNCTION_NAME
+	YUV_FORMAT
+	RGB_FORMAT
+*/
+
+/* The arithmetic is that of yuv_rgb_sse_func.h, 32 pixels of two lines at a time,
+   so the results are the same as the SSE2 ones */
+
+#if YUV_FORMAT == YUV_FORMAT_420
+
+/* 32 Y values as bytes, in order */
+#define READ_Y(y_ptr) \
+	y = _mm256_loadu_si256((const __m256i*)(y_ptr)); \
+
+/* 16 U and V values as 16-bit lanes, in order */
+#define READ_UV \
+	u = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(u_ptr))); \
+	v = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i*)(v_ptr))); \
+
+#elif YUV_FORMAT == YUV_FORMAT_422
+
+/* packus and packs work within 128-bit lanes, the permute puts the 64-bit quarters back in order */
+#define READ_Y(y_ptr) \
+	y = _mm256_permute4x64_epi64(_mm256_packus_epi16( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(y_ptr)), _mm256_set1_epi16(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(y_ptr+32)), _mm256_set1_epi16(0xFF))), 0xD8); \
+
+#define READ_UV \
+	u = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+	v = _mm256_permute4x64_epi64(_mm256_packs_epi32( \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr)), _mm256_set1_epi32(0xFF)), \
+		_mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr+32)), _mm256_set1_epi32(0xFF))), 0xD8); \
+
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+
+#define READ_Y(y_ptr) \
+	y = _mm256_loadu_si256((const __m256i*)(y_ptr)); \
+
+#define READ_UV \
+	u = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(u_ptr)), _mm256_set1_epi16(0xFF)); \
+	v = _mm256_and_si256(_mm256_loadu_si256((const __m256i*)(v_ptr)), _mm256_set1_epi16(0xFF)); \
+
+#else
+#error READ_UV unimplemented
+#endif
+
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_rgb565(R, G, B, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_rgb24(R, G, B, rgb_ptr); \
+
+/* The packed formats are written as bytes, in memory order */
+#elif RGB_FORMAT == RGB_FORMAT_RGBA
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_32(_mm256_set1_epi8((char)0xFF), B, G, R, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_BGRA
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_32(_mm256_set1_epi8((char)0xFF), R, G, B, rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_ARGB
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_32(B, G, R, _mm256_set1_epi8((char)0xFF), rgb_ptr); \
+
+#elif RGB_FORMAT == RGB_FORMAT_ABGR
+
+#define SAVE_LINE(R, G, B, rgb_ptr) \
+	yuv_avx2_save_32(R, G, B, _mm256_set1_epi8((char)0xFF), rgb_ptr); \
+
+#else
+#error SAVE_LINE unimplemented
+#endif
+
+#define YUV2RGB_32 \
+	__m256i y, u, v, r_uv, g_uv, b_uv; \
+	__m256i r_8_1, g_8_1, b_8_1, r_8_2, g_8_2, b_8_2; \
+	\
+	READ_UV \
+	u = _mm256_add_epi16(u, _mm256_set1_epi16(-128)); \
+	v = _mm256_add_epi16(v, _mm256_set1_epi16(-128)); \
+	r_uv = _mm256_mullo_epi16(v, _mm256_set1_epi16(param->v_r_factor)); \
+	g_uv = _mm256_add_epi16( \
+		_mm256_mullo_epi16(u, _mm256_set1_epi16(param->u_g_factor)), \
+		_mm256_mullo_epi16(v, _mm256_set1_epi16(param->v_g_factor))); \
+	b_uv = _mm256_mullo_epi16(u, _mm256_set1_epi16(param->u_b_factor)); \
+	\
+	READ_Y(y_ptr1) \
+	yuv_avx2_y2rgb(param, y, r_uv, g_uv, b_uv, &r_8_1, &g_8_1, &b_8_1); \
+	if (uv_y_sample_interval > 1) \
+	{ \
+		READ_Y(y_ptr2) \
+		yuv_avx2_y2rgb(param, y, r_uv, g_uv, b_uv, &r_8_2, &g_8_2, &b_8_2); \
+	} \
+	else \
+	{ \
+		r_8_2 = g_8_2 = b_8_2 = _mm256_setzero_si256(); \
+	} \
+
+
+SDL_TARGETING("avx2") void AVX2_FUNCTION_NAME(uint32_t width, uint32_t height,
+	const uint8_t *Y, const uint8_t *U, const uint8_t *V, uint32_t Y_stride, uint32_t UV_stride,
+	uint8_t *RGB, uint32_t RGB_stride,
+	YCbCrType yuv_type)
+{
+	const YUV2RGBParam *const param = &(YUV2RGB[yuv_type]);
+#if YUV_FORMAT == YUV_FORMAT_420
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 1;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#elif YUV_FORMAT == YUV_FORMAT_422
+	const int y_pixel_stride = 2;
+	const int uv_pixel_stride = 4;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 1;
+#elif YUV_FORMAT == YUV_FORMAT_NV12
+	const int y_pixel_stride = 1;
+	const int uv_pixel_stride = 2;
+	const int uv_x_sample_interval = 2;
+	const int uv_y_sample_interval = 2;
+#endif
+#if RGB_FORMAT == RGB_FORMAT_RGB565
+	const int rgb_pixel_stride = 2;
+#elif RGB_FORMAT == RGB_FORMAT_RGB24
+	const int rgb_pixel_stride = 3;
+#elif RGB_FORMAT == RGB_FORMAT_RGBA || RGB_FORMAT == RGB_FORMAT_BGRA || \
+      RGB_FORMAT == RGB_FORMAT_ARGB || RGB_FORMAT == RGB_FORMAT_ABGR
+	const int rgb_pixel_stride = 4;
+#else
+#error Unknown RGB pixel size
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_NV12
+	/* The interleaved U/V reads go one byte past the last pixel, see yuv_rgb_sse_func.h */
+	const int fix_read_nv12 = ((width & 31) == 0);
+#else
+	const int fix_read_nv12 = 0;
+#endif
+
+#if YUV_FORMAT == YUV_FORMAT_422
+	/* Avoid invalid read on last line */
+	const int fix_read_422 = 1;
+#else
+	const int fix_read_422 = 0;
+#endif
+
+
+	if (width >= 32) {
+		uint32_t xpos, ypos;
+		for(ypos=0; ypos<(height-(uv_y_sample_interval-1)) - fix_read_422; ypos+=uv_y_sample_interval)
+		{
+			const uint8_t *y_ptr1=Y+ypos*Y_stride,
+				*y_ptr2=Y+(ypos+1)*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr1=RGB+ypos*RGB_stride,
+				*rgb_ptr2=RGB+(ypos+1)*RGB_stride;
+
+			for(xpos=0; xpos<(width-31) - fix_read_nv12; xpos+=32)
+			{
+				YUV2RGB_32
+				SAVE_LINE(r_8_1, g_8_1, b_8_1, rgb_ptr1)
+				if (uv_y_sample_interval > 1)
+				{
+					SAVE_LINE(r_8_2, g_8_2, b_8_2, rgb_ptr2)
+				}
+
+				y_ptr1+=32*y_pixel_stride;
+				y_ptr2+=32*y_pixel_stride;
+				u_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				v_ptr+=32*uv_pixel_stride/uv_x_sample_interval;
+				rgb_ptr1+=32*rgb_pixel_stride;
+				rgb_ptr2+=32*rgb_pixel_stride;
+			}
+		}
+
+		if (fix_read_422) {
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+			ypos += uv_y_sample_interval;
+		}
+
+		/* Catch the last line, if needed */
+		if (uv_y_sample_interval == 2 && ypos == (height-1))
+		{
+			const uint8_t *y_ptr=Y+ypos*Y_stride,
+				*u_ptr=U+(ypos/uv_y_sample_interval)*UV_stride,
+				*v_ptr=V+(ypos/uv_y_sample_interval)*UV_stride;
+
+			uint8_t *rgb_ptr=RGB+ypos*RGB_stride;
+
+			STD_FUNCTION_NAME(width, 1, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+
+	/* Catch the right column, if needed */
+	{
+		uint32_t converted = (width & ~31);
+		if (fix_read_nv12) {
+			converted -= 32;
+		}
+		if (converted != width)
+		{
+			const uint8_t *y_ptr=Y+converted*y_pixel_stride,
+				*u_ptr=U+converted*uv_pixel_stride/uv_x_sample_interval,
+				*v_ptr=V+converted*uv_pixel_stride/uv_x_sample_interval;
+
+			uint8_t *rgb_ptr=RGB+converted*rgb_pixel_stride;
+
+			STD_FUNCTION_NAME(width-converted, height, y_ptr, u_ptr, v_ptr, Y_stride, UV_stride, rgb_ptr, RGB_stride, yuv_type);
+		}
+	}
+}
+
+#undef AVX2_FUNCTION_NAME
+#undef STD_FUNCTION_NAME
+#undef YUV_FORMAT
+#undef RGB_FORMAT
+#undef READ_Y
+#undef READ_UV
+#undef SAVE_LINE
+#undef YUV2RGB_32
@@ -0,0 +1,244 @@
+/**
+ * Jobs test suite
+ *
+ * SDL_RunJobs() is internal, this suite is only built where testautomation
+ * links the static library.
+ */
+
+#ifdef SDL_TEST_INTERNALS
+#include "../src/SDL_internal.h"
+#include "../src/thread/SDL_jobs_c.h"
+#endif
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+#ifdef SDL_TEST_INTERNALS
+
+#define JOBS_MAX_COUNT   1031
+#define JOBS_NUM_CALLERS 4
+
+typedef struct
+{
+    SDL_atomic_t runs[JOBS_MAX_COUNT];
+    SDL_atomic_t bad_chunks;
+    int count;
+    int grain;
+} JobsCounter;
+
+typedef struct
+{
+    JobsCounter outer;
+    JobsCounter inner[8];
+} JobsNested;
+
+/* Fixture */
+
+/* Run jobs on a few workers, whatever the number of cores */
+void _jobsSetUp(void *arg)
+{
+    SDL_SetHint(SDL_HINT_JOB_THREADS, "4");
+    SDL_JobsQuit();
+}
+
+void _jobsTearDown(void *arg)
+{
+    SDL_ResetHint(SDL_HINT_JOB_THREADS);
+    SDL_JobsQuit();
+}
+
+/* Helper functions */
+
+static void _resetCounter(JobsCounter *counter, int count, int grain)
+{
+    int i;
+
+    for (i = 0; i < JOBS_MAX_COUNT; ++i) {
+        SDL_AtomicSet(&counter->runs[i], 0);
+    }
+    SDL_AtomicSet(&counter->bad_chunks, 0);
+    counter->count = count;
+    counter->grain = grain;
+}
+
+/* Counts the runs of every index, and chunks that are empty, out of range or too big */
+static void _countJob(void *userdata, int start, int end)
+{
+    JobsCounter *counter = (JobsCounter *)userdata;
+    int i;
+
+    if (start < 0 || start >= end || end > counter->count ||
+        (counter->grain > 0 && end - start > counter->grain)) {
+        SDL_AtomicIncRef(&counter->bad_chunks);
+        return;
+    }
+    for (i = start; i < end; ++i) {
+        SDL_AtomicIncRef(&counter->runs[i]);
+    }
+}
+
+/* Returns the number of indices that didn't run exactly once, plus the bad chunks */
+static int _countErrors(JobsCounter *counter)
+{
+    int errors = SDL_AtomicGet(&counter->bad_chunks);
+    int i;
+
+    for (i = 0; i < counter->count; ++i) {
+        if (SDL_AtomicGet(&counter->runs[i]) != 1) {
+            ++errors;
+        }
+    }
+    return errors;
+}
+
+/* Runs a job of its own for every index of the outer job */
+static void _nestedJob(void *userdata, int start, int end)
+{
+    JobsNested *nested = (JobsNested *)userdata;
+    int i;
+
+    _countJob(&nested->outer, start, end);
+    for (i = start; i < end; ++i) {
+        SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, _countJob, &nested->inner[i], nested->inner[i].count, nested->inner[i].grain);
+    }
+}
+
+static int SDLCALL _jobsCaller(void *data)
+{
+    JobsCounter *counter = (JobsCounter *)data;
+    int errors = 0;
+    int i;
+
+    for (i = 0; i < 50; ++i) {
+        _resetCounter(counter, 997 - i, 1 + i % 13);
+        SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, _countJob, counter, counter->count, counter->grain);
+        errors += _countErrors(counter);
+    }
+    return errors;
+}
+
+/* Test case functions */
+
+/**
+ * @brief Checks that every index of a job runs exactly once, for ranges that don't split evenly
+ */
+int jobs_testExactlyOnce(void *arg)
+{
+    static const struct
+    {
+        int count;
+        int grain;
+    } jobs[] = {
+        { 1, 1 }, { 1, 0 }, { 2, 1 }, { 5, 100 }, { 7, 3 }, { 17, 16 }, { 64, -1 },
+        { 100, 7 }, { 1000, 0 }, { 1023, 1 }, { 1031, 1030 }, { 1031, 511 }
+    };
+    JobsCounter *counter = (JobsCounter *)SDL_malloc(sizeof(*counter));
+    int i;
+
+    SDLTest_AssertCheck(counter != NULL, "Check that the counter was allocated");
+    if (!counter) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < SDL_arraysize(jobs); ++i) {
+        _resetCounter(counter, jobs[i].count, jobs[i].grain);
+        SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, _countJob, counter, jobs[i].count, jobs[i].grain);
+        SDLTest_AssertCheck(_countErrors(counter) == 0,
+                            "Check that every index of a job of %d, grain %d, ran once, got %d errors",
+                            jobs[i].count, jobs[i].grain, _countErrors(counter));
+    }
+
+    /* An empty job doesn't call the function at all */
+    _resetCounter(counter, 0, 1);
+    SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, _countJob, counter, 0, 1);
+    SDLTest_AssertCheck(_countErrors(counter) == 0, "Check that an empty job runs no chunks");
+
+    SDL_free(counter);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks jobs started from inside a job
+ */
+int jobs_testNested(void *arg)
+{
+    JobsNested *nested = (JobsNested *)SDL_malloc(sizeof(*nested));
+    int i, errors;
+
+    SDLTest_AssertCheck(nested != NULL, "Check that the counters were allocated");
+    if (!nested) {
+        return TEST_ABORTED;
+    }
+    _resetCounter(&nested->outer, SDL_arraysize(nested->inner), 1);
+    for (i = 0; i < SDL_arraysize(nested->inner); ++i) {
+        _resetCounter(&nested->inner[i], 301 + i * 37, 1 + i * 5);
+    }
+    SDL_RunJobs(SDL_JOB_KERNEL_GENERIC, _nestedJob, nested, nested->outer.count, nested->outer.grain);
+
+    errors = _countErrors(&nested->outer);
+    SDLTest_AssertCheck(errors == 0, "Check that every index of the outer job ran once, got %d errors", errors);
+    for (i = 0; i < SDL_arraysize(nested->inner); ++i) {
+        errors = _countErrors(&nested->inner[i]);
+        SDLTest_AssertCheck(errors == 0, "Check that every index of inner job %d ran once, got %d errors", i, errors);
+    }
+
+    SDL_free(nested);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Checks jobs run from several threads at once, starting with no worker pool
+ */
+int jobs_testConcurrentCallers(void *arg)
+{
+    JobsCounter *counters = (JobsCounter *)SDL_malloc(JOBS_NUM_CALLERS * sizeof(*counters));
+    SDL_Thread *threads[JOBS_NUM_CALLERS];
+    int i, errors;
+
+    SDLTest_AssertCheck(counters != NULL, "Check that the counters were allocated");
+    if (!counters) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < JOBS_NUM_CALLERS; ++i) {
+        threads[i] = SDL_CreateThread(_jobsCaller, "JobsCaller", &counters[i]);
+        SDLTest_AssertCheck(threads[i] != NULL, "Check that caller thread %d was created", i);
+    }
+    for (i = 0; i < JOBS_NUM_CALLERS; ++i) {
+        if (threads[i]) {
+            SDL_WaitThread(threads[i], &errors);
+            SDLTest_AssertCheck(errors == 0, "Check that every job of caller thread %d ran once per index, got %d errors", i, errors);
+        }
+    }
+
+    SDL_free(counters);
+    return TEST_COMPLETED;
+}
+
+/* ================= Test References ================== */
+
+/* Jobs test cases */
+static const SDLTest_TestCaseReference jobsTest1 = {
+    (SDLTest_TestCaseFp)jobs_testExactlyOnce, "jobs_testExactlyOnce", "Checks that every index of a job runs exactly once", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTest2 = {
+    (SDLTest_TestCaseFp)jobs_testNested, "jobs_testNested", "Checks jobs started from inside a job", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference jobsTest3 = {
+    (SDLTest_TestCaseFp)jobs_testConcurrentCallers, "jobs_testConcurrentCallers", "Checks jobs run from several threads at once", TEST_ENABLED
+};
+
+/* Sequence of Jobs test cases */
+static const SDLTest_TestCaseReference *jobsTests[] = {
+    &jobsTest1, &jobsTest2, &jobsTest3, NULL
+};
+
+/* Jobs test suite (global) */
+SDLTest_TestSuiteReference jobsTestSuite = {
+    "Jobs",
+    _jobsSetUp,
+    jobsTests,
+    _jobsTearDown
+};
+
+#endif /* SDL_TEST_INTERNALS */
@@ -83,7 +83,7 @@ const char *_RGBPixelFormatsVerbose[] = {
 };
 
 /* Definition of all Non-RGB formats used to test pixel conversions */
-const int _numNonRGBPixelFormats = 7;
+const int _numNonRGBPixelFormats = 9;
 Uint32 _nonRGBPixelFormats[] = {
     SDL_PIXELFORMAT_YV12,
     SDL_PIXELFORMAT_IYUV,
@@ -91,7 +91,9 @@ Uint32 _nonRGBPixelFormats[] = {
     SDL_PIXELFORMAT_UYVY,
     SDL_PIXELFORMAT_YVYU,
     SDL_PIXELFORMAT_NV12,
-    SDL_PIXELFORMAT_NV21
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_P010,
+    SDL_PIXELFORMAT_P016
 };
 const char *_nonRGBPixelFormatsVerbose[] = {
     "SDL_PIXELFORMAT_YV12",
@@ -100,7 +102,9 @@ const char *_nonRGBPixelFormatsVerbose[] = {
     "SDL_PIXELFORMAT_UYVY",
     "SDL_PIXELFORMAT_YVYU",
     "SDL_PIXELFORMAT_NV12",
-    "SDL_PIXELFORMAT_NV21"
+    "SDL_PIXELFORMAT_NV21",
+    "SDL_PIXELFORMAT_P010",
+    "SDL_PIXELFORMAT_P016"
 };
 
 /* Definition of some invalid formats for negative tests */
@@ -469,6 +473,428 @@ pixels_calcGammaRamp(void *arg)
   return TEST_COMPLETED;
 }
 
+/* The nearest palette color by a full scan, the first one of equally close colors */
+static Uint8 _findColorSlow(const SDL_Palette *palette, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+  unsigned int smallest = ~0U;
+  Uint8 pixel = 0;
+  int i;
+
+  for (i = 0; i < palette->ncolors; ++i) {
+    const int rd = palette->colors[i].r - r;
+    const int gd = palette->colors[i].g - g;
+    const int bd = palette->colors[i].b - b;
+    const int ad = palette->colors[i].a - a;
+    const unsigned int distance = (rd * rd) + (gd * gd) + (bd * bd) + (ad * ad);
+
+    if (distance < smallest) {
+      smallest = distance;
+      pixel = (Uint8)i;
+    }
+  }
+  return pixel;
+}
+
+/* Maps random colors to an indexed format and counts the ones that aren't the nearest */
+static int _countMapErrors(const SDL_PixelFormat *format, Uint32 *seed)
+{
+  int errors = 0;
+  int i;
+
+  for (i = 0; i < 2000; ++i) {
+    Uint8 r, g, b, a;
+    Uint32 pixel;
+
+    *seed = *seed * 1103515245 + 12345;
+    r = (Uint8)(*seed >> 24);
+    g = (Uint8)(*seed >> 16);
+    b = (Uint8)(*seed >> 8);
+    a = (i & 1) ? SDL_ALPHA_OPAQUE : (Uint8)(*seed >> 4);
+    pixel = SDL_MapRGBA(format, r, g, b, a);
+    if (pixel != _findColorSlow(format->palette, r, g, b, a)) {
+      ++errors;
+    }
+  }
+  return errors;
+}
+
+/**
+* @brief Tests that mapping colors to palettes finds the nearest color, also after the palette changes
+*
+* @sa http://wiki.libsdl.org/SDL_MapRGBA
+*/
+int pixels_mapToPalette(void *arg)
+{
+  static const int sizes[] = { 2, 16, 17, 100, 256 };
+  SDL_PixelFormat *format;
+  SDL_Color colors[256];
+  Uint32 seed = 13579;
+  int errors, i, j;
+
+  format = SDL_AllocFormat(SDL_PIXELFORMAT_INDEX8);
+  SDLTest_AssertCheck(format != NULL, "Validate format is not NULL");
+  if (!format) {
+    return TEST_ABORTED;
+  }
+
+  for (i = 0; i < (int)SDL_arraysize(sizes); ++i) {
+    SDL_Palette *palette = SDL_AllocPalette(sizes[i]);
+
+    SDLTest_AssertCheck(palette != NULL, "Validate palette is not NULL");
+    if (!palette) {
+      continue;
+    }
+    SDL_SetPixelFormatPalette(format, palette);
+
+    /* Random colors, with some repeated ones and a gray ramp */
+    for (j = 0; j < sizes[i]; ++j) {
+      seed = seed * 1103515245 + 12345;
+      if (j % 5 == 4) {
+        colors[j] = colors[j / 2];
+      } else if (j % 5 == 3) {
+        colors[j].r = colors[j].g = colors[j].b = (Uint8)(j * 255 / sizes[i]);
+        colors[j].a = SDL_ALPHA_OPAQUE;
+      } else {
+        colors[j].r = (Uint8)(seed >> 24);
+        colors[j].g = (Uint8)(seed >> 16);
+        colors[j].b = (Uint8)(seed >> 8);
+        colors[j].a = (j & 1) ? (Uint8)seed : SDL_ALPHA_OPAQUE;
+      }
+    }
+    SDL_SetPaletteColors(palette, colors, 0, sizes[i]);
+    errors = _countMapErrors(format, &seed);
+    SDLTest_AssertCheck(errors == 0, "Validate SDL_MapRGBA with %d colors, expected: 0 wrong colors, got: %d", sizes[i], errors);
+
+    /* Mapping must follow palette changes */
+    for (j = 0; j < sizes[i]; ++j) {
+      colors[j].r ^= 0x55;
+      colors[j].b = (Uint8)(255 - colors[j].b);
+    }
+    SDL_SetPaletteColors(palette, colors, 0, sizes[i]);
+    errors = _countMapErrors(format, &seed);
+    SDLTest_AssertCheck(errors == 0, "Validate SDL_MapRGBA after SDL_SetPaletteColors with %d colors, expected: 0 wrong colors, got: %d", sizes[i], errors);
+
+    /* Also when the colors are written directly, then passed back in place */
+    for (j = 0; j < sizes[i]; ++j) {
+      palette->colors[j].g ^= 0xAA;
+    }
+    SDL_SetPaletteColors(palette, palette->colors, 0, sizes[i]);
+    errors = _countMapErrors(format, &seed);
+    SDLTest_AssertCheck(errors == 0, "Validate SDL_MapRGBA after writing the colors with %d colors, expected: 0 wrong colors, got: %d", sizes[i], errors);
+
+    SDL_SetPixelFormatPalette(format, NULL);
+    SDL_FreePalette(palette);
+  }
+  SDL_FreeFormat(format);
+
+  return TEST_COMPLETED;
+}
+
+/* The vector tests change SDL_BLIT_CPU_FEATURES, these put back the value it had before */
+static char *_saveBlitCPUFeatures(void)
+{
+  const char *features = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+
+  return SDL_strdup(features ? features : "");
+}
+
+static void _restoreBlitCPUFeatures(char *features)
+{
+  /* An empty value doesn't override anything, like an unset one */
+  SDL_setenv("SDL_BLIT_CPU_FEATURES", features ? features : "", 1);
+  SDL_free(features);
+}
+
+/* Creates a YUV image of random bytes, with the pitch the YUV formats expect */
+static Uint8 *_createRandomYUV(Uint32 format, int w, int h, int *pitch, Uint32 *seed)
+{
+  const int chroma = ((w + 1) / 2) * ((h + 1) / 2) * 2;
+  Uint8 *pixels;
+  size_t size;
+  size_t i;
+
+  if (format == SDL_PIXELFORMAT_YUY2 || format == SDL_PIXELFORMAT_UYVY || format == SDL_PIXELFORMAT_YVYU) {
+    *pitch = ((w + 1) / 2) * 4;
+    size = (size_t)*pitch * h;
+  } else {
+    *pitch = w;
+    size = (size_t)w * h + chroma;
+  }
+  pixels = (Uint8 *)SDL_malloc(size);
+  if (pixels) {
+    for (i = 0; i < size; ++i) {
+      *seed = *seed * 1103515245 + 12345;
+      pixels[i] = (Uint8)(*seed >> 16);
+    }
+  }
+  return pixels;
+}
+
+/**
+* @brief Tests that the AVX2 YUV to RGB conversions give the same pixels as the SSE2 ones
+*
+* @sa http://wiki.libsdl.org/SDL_ConvertPixels
+*/
+int pixels_convertYUVSIMD(void *arg)
+{
+  static const Uint32 yuv_formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  static const Uint32 rgb_formats[] = {
+    SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888
+  };
+  static const int sizes[][2] = { { 32, 2 }, { 64, 9 }, { 67, 16 }, { 130, 11 } };
+  const SDL_bool has_avx2 = SDL_HasAVX2();
+  SDL_bool scalar_differs = SDL_FALSE;
+  char *features;
+  Uint32 seed = 24680;
+  int i, j, k;
+
+  if (!SDL_HasSSE2()) {
+    SDLTest_Log("SSE2 is not available, nothing to compare with");
+    return TEST_SKIPPED;
+  }
+  SDLTest_Log("AVX2 is %savailable", has_avx2 ? "" : "not ");
+
+  features = _saveBlitCPUFeatures();
+  for (k = 0; k < (int)SDL_arraysize(sizes); ++k) {
+    const int w = sizes[k][0];
+    const int h = sizes[k][1];
+
+    for (i = 0; i < (int)SDL_arraysize(yuv_formats); ++i) {
+      int src_pitch;
+      Uint8 *src = _createRandomYUV(yuv_formats[i], w, h, &src_pitch, &seed);
+
+      SDLTest_AssertCheck(src != NULL, "Validate YUV image is not NULL");
+      if (!src) {
+        continue;
+      }
+      for (j = 0; j < (int)SDL_arraysize(rgb_formats); ++j) {
+        const int dst_pitch = w * SDL_BYTESPERPIXEL(rgb_formats[j]);
+        const size_t size = (size_t)dst_pitch * h;
+        Uint8 *simd = (Uint8 *)SDL_calloc(4, size);
+        Uint8 *sse2 = simd ? simd + size : NULL;
+        Uint8 *avx2 = simd ? sse2 + size : NULL;
+        Uint8 *scalar = simd ? avx2 + size : NULL;
+        int ret1, ret2;
+
+        SDLTest_AssertCheck(simd != NULL, "Validate RGB images are not NULL");
+        if (!simd) {
+          continue;
+        }
+        SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+        ret1 = SDL_ConvertPixels(w, h, yuv_formats[i], src, src_pitch, rgb_formats[j], simd, dst_pitch);
+        SDL_setenv("SDL_BLIT_CPU_FEATURES", "8", 1);
+        ret2 = SDL_ConvertPixels(w, h, yuv_formats[i], src, src_pitch, rgb_formats[j], sse2, dst_pitch);
+        SDLTest_AssertCheck(ret1 == 0 && ret2 == 0, "Validate SDL_ConvertPixels(%s -> %s), expected: 0, 0, got: %d, %d",
+                            SDL_GetPixelFormatName(yuv_formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), ret1, ret2);
+        SDLTest_AssertCheck(SDL_memcmp(simd, sse2, size) == 0,
+                            "Validate %s -> %s at %dx%d matches the SSE2 conversion",
+                            SDL_GetPixelFormatName(yuv_formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), w, h);
+
+        /* With only AVX2 allowed, anything but the AVX2 converter falls back to C, which rounds differently */
+        if (has_avx2) {
+          SDL_setenv("SDL_BLIT_CPU_FEATURES", "64", 1);
+          ret1 = SDL_ConvertPixels(w, h, yuv_formats[i], src, src_pitch, rgb_formats[j], avx2, dst_pitch);
+          SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+          ret2 = SDL_ConvertPixels(w, h, yuv_formats[i], src, src_pitch, rgb_formats[j], scalar, dst_pitch);
+          SDLTest_AssertCheck(ret1 == 0 && ret2 == 0 && SDL_memcmp(avx2, sse2, size) == 0,
+                              "Validate %s -> %s at %dx%d with only AVX2 matches the SSE2 conversion, got: %d, %d",
+                              SDL_GetPixelFormatName(yuv_formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), w, h, ret1, ret2);
+          if (SDL_memcmp(scalar, sse2, size) != 0) {
+            scalar_differs = SDL_TRUE;
+          }
+        }
+        SDL_free(simd);
+      }
+      SDL_free(src);
+    }
+  }
+  _restoreBlitCPUFeatures(features);
+
+  if (has_avx2) {
+    SDLTest_AssertCheck(scalar_differs, "Validate the C conversions differ from the vector ones, so the AVX2 path is the one that ran");
+  }
+  return TEST_COMPLETED;
+}
+
+/**
+* @brief Tests that the SIMD RGB to YUV conversions are close to the C ones
+*
+* @sa http://wiki.libsdl.org/SDL_ConvertPixels
+*/
+int pixels_convertRGBToYUVSIMD(void *arg)
+{
+  static const Uint32 rgb_formats[] = {
+    SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGRX8888
+  };
+  static const Uint32 yuv_formats[] = {
+    SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_IYUV, SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2, SDL_PIXELFORMAT_UYVY, SDL_PIXELFORMAT_YVYU
+  };
+  static const SDL_YUV_CONVERSION_MODE modes[] = {
+    SDL_YUV_CONVERSION_JPEG, SDL_YUV_CONVERSION_BT601, SDL_YUV_CONVERSION_BT709
+  };
+  static const int sizes[][2] = { { 16, 2 }, { 37, 9 }, { 64, 4 }, { 131, 7 } };
+  const SDL_YUV_CONVERSION_MODE mode = SDL_GetYUVConversionMode();
+  char *features = _saveBlitCPUFeatures();
+  Uint32 seed = 97531;
+  int i, j, k, m;
+
+  for (k = 0; k < (int)SDL_arraysize(sizes); ++k) {
+    const int w = sizes[k][0];
+    const int h = sizes[k][1];
+    const int src_pitch = w * 4 + 4;
+    /* The packed formats are the largest */
+    const size_t max_size = (size_t)((w + 1) / 2) * 4 * h;
+    Uint8 *src = (Uint8 *)SDL_malloc((size_t)src_pitch * h);
+    Uint8 *simd = (Uint8 *)SDL_malloc(max_size * 2);
+    Uint8 *scalar = simd ? simd + max_size : NULL;
+
+    SDLTest_AssertCheck(src != NULL && simd != NULL, "Validate images are not NULL");
+    if (!src || !simd) {
+      SDL_free(src);
+      SDL_free(simd);
+      continue;
+    }
+    for (i = 0; i < src_pitch * h; ++i) {
+      seed = seed * 1103515245 + 12345;
+      src[i] = (Uint8)(seed >> 16);
+    }
+
+    for (m = 0; m < (int)SDL_arraysize(modes); ++m) {
+      SDL_SetYUVConversionMode(modes[m]);
+      for (i = 0; i < (int)SDL_arraysize(rgb_formats); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(yuv_formats); ++j) {
+          const SDL_bool packed = (yuv_formats[j] == SDL_PIXELFORMAT_YUY2 || yuv_formats[j] == SDL_PIXELFORMAT_UYVY || yuv_formats[j] == SDL_PIXELFORMAT_YVYU);
+          const int yuv_pitch = packed ? ((w + 1) / 2) * 4 : w;
+          const size_t size = packed ? max_size : (size_t)w * h + (size_t)((w + 1) / 2) * ((h + 1) / 2) * 2;
+          int ret1, ret2, diff = 0;
+          size_t n;
+
+          /* Every byte is written, so start from different ones */
+          SDL_memset(simd, 0x00, size);
+          SDL_memset(scalar, 0xFF, size);
+          SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+          ret1 = SDL_ConvertPixels(w, h, rgb_formats[i], src, src_pitch, yuv_formats[j], simd, yuv_pitch);
+          SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+          ret2 = SDL_ConvertPixels(w, h, rgb_formats[i], src, src_pitch, yuv_formats[j], scalar, yuv_pitch);
+          for (n = 0; n < size; ++n) {
+            diff = SDL_max(diff, SDL_abs(simd[n] - scalar[n]));
+          }
+          SDLTest_AssertCheck(ret1 == 0 && ret2 == 0, "Validate SDL_ConvertPixels(%s -> %s), expected: 0, 0, got: %d, %d",
+                              SDL_GetPixelFormatName(rgb_formats[i]), SDL_GetPixelFormatName(yuv_formats[j]), ret1, ret2);
+          SDLTest_AssertCheck(diff <= 1, "Validate %s -> %s at %dx%d in mode %d, expected: at most 1 off, got: %d",
+                              SDL_GetPixelFormatName(rgb_formats[i]), SDL_GetPixelFormatName(yuv_formats[j]), w, h, (int)modes[m], diff);
+        }
+      }
+    }
+    SDL_free(src);
+    SDL_free(simd);
+  }
+  _restoreBlitCPUFeatures(features);
+  SDL_SetYUVConversionMode(mode);
+
+  return TEST_COMPLETED;
+}
+
+/**
+* @brief Tests the P010 and P016 conversions to NV12 and to RGB
+*
+* @sa http://wiki.libsdl.org/SDL_ConvertPixels
+*/
+int pixels_convertP01x(void *arg)
+{
+  static const Uint32 p01x_formats[] = { SDL_PIXELFORMAT_P010, SDL_PIXELFORMAT_P016 };
+  static const Uint32 rgb_formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_RGB444 };
+  /* Taller than the strips they are converted in, and tall enough for BT.709 in automatic mode */
+  static const int sizes[][2] = { { 16, 2 }, { 37, 9 }, { 67, 45 }, { 33, 600 } };
+  const SDL_YUV_CONVERSION_MODE mode = SDL_GetYUVConversionMode();
+  char *features = _saveBlitCPUFeatures();
+  Uint32 seed = 13579;
+  int i, j, k;
+
+  SDL_SetYUVConversionMode(SDL_YUV_CONVERSION_AUTOMATIC);
+  for (k = 0; k < (int)SDL_arraysize(sizes); ++k) {
+    const int w = sizes[k][0];
+    const int h = sizes[k][1];
+    const size_t nv12_size = (size_t)w * h + (size_t)((w + 1) / 2) * ((h + 1) / 2) * 2;
+
+    for (i = 0; i < (int)SDL_arraysize(p01x_formats); ++i) {
+      const Uint32 format = p01x_formats[i];
+      const Uint16 mask = (format == SDL_PIXELFORMAT_P010) ? 0xFFC0 : 0xFFFF;
+      /* The planes of NV12 with 16-bit samples */
+      const int pitch = 2 * w;
+      const size_t size = 2 * nv12_size;
+      Uint8 *src, *copy, *expected, *nv12;
+      size_t n;
+      int ret, ret2;
+
+      src = (Uint8 *)SDL_malloc(size * 2 + nv12_size * 2);
+      SDLTest_AssertCheck(src != NULL, "Validate images are not NULL");
+      if (!src) {
+        continue;
+      }
+      copy = src + size;
+      expected = copy + size;
+      nv12 = expected + nv12_size;
+
+      /* Little endian samples, and the 8-bit ones they round to */
+      for (n = 0; n < size / 2; ++n) {
+        Uint16 sample;
+
+        seed = seed * 1103515245 + 12345;
+        sample = (Uint16)(seed >> 8) & mask;
+        src[2 * n] = (Uint8)sample;
+        src[2 * n + 1] = (Uint8)(sample >> 8);
+        expected[n] = (Uint8)(SDL_min(sample + 0x80, 0xFFFF) >> 8);
+      }
+
+      ret = SDL_ConvertPixels(w, h, format, src, pitch, format, copy, pitch);
+      SDLTest_AssertCheck(ret == 0 && SDL_memcmp(src, copy, size) == 0,
+                          "Validate %s is copied at %dx%d, got: %d", SDL_GetPixelFormatName(format), w, h, ret);
+
+      SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+      ret = SDL_ConvertPixels(w, h, format, src, pitch, SDL_PIXELFORMAT_NV12, nv12, w);
+      SDLTest_AssertCheck(ret == 0 && SDL_memcmp(nv12, expected, nv12_size) == 0,
+                          "Validate %s -> SDL_PIXELFORMAT_NV12 at %dx%d, got: %d", SDL_GetPixelFormatName(format), w, h, ret);
+      SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+      ret = SDL_ConvertPixels(w, h, format, src, pitch, SDL_PIXELFORMAT_NV12, nv12, w);
+      SDLTest_AssertCheck(ret == 0 && SDL_memcmp(nv12, expected, nv12_size) == 0,
+                          "Validate %s -> SDL_PIXELFORMAT_NV12 at %dx%d without SIMD, got: %d", SDL_GetPixelFormatName(format), w, h, ret);
+      SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+
+      /* The RGB pixels are the ones of the rounded NV12 image */
+      for (j = 0; j < (int)SDL_arraysize(rgb_formats); ++j) {
+        const int rgb_pitch = w * SDL_BYTESPERPIXEL(rgb_formats[j]);
+        Uint8 *rgb = (Uint8 *)SDL_calloc(2, (size_t)rgb_pitch * h);
+        Uint8 *rgb2 = rgb ? rgb + (size_t)rgb_pitch * h : NULL;
+
+        SDLTest_AssertCheck(rgb != NULL, "Validate RGB images are not NULL");
+        if (!rgb) {
+          continue;
+        }
+        ret = SDL_ConvertPixels(w, h, format, src, pitch, rgb_formats[j], rgb, rgb_pitch);
+        ret2 = SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_NV12, expected, w, rgb_formats[j], rgb2, rgb_pitch);
+        SDLTest_AssertCheck(ret == 0 && ret2 == 0, "Validate SDL_ConvertPixels(%s -> %s), expected: 0, 0, got: %d, %d",
+                            SDL_GetPixelFormatName(format), SDL_GetPixelFormatName(rgb_formats[j]), ret, ret2);
+        SDLTest_AssertCheck(SDL_memcmp(rgb, rgb2, (size_t)rgb_pitch * h) == 0,
+                            "Validate %s -> %s at %dx%d matches the NV12 conversion",
+                            SDL_GetPixelFormatName(format), SDL_GetPixelFormatName(rgb_formats[j]), w, h);
+        SDL_free(rgb);
+      }
+      SDL_free(src);
+    }
+  }
+  _restoreBlitCPUFeatures(features);
+  SDL_SetYUVConversionMode(mode);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Pixels test cases */
@@ -486,9 +912,21 @@ static const SDLTest_TestCaseReference pixelsTest3 =
 static const SDLTest_TestCaseReference pixelsTest4 =
         { (SDLTest_TestCaseFp)pixels_getPixelFormatName, "pixels_getPixelFormatName", "Call to SDL_GetPixelFormatName", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference pixelsTest5 =
+        { (SDLTest_TestCaseFp)pixels_mapToPalette, "pixels_mapToPalette", "Tests mapping colors to the nearest palette color", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest6 =
+        { (SDLTest_TestCaseFp)pixels_convertYUVSIMD, "pixels_convertYUVSIMD", "Tests the vector YUV to RGB conversions against the SSE2 ones", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest7 =
+        { (SDLTest_TestCaseFp)pixels_convertRGBToYUVSIMD, "pixels_convertRGBToYUVSIMD", "Tests the SIMD RGB to YUV conversions against the C ones", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference pixelsTest8 =
+        { (SDLTest_TestCaseFp)pixels_convertP01x, "pixels_convertP01x", "Tests the P010 and P016 conversions to NV12 and RGB", TEST_ENABLED };
+
 /* Sequence of Pixels test cases */
 static const SDLTest_TestCaseReference *pixelsTests[] =  {
-    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, NULL
+    &pixelsTest1, &pixelsTest2, &pixelsTest3, &pixelsTest4, &pixelsTest5, &pixelsTest6, &pixelsTest7, &pixelsTest8, NULL
 };
 
 /* Pixels test suite (global) */
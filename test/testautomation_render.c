@@ -811,6 +811,1070 @@ int render_testBlitBlend(void *arg)
     return TEST_COMPLETED;
 }
 
+/**
+ * @brief Renders a scene that mixes textures, blend modes and primitives
+ *        with a fresh batching software renderer. Helper function.
+ *
+ * \param reorder whether the renderer may reorder its commands
+ * \param copy_commands filled in with the number of copy commands the scene flushed
+ * \returns the rendered surface, or NULL on failure
+ */
+static SDL_Surface *
+_renderReorderScene(SDL_bool reorder, Uint32 *copy_commands)
+{
+    SDL_Renderer *r = NULL;
+    SDL_Surface *face, *result;
+    SDL_Texture *tfaces[2];
+    SDL_RenderStats stats;
+    SDL_Vertex verts[3];
+    SDL_Rect rect;
+    SDL_Point pivot;
+    int i, ret;
+
+    *copy_commands = 0;
+
+    /* The software renderer queues the same commands whatever the video driver and render hints */
+    result = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(result != NULL, "Check SDL_CreateRGBSurfaceWithFormat result");
+    if (!result) {
+        return NULL;
+    }
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, "1", SDL_HINT_OVERRIDE);
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_REORDER_COMMANDS, reorder ? "1" : "0", SDL_HINT_OVERRIDE);
+    r = SDL_CreateSoftwareRenderer(result);
+    SDL_ResetHint(SDL_HINT_RENDER_REORDER_COMMANDS);
+    SDL_ResetHint(SDL_HINT_RENDER_BATCHING);
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateSoftwareRenderer result");
+    if (!r) {
+        goto failed;
+    }
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Check SDLTest_ImageFace result");
+    if (!face) {
+        goto failed;
+    }
+    tfaces[0] = SDL_CreateTextureFromSurface(r, face);
+    tfaces[1] = SDL_CreateTextureFromSurface(r, face);
+    SDL_FreeSurface(face);
+    if (!tfaces[0] || !tfaces[1]) {
+        SDLTest_LogError("SDL_CreateTextureFromSurface() failed with error: %s", SDL_GetError());
+        goto failed;
+    }
+    SDL_SetTextureBlendMode(tfaces[0], SDL_BLENDMODE_BLEND);
+    SDL_SetTextureBlendMode(tfaces[1], SDL_BLENDMODE_ADD);
+
+    /* Start a fresh frame, so the statistics only count the scene */
+    SDL_RenderPresent(r);
+
+    SDL_SetRenderDrawColor(r, 13, 73, 200, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(r);
+
+    /* Alternate between the textures, some copies overlap and some don't.
+       Both use the same color mod, so no color change separates the copies. */
+    rect.w = 16;
+    rect.h = 16;
+    for (i = 0; i < 24; ++i) {
+        rect.x = (i * 13) % (TESTRENDER_SCREEN_W - rect.w);
+        rect.y = (i * 7) % (TESTRENDER_SCREEN_H - rect.h);
+        ret = SDL_RenderCopy(r, tfaces[i % 2], NULL, &rect);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopy, expected: 0, got: %i", ret);
+    }
+
+    /* Rotated copies and primitives in between */
+    pivot.x = 4;
+    pivot.y = 4;
+    rect.x = 30;
+    rect.y = 20;
+    SDL_RenderCopyEx(r, tfaces[0], NULL, &rect, 30.0, &pivot, SDL_FLIP_NONE);
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(r, 255, 255, 0, 128);
+    rect.x = 50;
+    rect.y = 40;
+    SDL_RenderFillRect(r, &rect);
+    SDL_RenderDrawLine(r, 0, 0, TESTRENDER_SCREEN_W - 1, TESTRENDER_SCREEN_H - 1);
+    rect.x = 60;
+    rect.y = 4;
+    SDL_RenderCopy(r, tfaces[1], NULL, &rect);
+    rect.x = 2;
+    rect.y = 40;
+    SDL_RenderCopy(r, tfaces[0], NULL, &rect);
+
+    SDL_zeroa(verts);
+    verts[0].position.x = 10.0f;
+    verts[0].position.y = 50.0f;
+    verts[1].position.x = 40.0f;
+    verts[1].position.y = 58.0f;
+    verts[2].position.x = 25.0f;
+    verts[2].position.y = 30.0f;
+    for (i = 0; i < 3; ++i) {
+        verts[i].color.r = 255;
+        verts[i].color.a = 160;
+    }
+    SDL_RenderGeometry(r, NULL, verts, 3, NULL, 0);
+    rect.x = 20;
+    rect.y = 36;
+    SDL_RenderCopy(r, tfaces[1], NULL, &rect);
+
+    /* Presenting flushes the scene onto the surface and ends the frame */
+    SDL_RenderPresent(r);
+    ret = SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    *copy_commands = stats.copy_commands;
+
+    SDL_DestroyRenderer(r); /* destroys the textures too */
+    return result;
+
+failed:
+    if (r) {
+        SDL_DestroyRenderer(r);
+    }
+    SDL_FreeSurface(result);
+    return NULL;
+}
+
+/**
+ * @brief Checks that reordering batched render commands merges copies without changing the output.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_REORDER_COMMANDS
+ * http://wiki.libsdl.org/SDL_RenderGetStats
+ */
+int render_testReorderCommands(void *arg)
+{
+    SDL_Surface *expected, *reordered;
+    Uint32 expected_copies, reordered_copies;
+    int ret;
+
+    expected = _renderReorderScene(SDL_FALSE, &expected_copies);
+    reordered = _renderReorderScene(SDL_TRUE, &reordered_copies);
+    SDLTest_AssertCheck(expected != NULL && reordered != NULL, "Check that both scenes were rendered");
+    if (expected && reordered) {
+        ret = SDLTest_CompareSurfaces(reordered, expected, 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+        /* The 27 copies alternate between two textures, reordering groups the ones that don't overlap */
+        SDLTest_AssertCheck(expected_copies == 27, "Validate copy_commands without reordering, expected: 27, got: %" SDL_PRIu32, expected_copies);
+        SDLTest_AssertCheck(reordered_copies < expected_copies,
+                            "Validate copy_commands with reordering, expected: < %" SDL_PRIu32 ", got: %" SDL_PRIu32, expected_copies, reordered_copies);
+    }
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(reordered);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the per frame render statistics.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGetStats
+ */
+int render_testRenderStats(void *arg)
+{
+    SDL_RenderStats stats;
+    SDL_Surface *surface, *face;
+    SDL_Renderer *r = NULL;
+    SDL_Texture *tface = NULL;
+    SDL_Rect rect;
+    Uint32 tformat;
+    int taccess, tw, th;
+    int i, ret;
+
+    /* A batching software renderer counts the same commands whatever the video driver and render hints */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateRGBSurfaceWithFormat result");
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, "1", SDL_HINT_OVERRIDE);
+    SDL_SetHintWithPriority(SDL_HINT_RENDER_REORDER_COMMANDS, "0", SDL_HINT_OVERRIDE);
+    r = surface ? SDL_CreateSoftwareRenderer(surface) : NULL;
+    SDL_ResetHint(SDL_HINT_RENDER_BATCHING);
+    SDL_ResetHint(SDL_HINT_RENDER_REORDER_COMMANDS);
+    SDLTest_AssertCheck(r != NULL, "Verify SDL_CreateSoftwareRenderer result");
+
+    /* Start a fresh frame */
+    if (r) {
+        SDL_RenderPresent(r);
+    }
+
+    face = r ? SDLTest_ImageFace() : NULL;
+    if (face) {
+        tface = SDL_CreateTextureFromSurface(r, face);
+        SDL_FreeSurface(face);
+    }
+    SDLTest_AssertCheck(tface != NULL, "Verify SDL_CreateTextureFromSurface result");
+    if (tface == NULL) {
+        if (r) {
+            SDL_DestroyRenderer(r);
+        }
+        SDL_FreeSurface(surface);
+        return TEST_ABORTED;
+    }
+    ret = SDL_QueryTexture(tface, &tformat, &taccess, &tw, &th);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_QueryTexture, expected 0, got %i", ret);
+
+    SDL_SetRenderDrawColor(r, 0, 255, 0, SDL_ALPHA_OPAQUE);
+    for (i = 0; i < 3; ++i) {
+        rect.x = i * 10;
+        rect.y = 0;
+        rect.w = 5;
+        rect.h = 5;
+        SDL_RenderFillRect(r, &rect);
+    }
+    SDL_RenderCopy(r, tface, NULL, NULL);
+    SDL_RenderCopy(r, tface, NULL, NULL);
+    SDL_RenderPresent(r);
+
+    ret = SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertPass("Call to SDL_RenderGetStats()");
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.fill_rects_commands == 3, "Validate fill_rects_commands, expected: 3, got: %" SDL_PRIu32, stats.fill_rects_commands);
+    SDLTest_AssertCheck(stats.copy_commands == 2, "Validate copy_commands, expected: 2, got: %" SDL_PRIu32, stats.copy_commands);
+    SDLTest_AssertCheck(stats.flushes >= 1, "Validate flushes, expected: >= 1, got: %" SDL_PRIu32, stats.flushes);
+    SDLTest_AssertCheck(stats.flushes_present == 1, "Validate flushes_present, expected: 1, got: %" SDL_PRIu32, stats.flushes_present);
+    SDLTest_AssertCheck(stats.vertex_bytes > 0, "Validate vertex_bytes, expected: > 0, got: %" SDL_PRIu32, stats.vertex_bytes);
+    SDLTest_AssertCheck(stats.vertex_bytes_high_water > 0 && stats.vertex_bytes_high_water <= stats.vertex_bytes,
+                        "Validate vertex_bytes_high_water, expected: 1 to %" SDL_PRIu32 ", got: %" SDL_PRIu32, stats.vertex_bytes, stats.vertex_bytes_high_water);
+    SDLTest_AssertCheck(stats.texture_uploads == 1, "Validate texture_uploads, expected: 1, got: %" SDL_PRIu32, stats.texture_uploads);
+    SDLTest_AssertCheck(stats.texture_upload_bytes == (Uint32)(tw * th * SDL_BYTESPERPIXEL(tformat)),
+                        "Validate texture_upload_bytes, expected: %i, got: %" SDL_PRIu32, tw * th * SDL_BYTESPERPIXEL(tformat), stats.texture_upload_bytes);
+
+    /* An empty frame doesn't do any work */
+    SDL_RenderPresent(r);
+    ret = SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.flushes == 0, "Validate flushes, expected: 0, got: %" SDL_PRIu32, stats.flushes);
+    SDLTest_AssertCheck(stats.copy_commands == 0, "Validate copy_commands, expected: 0, got: %" SDL_PRIu32, stats.copy_commands);
+
+    /* Invalid parameters */
+    ret = SDL_RenderGetStats(r, NULL);
+    SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetStats(r, NULL), expected: -1, got: %i", ret);
+    ret = SDL_RenderGetStats(NULL, &stats);
+    SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderGetStats(NULL, stats), expected: -1, got: %i", ret);
+
+    SDL_DestroyRenderer(r); /* destroys the texture too */
+    SDL_FreeSurface(surface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Reads back the current frame. Helper function.
+ */
+static SDL_Surface *
+_readScreen(void)
+{
+    SDL_Surface *surface;
+    SDL_Rect rect;
+    int ret;
+
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H;
+    surface = SDL_CreateRGBSurfaceWithFormat(0, rect.w, rect.h, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(surface != NULL, "Verify SDL_CreateRGBSurfaceWithFormat result");
+    if (surface) {
+        ret = SDL_RenderReadPixels(renderer, &rect, RENDER_COMPARE_FORMAT, surface->pixels, surface->pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+    }
+    return surface;
+}
+
+/**
+ * @brief Tests that a batch of copies matches the same copies done one by one.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderCopyBatchF
+ * http://wiki.libsdl.org/SDL_RenderCopyF
+ */
+int render_testRenderCopyBatch(void *arg)
+{
+    SDL_Texture *tface;
+    SDL_Rect srcrects[16];
+    SDL_FRect dstrects[16];
+    SDL_Color colors[16];
+    SDL_Surface *expected, *batched;
+    int i, ret, pass;
+
+    tface = _loadTestFace();
+    SDLTest_AssertCheck(tface != NULL, "Verify _loadTestFace() result");
+    if (tface == NULL) {
+        return TEST_ABORTED;
+    }
+    SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+
+    for (i = 0; i < SDL_arraysize(srcrects); ++i) {
+        srcrects[i].x = (i % 4) * 8;
+        srcrects[i].y = (i / 4) * 8;
+        srcrects[i].w = 24;
+        srcrects[i].h = 24;
+        /* Some overlap, some are partially or completely off screen */
+        dstrects[i].x = (float)((i * 11) % (TESTRENDER_SCREEN_W + 20) - 10);
+        dstrects[i].y = (float)((i * 7) % TESTRENDER_SCREEN_H);
+        dstrects[i].w = 16.0f + (i % 3) * 4.0f;
+        dstrects[i].h = 16.0f;
+        colors[i].r = (Uint8)(255 - i * 8);
+        colors[i].g = (Uint8)(i * 16);
+        colors[i].b = 128;
+        colors[i].a = (Uint8)(i < 8 ? 255 : 128);
+    }
+
+    /* Pass 0 uses the texture modulation, pass 1 per-sprite colors */
+    for (pass = 0; pass < 2; ++pass) {
+        _clearScreen();
+        for (i = 0; i < SDL_arraysize(srcrects); ++i) {
+            if (pass == 1) {
+                SDL_SetTextureColorMod(tface, colors[i].r, colors[i].g, colors[i].b);
+                SDL_SetTextureAlphaMod(tface, colors[i].a);
+            }
+            SDL_RenderCopyF(renderer, tface, &srcrects[i], &dstrects[i]);
+        }
+        expected = _readScreen();
+
+        SDL_SetTextureColorMod(tface, 255, 255, 255);
+        SDL_SetTextureAlphaMod(tface, 255);
+
+        _clearScreen();
+        ret = SDL_RenderCopyBatchF(renderer, tface, srcrects, dstrects, pass == 1 ? colors : NULL, SDL_arraysize(srcrects));
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatchF, expected: 0, got: %i", ret);
+        batched = _readScreen();
+
+        if (expected && batched) {
+            ret = SDLTest_CompareSurfaces(batched, expected, 0);
+            SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+        }
+        SDL_FreeSurface(expected);
+        SDL_FreeSurface(batched);
+    }
+
+    /* Invalid parameters */
+    ret = SDL_RenderCopyBatchF(renderer, tface, NULL, NULL, NULL, 1);
+    SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatchF with no destination rects, expected: -1, got: %i", ret);
+    ret = SDL_RenderCopyBatchF(renderer, tface, NULL, dstrects, NULL, -1);
+    SDLTest_AssertCheck(ret == -1, "Validate result from SDL_RenderCopyBatchF with a negative count, expected: -1, got: %i", ret);
+    ret = SDL_RenderCopyBatchF(renderer, tface, NULL, dstrects, NULL, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderCopyBatchF with no sprites, expected: 0, got: %i", ret);
+
+    SDL_DestroyTexture(tface);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests the vertex buffer reservation and shrinking.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_VERTEX_BUFFER_SIZE
+ * http://wiki.libsdl.org/SDL_RenderGetStats
+ */
+int render_testVertexBuffer(void *arg)
+{
+    const int num_rects = 20000;
+    SDL_Window *w;
+    SDL_Renderer *r;
+    SDL_RenderStats stats;
+    SDL_FRect *rects;
+    SDL_Rect rect;
+    Uint32 pixel;
+    int i, frame, ret;
+
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+    SDL_SetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SIZE, "65536");
+    SDL_SetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SHRINK, "2");
+    w = SDL_CreateWindow("testVertexBuffer", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, SDL_WINDOW_HIDDEN);
+    SDLTest_AssertCheck(w != NULL, "Check SDL_CreateWindow result");
+    r = w ? SDL_CreateRenderer(w, -1, 0) : NULL;
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateRenderer result");
+    SDL_ResetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SHRINK);
+    SDL_ResetHint(SDL_HINT_RENDER_VERTEX_BUFFER_SIZE);
+    SDL_ResetHint(SDL_HINT_RENDER_BATCHING);
+    rects = (SDL_FRect *)SDL_calloc(num_rects, sizeof(*rects));
+    if (!r || !rects) {
+        SDL_free(rects);
+        if (w) {
+            SDL_DestroyWindow(w);
+        }
+        return TEST_ABORTED;
+    }
+
+    SDL_RenderPresent(r);
+    ret = SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderGetStats, expected: 0, got: %i", ret);
+    SDLTest_AssertCheck(stats.vertex_buffer_bytes == 65536, "Validate reserved vertex_buffer_bytes, expected: %i, got: %" SDL_PRIu32, 65536, stats.vertex_buffer_bytes);
+
+    /* Grow past the reservation */
+    for (i = 0; i < num_rects; ++i) {
+        rects[i].x = (float)(i % TESTRENDER_SCREEN_W);
+        rects[i].y = (float)(i % TESTRENDER_SCREEN_H);
+        rects[i].w = 1.0f;
+        rects[i].h = 1.0f;
+    }
+    SDL_SetRenderDrawColor(r, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderFillRectsF(r, rects, num_rects);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.vertex_bytes_high_water > 65536, "Validate vertex_bytes_high_water, expected: > 65536, got: %" SDL_PRIu32, stats.vertex_bytes_high_water);
+    SDLTest_AssertCheck(stats.vertex_bytes_peak == stats.vertex_bytes_high_water, "Validate vertex_bytes_peak, expected: %" SDL_PRIu32 ", got: %" SDL_PRIu32, stats.vertex_bytes_high_water, stats.vertex_bytes_peak);
+    SDLTest_AssertCheck(stats.vertex_buffer_bytes > 65536, "Validate grown vertex_buffer_bytes, expected: > %i, got: %" SDL_PRIu32, 65536, stats.vertex_buffer_bytes);
+
+    /* Draws keep working when a flush starts the buffer over */
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = 1;
+    rect.h = 1;
+    for (frame = 0; frame < 4; ++frame) {
+        const Uint8 value = (Uint8)(frame * 50);
+
+        SDL_SetRenderDrawColor(r, value, value, value, SDL_ALPHA_OPAQUE);
+        SDL_RenderFillRect(r, NULL);
+        SDL_RenderFlush(r);
+        SDL_SetRenderDrawColor(r, 0, value, 0, SDL_ALPHA_OPAQUE);
+        SDL_RenderFillRect(r, &rect);
+        ret = SDL_RenderReadPixels(r, &rect, SDL_PIXELFORMAT_ARGB8888, &pixel, sizeof(pixel));
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+        SDLTest_AssertCheck(pixel == (0xFF000000 | ((Uint32)value << 8)), "Validate pixel, expected: 0x%.8" SDL_PRIx32 ", got: 0x%.8" SDL_PRIx32, (0xFF000000 | ((Uint32)value << 8)), pixel);
+        SDL_RenderPresent(r);
+    }
+
+    /* Idle frames give the memory back, down to the reservation */
+    SDL_RenderPresent(r);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.vertex_buffer_bytes == 65536, "Validate shrunk vertex_buffer_bytes, expected: %i, got: %" SDL_PRIu32, 65536, stats.vertex_buffer_bytes);
+
+    SDL_free(rects);
+    SDL_DestroyRenderer(r);
+    SDL_DestroyWindow(w);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws a scene that mixes commands that can be split into tiles
+ *        with ones that can't. Helper function.
+ */
+static SDL_Surface *
+_renderTileScene(SDL_Renderer *r, SDL_Texture *tface)
+{
+    SDL_Surface *result;
+    SDL_Vertex verts[6];
+    SDL_Rect rect, viewport;
+    SDL_Point points[16];
+    int i;
+
+    SDL_SetRenderDrawColor(r, 40, 80, 120, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(r);
+
+    /* Filled and blended rects crossing tile borders */
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(r, 200, 30, 30, SDL_ALPHA_OPAQUE);
+    rect.x = 4;
+    rect.y = 10;
+    rect.w = 30;
+    rect.h = 40;
+    SDL_RenderFillRect(r, &rect);
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(r, 30, 200, 30, 100);
+    rect.x = 20;
+    rect.y = 5;
+    SDL_RenderFillRect(r, &rect);
+
+    for (i = 0; i < SDL_arraysize(points); ++i) {
+        points[i].x = (i * 5) % TESTRENDER_SCREEN_W;
+        points[i].y = (i * 11) % TESTRENDER_SCREEN_H;
+    }
+    SDL_SetRenderDrawColor(r, 255, 255, 255, 180);
+    SDL_RenderDrawPoints(r, points, SDL_arraysize(points));
+
+    /* Unscaled copies, with and without modulation */
+    rect.w = 24;
+    rect.h = 24;
+    for (i = 0; i < 12; ++i) {
+        rect.x = (i * 17) % (TESTRENDER_SCREEN_W - 8) - 8;
+        rect.y = (i * 13) % TESTRENDER_SCREEN_H - 8;
+        SDL_SetTextureColorMod(tface, 255, (Uint8)(255 - i * 16), (Uint8)(i * 20));
+        SDL_SetTextureAlphaMod(tface, (Uint8)(i % 2 ? 255 : 140));
+        SDL_RenderCopy(r, tface, NULL, &rect);
+    }
+    SDL_SetTextureColorMod(tface, 255, 255, 255);
+    SDL_SetTextureAlphaMod(tface, 255);
+
+    /* Lines and scaled copies are drawn serially in between */
+    SDL_SetRenderDrawColor(r, 255, 255, 0, 200);
+    SDL_RenderDrawLine(r, 0, 0, TESTRENDER_SCREEN_W - 1, TESTRENDER_SCREEN_H - 1);
+    rect.x = 40;
+    rect.y = 12;
+    rect.w = 37;
+    rect.h = 45;
+    SDL_RenderCopy(r, tface, NULL, &rect);
+
+    /* Filled and textured triangles */
+    SDL_zeroa(verts);
+    verts[0].position.x = 5.0f;
+    verts[0].position.y = 55.0f;
+    verts[1].position.x = 70.0f;
+    verts[1].position.y = 3.0f;
+    verts[2].position.x = 60.0f;
+    verts[2].position.y = 58.0f;
+    for (i = 0; i < 3; ++i) {
+        verts[i].color.r = (Uint8)(i * 120);
+        verts[i].color.g = 90;
+        verts[i].color.b = 255;
+        verts[i].color.a = 150;
+    }
+    SDL_RenderGeometry(r, NULL, verts, 3, NULL, 0);
+    verts[3] = verts[0];
+    verts[4] = verts[1];
+    verts[5] = verts[2];
+    verts[3].position.x = 12.0f;
+    verts[3].tex_coord.x = 0.0f;
+    verts[3].tex_coord.y = 1.0f;
+    verts[4].tex_coord.x = 1.0f;
+    verts[4].tex_coord.y = 0.0f;
+    verts[5].tex_coord.x = 1.0f;
+    verts[5].tex_coord.y = 1.0f;
+    SDL_RenderGeometry(r, tface, &verts[3], 3, NULL, 0);
+
+    /* Draws inside a viewport with a clip rect */
+    viewport.x = 10;
+    viewport.y = 14;
+    viewport.w = 60;
+    viewport.h = 40;
+    SDL_RenderSetViewport(r, &viewport);
+    rect.x = 5;
+    rect.y = 3;
+    rect.w = 40;
+    rect.h = 30;
+    SDL_RenderSetClipRect(r, &rect);
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = 42;
+    rect.h = 42;
+    SDL_RenderCopy(r, tface, NULL, &rect);
+    SDL_SetRenderDrawColor(r, 0, 0, 255, 120);
+    rect.x = 20;
+    rect.y = 10;
+    rect.w = 50;
+    rect.h = 50;
+    SDL_RenderFillRect(r, &rect);
+    SDL_RenderSetClipRect(r, NULL);
+    SDL_RenderSetViewport(r, NULL);
+
+    result = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(result != NULL, "Verify SDL_CreateRGBSurfaceWithFormat result");
+    if (result) {
+        int ret = SDL_RenderReadPixels(r, NULL, RENDER_COMPARE_FORMAT, result->pixels, result->pitch);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels, expected: 0, got: %i", ret);
+    }
+    return result;
+}
+
+/**
+ * @brief Tests that drawing in tiles on several threads matches drawing serially.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_TILES
+ */
+int render_testSoftwareTiles(void *arg)
+{
+    SDL_Window *w;
+    SDL_Renderer *r;
+    SDL_Surface *face, *expected, *tiled;
+    SDL_Texture *tface;
+    int ret;
+
+    /* A small target splits into several bands, and with a few threads they're drawn
+       concurrently. The thread count only applies if the worker pool isn't running yet. */
+    SDL_SetHint(SDL_HINT_JOB_THREADS, "4");
+    w = SDL_CreateWindow("testSoftwareTiles", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, SDL_WINDOW_HIDDEN);
+    SDLTest_AssertCheck(w != NULL, "Check SDL_CreateWindow result");
+    r = w ? SDL_CreateRenderer(w, -1, SDL_RENDERER_SOFTWARE) : NULL;
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateRenderer result");
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Check SDLTest_ImageFace result");
+    tface = (r && face) ? SDL_CreateTextureFromSurface(r, face) : NULL;
+    SDL_FreeSurface(face);
+    if (!tface) {
+        if (r) {
+            SDL_DestroyRenderer(r);
+        }
+        if (w) {
+            SDL_DestroyWindow(w);
+        }
+        SDL_ResetHint(SDL_HINT_JOB_THREADS);
+        return TEST_ABORTED;
+    }
+    SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILES, "0");
+    expected = _renderTileScene(r, tface);
+
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILES, "1");
+    tiled = _renderTileScene(r, tface);
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_TILES);
+    SDL_ResetHint(SDL_HINT_JOB_THREADS);
+
+    if (expected && tiled) {
+        ret = SDLTest_CompareSurfaces(tiled, expected, 0);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+    }
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(tiled);
+
+    SDL_DestroyRenderer(r); /* destroys the texture too */
+    SDL_DestroyWindow(w);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws rotated and flipped copies of a texture. Helper function.
+ */
+static void
+_renderRotatedCopies(SDL_Renderer *r, SDL_Texture *tface)
+{
+    SDL_Rect rect;
+
+    SDL_SetRenderDrawColor(r, 40, 80, 120, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(r);
+
+    rect.x = 4;
+    rect.y = 4;
+    rect.w = 40;
+    rect.h = 40;
+    SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureColorMod(tface, 255, 128, 64);
+    SDL_RenderCopyEx(r, tface, NULL, &rect, 30.0, NULL, SDL_FLIP_NONE);
+
+    /* The NONE blend mode applies the modulation before rotating */
+    rect.x = 36;
+    rect.y = 16;
+    SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_NONE);
+    SDL_SetTextureAlphaMod(tface, 200);
+    SDL_RenderCopyEx(r, tface, NULL, &rect, -45.0, NULL, SDL_FLIP_HORIZONTAL);
+    SDL_SetTextureColorMod(tface, 255, 255, 255);
+    SDL_SetTextureAlphaMod(tface, 255);
+}
+
+/**
+ * @brief Tests that rotated copies are reused, and redone when the texture changes.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_ROTATE_CACHE
+ */
+int render_testRotateCache(void *arg)
+{
+    SDL_Surface *face, *target, *uncached_target, *update;
+    SDL_Renderer *r, *uncached;
+    SDL_Texture *tface, *uncached_tface;
+    SDL_RenderStats stats;
+    Uint32 format;
+    int ret;
+
+    face = SDLTest_ImageFace();
+    SDLTest_AssertCheck(face != NULL, "Check SDLTest_ImageFace result");
+    target = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_FORMAT);
+    uncached_target = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, RENDER_COMPARE_FORMAT);
+    SDLTest_AssertCheck(target && uncached_target, "Check SDL_CreateRGBSurfaceWithFormat result");
+    if (!face || !target || !uncached_target) {
+        SDL_FreeSurface(face);
+        SDL_FreeSurface(target);
+        SDL_FreeSurface(uncached_target);
+        return TEST_ABORTED;
+    }
+
+    r = SDL_CreateSoftwareRenderer(target);
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateSoftwareRenderer result");
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_ROTATE_CACHE, "0");
+    uncached = SDL_CreateSoftwareRenderer(uncached_target);
+    SDLTest_AssertCheck(uncached != NULL, "Check SDL_CreateSoftwareRenderer result with the cache disabled");
+    SDL_ResetHint(SDL_HINT_RENDER_SOFTWARE_ROTATE_CACHE);
+    tface = r ? SDL_CreateTextureFromSurface(r, face) : NULL;
+    uncached_tface = uncached ? SDL_CreateTextureFromSurface(uncached, face) : NULL;
+    if (!tface || !uncached_tface) {
+        if (r) {
+            SDL_DestroyRenderer(r);
+        }
+        if (uncached) {
+            SDL_DestroyRenderer(uncached);
+        }
+        SDL_FreeSurface(face);
+        SDL_FreeSurface(target);
+        SDL_FreeSurface(uncached_target);
+        return TEST_ABORTED;
+    }
+
+    /* The first frame transforms everything */
+    _renderRotatedCopies(r, tface);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.copy_ex_cache_hits == 0 && stats.copy_ex_cache_misses == 2,
+                        "Verify first frame cache stats, expected: 0 hits 2 misses, got: %" SDL_PRIu32 " hits %" SDL_PRIu32 " misses",
+                        stats.copy_ex_cache_hits, stats.copy_ex_cache_misses);
+
+    /* The same copies again are drawn from the cache */
+    _renderRotatedCopies(r, tface);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.copy_ex_cache_hits == 2 && stats.copy_ex_cache_misses == 0,
+                        "Verify second frame cache stats, expected: 2 hits 0 misses, got: %" SDL_PRIu32 " hits %" SDL_PRIu32 " misses",
+                        stats.copy_ex_cache_hits, stats.copy_ex_cache_misses);
+
+    /* New texture contents have to be transformed again, the face image itself is read-only */
+    SDL_QueryTexture(tface, &format, NULL, NULL, NULL);
+    update = SDL_ConvertSurfaceFormat(face, format, 0);
+    SDLTest_AssertCheck(update != NULL, "Check SDL_ConvertSurfaceFormat result");
+    if (update) {
+        SDL_Rect rect;
+        rect.x = 0;
+        rect.y = 0;
+        rect.w = update->w;
+        rect.h = update->h / 2;
+        SDL_FillRect(update, &rect, SDL_MapRGBA(update->format, 0, 255, 0, 160));
+        SDL_UpdateTexture(tface, NULL, update->pixels, update->pitch);
+        SDL_UpdateTexture(uncached_tface, NULL, update->pixels, update->pitch);
+        SDL_FreeSurface(update);
+    }
+    _renderRotatedCopies(r, tface);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.copy_ex_cache_hits == 0 && stats.copy_ex_cache_misses == 2,
+                        "Verify cache stats after SDL_UpdateTexture, expected: 0 hits 2 misses, got: %" SDL_PRIu32 " hits %" SDL_PRIu32 " misses",
+                        stats.copy_ex_cache_hits, stats.copy_ex_cache_misses);
+
+    _renderRotatedCopies(uncached, uncached_tface);
+    SDL_RenderPresent(uncached);
+    SDL_RenderGetStats(uncached, &stats);
+    SDLTest_AssertCheck(stats.copy_ex_cache_hits == 0, "Verify no cache hits with the cache disabled, got: %" SDL_PRIu32, stats.copy_ex_cache_hits);
+
+    ret = SDLTest_CompareSurfaces(target, uncached_target, 0);
+    SDLTest_AssertCheck(ret == 0, "Validate result from SDLTest_CompareSurfaces, expected: 0, got: %i", ret);
+
+    SDL_DestroyRenderer(r); /* destroys the texture too */
+    SDL_DestroyRenderer(uncached);
+    SDL_FreeSurface(face);
+    SDL_FreeSurface(target);
+    SDL_FreeSurface(uncached_target);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws a rectangle as a fan of triangles around an off-center point. Helper function.
+ */
+static void
+_renderTriangleFan(SDL_Renderer *r, SDL_Texture *texture, const SDL_Rect *rect, SDL_Color color)
+{
+    const float cx = (float)rect->x + rect->w * 0.37f;
+    const float cy = (float)rect->y + rect->h * 0.61f;
+    const float corners[5][2] = {
+        { 0.0f, 0.0f }, { 1.0f, 0.0f }, { 1.0f, 1.0f }, { 0.0f, 1.0f }, { 0.0f, 0.0f }
+    };
+    SDL_Vertex vertices[4 * 3];
+    int i, j;
+
+    for (i = 0; i < 4; ++i) {
+        SDL_Vertex *v = &vertices[i * 3];
+
+        v[0].position.x = cx;
+        v[0].position.y = cy;
+        for (j = 0; j < 2; ++j) {
+            v[1 + j].position.x = (float)rect->x + corners[i + j][0] * rect->w;
+            v[1 + j].position.y = (float)rect->y + corners[i + j][1] * rect->h;
+        }
+        for (j = 0; j < 3; ++j) {
+            v[j].color = color;
+            v[j].tex_coord.x = (v[j].position.x - rect->x) / rect->w;
+            v[j].tex_coord.y = (v[j].position.y - rect->y) / rect->h;
+        }
+    }
+    SDL_RenderGeometry(r, texture, vertices, SDL_arraysize(vertices), NULL, 0);
+}
+
+/**
+ * @brief Checks that a rectangle is filled with a single color, and the rest is untouched. Helper function.
+ */
+static int
+_countFanErrors(SDL_Surface *surface, const SDL_Rect *rect, Uint32 background)
+{
+    const Uint32 *pixels = (const Uint32 *)surface->pixels;
+    const Uint32 inside = pixels[rect->y * (surface->pitch / 4) + rect->x];
+    int x, y, errors = 0;
+
+    if (inside == background) {
+        return surface->w * surface->h;
+    }
+    for (y = 0; y < surface->h; ++y) {
+        for (x = 0; x < surface->w; ++x) {
+            const SDL_Point p = { x, y };
+            const Uint32 expected = SDL_PointInRect(&p, rect) ? inside : background;
+
+            if (pixels[y * (surface->pitch / 4) + x] != expected) {
+                ++errors;
+            }
+        }
+    }
+    return errors;
+}
+
+/**
+ * @brief Tests that triangles sharing an edge leave no gaps and don't draw the edge twice.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGeometry
+ */
+int render_testGeometryFillRule(void *arg)
+{
+    const SDL_Rect rect = { 11, 7, 57, 43 };
+    const SDL_Color color = { 200, 100, 50, 128 };
+    SDL_Surface *target, *solid;
+    SDL_Renderer *r;
+    SDL_Texture *texture;
+    Uint32 background;
+    int errors;
+
+    target = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(target != NULL, "Check SDL_CreateRGBSurfaceWithFormat result");
+    solid = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(solid != NULL, "Check SDL_CreateRGBSurfaceWithFormat result");
+    r = target ? SDL_CreateSoftwareRenderer(target) : NULL;
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateSoftwareRenderer result");
+    if (solid) {
+        SDL_FillRect(solid, NULL, SDL_MapRGBA(solid->format, 60, 180, 240, 160));
+    }
+    texture = (r && solid) ? SDL_CreateTextureFromSurface(r, solid) : NULL;
+    SDL_FreeSurface(solid);
+    if (!texture) {
+        if (r) {
+            SDL_DestroyRenderer(r);
+        }
+        SDL_FreeSurface(target);
+        return TEST_ABORTED;
+    }
+    SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND);
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    background = SDL_MapRGB(target->format, 16, 32, 64);
+
+    /* Blending makes any pixel covered twice stand out */
+    SDL_FillRect(target, NULL, background);
+    _renderTriangleFan(r, NULL, &rect, color);
+    SDL_RenderPresent(r);
+    errors = _countFanErrors(target, &rect, background);
+    SDLTest_AssertCheck(errors == 0, "Validate filled triangle fan, expected: 0 wrong pixels, got: %i", errors);
+
+    SDL_FillRect(target, NULL, background);
+    _renderTriangleFan(r, texture, &rect, color);
+    SDL_RenderPresent(r);
+    errors = _countFanErrors(target, &rect, background);
+    SDLTest_AssertCheck(errors == 0, "Validate textured triangle fan, expected: 0 wrong pixels, got: %i", errors);
+
+    SDL_DestroyRenderer(r); /* destroys the texture too */
+    SDL_FreeSurface(target);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws blended, textured triangles on a new surface, with the given blitter CPU features. Helper function.
+ */
+static SDL_Surface *
+_renderBlendedTriangles(const char *features, Uint32 format, SDL_Surface *pixels, const SDL_Vertex *verts, int num_verts)
+{
+    SDL_Surface *target;
+    SDL_Renderer *r;
+    SDL_Texture *texture;
+    int i;
+
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", features, 1);
+    target = SDL_CreateRGBSurfaceWithFormat(0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 32, format);
+    if (!target) {
+        return NULL;
+    }
+    for (i = 0; i < target->h * target->pitch; ++i) {
+        ((Uint8 *)target->pixels)[i] = (Uint8)(i * 7);
+    }
+    r = SDL_CreateSoftwareRenderer(target);
+    texture = r ? SDL_CreateTextureFromSurface(r, pixels) : NULL;
+    if (!texture) {
+        if (r) {
+            SDL_DestroyRenderer(r);
+        }
+        SDL_FreeSurface(target);
+        return NULL;
+    }
+    SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(r, texture, verts, num_verts, NULL, 0);
+    SDL_SetTextureAlphaMod(texture, 200);
+    SDL_RenderGeometry(r, texture, verts, 3, NULL, 0);
+    SDL_RenderPresent(r);
+
+    SDL_DestroyRenderer(r); /* destroys the texture too */
+    return target;
+}
+
+/**
+ * @brief Tests that the vector blending of textured triangles matches the scalar code.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_RenderGeometry
+ */
+int render_testGeometryBlendSIMD(void *arg)
+{
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888 };
+    /* Everything available, and SSE2 */
+    static const char *features[] = { "65535", "8" };
+    const char *env = SDL_getenv("SDL_BLIT_CPU_FEATURES");
+    char *saved = SDL_strdup(env ? env : "");
+    SDL_Surface *pixels;
+    SDL_Vertex verts[9];
+    int i, j, ret;
+
+    pixels = SDL_CreateRGBSurfaceWithFormat(0, 23, 17, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(pixels != NULL, "Check SDL_CreateRGBSurfaceWithFormat result");
+    if (!pixels) {
+        SDL_free(saved);
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < pixels->h * pixels->pitch; ++i) {
+        ((Uint8 *)pixels->pixels)[i] = SDLTest_RandomUint8();
+    }
+    /* Spans of every length, with vertex colors and alpha */
+    for (i = 0; i < SDL_arraysize(verts); ++i) {
+        verts[i].position.x = (float)SDLTest_RandomIntegerInRange(-10, TESTRENDER_SCREEN_W + 10);
+        verts[i].position.y = (float)SDLTest_RandomIntegerInRange(-10, TESTRENDER_SCREEN_H + 10);
+        verts[i].color.r = SDLTest_RandomUint8();
+        verts[i].color.g = SDLTest_RandomUint8();
+        verts[i].color.b = SDLTest_RandomUint8();
+        verts[i].color.a = SDLTest_RandomUint8();
+        verts[i].tex_coord.x = SDLTest_RandomUnitFloat();
+        verts[i].tex_coord.y = SDLTest_RandomUnitFloat();
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *expected = _renderBlendedTriangles("0", formats[i], pixels, verts, SDL_arraysize(verts));
+
+        SDLTest_AssertCheck(expected != NULL, "Check that the triangles were drawn without vector code");
+        for (j = 0; expected && j < SDL_arraysize(features); ++j) {
+            SDL_Surface *actual = _renderBlendedTriangles(features[j], formats[i], pixels, verts, SDL_arraysize(verts));
+
+            SDLTest_AssertCheck(actual != NULL, "Check that the triangles were drawn with features %s", features[j]);
+            if (actual) {
+                ret = SDLTest_CompareSurfaces(actual, expected, 0);
+                SDLTest_AssertCheck(ret == 0, "Validate %s triangles with features %s, expected: 0, got: %i",
+                                    SDL_GetPixelFormatName(formats[i]), features[j], ret);
+                SDL_FreeSurface(actual);
+            }
+        }
+        SDL_FreeSurface(expected);
+    }
+
+    SDL_FreeSurface(pixels);
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", saved, 1);
+    SDL_free(saved);
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that the software renderer only presents the parts of the window that changed.
+ *
+ * \sa
+ * http://wiki.libsdl.org/SDL_HINT_RENDER_SOFTWARE_DIRTY_RECTS
+ */
+int render_testDirtyRects(void *arg)
+{
+    SDL_Window *w;
+    SDL_Renderer *r;
+    SDL_RenderStats stats;
+    SDL_Rect rect;
+    SDL_Point points[2];
+
+    w = SDL_CreateWindow("testDirtyRects", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, SDL_WINDOW_HIDDEN);
+    SDLTest_AssertCheck(w != NULL, "Check SDL_CreateWindow result");
+    r = w ? SDL_CreateRenderer(w, -1, SDL_RENDERER_SOFTWARE) : NULL;
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateRenderer result");
+    if (!r) {
+        if (w) {
+            SDL_DestroyWindow(w);
+        }
+        return TEST_ABORTED;
+    }
+
+    /* Clearing changes the whole window */
+    SDL_SetRenderDrawColor(r, 0, 0, 0, SDL_ALPHA_OPAQUE);
+    SDL_RenderClear(r);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.present_rects == 0 && stats.present_pixels == TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H,
+                        "Verify full update after clear, expected: 0 rects %d pixels, got: %" SDL_PRIu32 " rects %" SDL_PRIu32 " pixels",
+                        TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H, stats.present_rects, stats.present_pixels);
+
+    /* Two small rects far apart are presented separately */
+    SDL_SetRenderDrawColor(r, 255, 0, 0, SDL_ALPHA_OPAQUE);
+    rect.x = 2;
+    rect.y = 3;
+    rect.w = 10;
+    rect.h = 5;
+    SDL_RenderFillRect(r, &rect);
+    rect.x = TESTRENDER_SCREEN_W - 20;
+    rect.y = TESTRENDER_SCREEN_H - 20;
+    SDL_RenderFillRect(r, &rect);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.present_rects == 2 && stats.present_pixels == 100,
+                        "Verify update of two rects, expected: 2 rects 100 pixels, got: %" SDL_PRIu32 " rects %" SDL_PRIu32 " pixels",
+                        stats.present_rects, stats.present_pixels);
+
+    /* Overlapping draws are merged, the viewport moves them and the window clips them */
+    rect.x = 10;
+    rect.y = 10;
+    rect.w = 20;
+    rect.h = 20;
+    SDL_RenderSetViewport(r, &rect);
+    points[0].x = 0;
+    points[0].y = 0;
+    points[1].x = 15;
+    points[1].y = 5;
+    SDL_RenderDrawLines(r, points, 2);
+    SDL_RenderSetViewport(r, NULL);
+    rect.x = -5;
+    rect.w = 16;
+    rect.h = 1;
+    SDL_RenderFillRect(r, &rect);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.present_rects == 1 && stats.present_pixels == 26 * 6,
+                        "Verify update of merged draws, expected: 1 rect 156 pixels, got: %" SDL_PRIu32 " rects %" SDL_PRIu32 " pixels",
+                        stats.present_rects, stats.present_pixels);
+
+    /* Covering most of the window falls back to a full update */
+    rect.x = 0;
+    rect.y = 0;
+    rect.w = TESTRENDER_SCREEN_W;
+    rect.h = TESTRENDER_SCREEN_H - 10;
+    SDL_RenderFillRect(r, &rect);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.present_rects == 0, "Verify full update of a large change, expected: 0 rects, got: %" SDL_PRIu32, stats.present_rects);
+
+    /* A window that shows up again may have lost what was presented before */
+    rect.x = 2;
+    rect.y = 3;
+    rect.w = 10;
+    rect.h = 5;
+    SDL_RenderFillRect(r, &rect);
+    SDL_ShowWindow(w);
+    SDL_RenderPresent(r);
+    SDL_RenderGetStats(r, &stats);
+    SDLTest_AssertCheck(stats.present_rects == 0 && stats.present_pixels == TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H,
+                        "Verify full update after showing the window, expected: 0 rects %d pixels, got: %" SDL_PRIu32 " rects %" SDL_PRIu32 " pixels",
+                        TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H, stats.present_rects, stats.present_pixels);
+
+    SDL_DestroyRenderer(r);
+    SDL_DestroyWindow(w);
+
+    return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1127,6 +2191,395 @@ _clearScreen(void)
     return 0;
 }
 
+/**
+ * @brief Tests that linear scaled, blended copies match stretching and blitting separately
+ */
+int render_testScaledLinearCopy(void *arg)
+{
+    SDL_Surface *src, *dst, *ref, *scaled;
+    SDL_Renderer *r;
+    SDL_Texture *t;
+    SDL_Rect rects[2];
+    int i, x, y, errors = 0;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 16, 16, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 160, 160, 32, SDL_PIXELFORMAT_XRGB8888);
+    ref = SDL_CreateRGBSurfaceWithFormat(0, 160, 160, 32, SDL_PIXELFORMAT_XRGB8888);
+    SDLTest_AssertCheck(src && dst && ref, "Check SDL_CreateRGBSurfaceWithFormat result");
+    if (!src || !dst || !ref) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(ref);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < 16; ++y) {
+        for (x = 0; x < 16; ++x) {
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = SDL_MapRGBA(src->format, (Uint8)(x * 16), (Uint8)(y * 16), 0x80, (Uint8)((x + y) * 8));
+        }
+    }
+    for (y = 0; y < 160; ++y) {
+        for (x = 0; x < 160; ++x) {
+            ((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x] = SDL_MapRGB(dst->format, (Uint8)x, 0x40, (Uint8)y);
+        }
+    }
+    SDL_BlitSurface(dst, NULL, ref, NULL);
+
+    /* One copy inside the target and a large one crossing its edges, which is scaled in several chunks */
+    rects[0].x = 5;
+    rects[0].y = 3;
+    rects[0].w = 37;
+    rects[0].h = 23;
+    rects[1].x = -10;
+    rects[1].y = 100;
+    rects[1].w = 150;
+    rects[1].h = 90;
+
+    r = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateSoftwareRenderer result");
+    t = r ? SDL_CreateTextureFromSurface(r, src) : NULL;
+    SDLTest_AssertCheck(t != NULL, "Check SDL_CreateTextureFromSurface result");
+    if (t) {
+        SDL_SetTextureScaleMode(t, SDL_ScaleModeLinear);
+        SDL_SetTextureBlendMode(t, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureColorMod(t, 0xC0, 0xFF, 0x80);
+        for (i = 0; i < 2; ++i) {
+            SDL_RenderCopy(r, t, NULL, &rects[i]);
+        }
+        SDL_RenderFlush(r);
+    }
+
+    /* The reference stretches into a surface of its own and blits that */
+    for (i = 0; i < 2; ++i) {
+        SDL_Rect dstrect = rects[i];
+
+        scaled = SDL_CreateRGBSurfaceWithFormat(0, rects[i].w, rects[i].h, 32, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(scaled != NULL, "Check SDL_CreateRGBSurfaceWithFormat result");
+        if (scaled) {
+            SDL_SoftStretchLinear(src, NULL, scaled, NULL);
+            SDL_SetSurfaceBlendMode(scaled, SDL_BLENDMODE_BLEND);
+            SDL_SetSurfaceColorMod(scaled, 0xC0, 0xFF, 0x80);
+            SDL_BlitSurface(scaled, NULL, ref, &dstrect);
+            SDL_FreeSurface(scaled);
+        }
+    }
+
+    for (y = 0; y < 160; ++y) {
+        const Uint32 *actual = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+        const Uint32 *expected = (const Uint32 *)((const Uint8 *)ref->pixels + y * ref->pitch);
+
+        for (x = 0; x < 160; ++x) {
+            if (actual[x] != expected[x]) {
+                ++errors;
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify scaled copies match the reference, expected: 0 differing pixels, got: %d", errors);
+
+    if (t) {
+        SDL_DestroyTexture(t);
+    }
+    if (r) {
+        SDL_DestroyRenderer(r);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(ref);
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Draws a linear scaled, blended copy of new pixels, with the texture given or a new one. Helper function.
+ */
+static void
+_renderConvertedCopy(SDL_Renderer *r, SDL_Texture *t, Uint32 format, const void *pixels, const SDL_Rect *srcrect, const SDL_Rect *dstrect)
+{
+    SDL_Texture *tmp = t ? t : SDL_CreateTexture(r, format, SDL_TEXTUREACCESS_STATIC, 24, 20);
+
+    if (tmp) {
+        SDL_UpdateTexture(tmp, NULL, pixels, 24 * SDL_BYTESPERPIXEL(format));
+        SDL_SetTextureScaleMode(tmp, SDL_ScaleModeLinear);
+        SDL_SetTextureBlendMode(tmp, SDL_BLENDMODE_BLEND);
+        SDL_SetTextureAlphaMod(tmp, 200);
+        SDL_SetTextureColorMod(tmp, 0xC0, 0xFF, 0x80);
+        SDL_RenderCopy(r, tmp, srcrect, dstrect);
+        SDL_RenderFlush(r);
+        if (tmp != t) {
+            SDL_DestroyTexture(tmp);
+        }
+    }
+}
+
+/**
+ * @brief Tests that repeated linear scaled copies of a texture converted before scaling match copies of new textures
+ */
+int render_testScaledLinearConvertedCopy(void *arg)
+{
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB555 };
+    /* The converted pixels are kept from the first copy, then reused for smaller ones */
+    static const SDL_Rect srcrects[] = { { 0, 0, 24, 20 }, { 3, 5, 11, 9 }, { 1, 2, 23, 18 } };
+    const SDL_Rect dstrect = { 7, 5, 61, 47 };
+    Uint8 pixels[24 * 20 * 2];
+    int i, j, k, ret;
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, 80, 60, 32, SDL_PIXELFORMAT_XRGB8888);
+        SDL_Surface *ref = SDL_CreateRGBSurfaceWithFormat(0, 80, 60, 32, SDL_PIXELFORMAT_XRGB8888);
+        SDL_Renderer *r = dst ? SDL_CreateSoftwareRenderer(dst) : NULL;
+        SDL_Renderer *rref = ref ? SDL_CreateSoftwareRenderer(ref) : NULL;
+        SDL_Texture *t = r ? SDL_CreateTexture(r, formats[i], SDL_TEXTUREACCESS_STATIC, 24, 20) : NULL;
+
+        SDLTest_AssertCheck(t && rref, "Check that the renderers and the texture were created");
+        if (t && rref) {
+            SDL_FillRect(dst, NULL, SDL_MapRGB(dst->format, 0x20, 0x40, 0x60));
+            SDL_FillRect(ref, NULL, SDL_MapRGB(ref->format, 0x20, 0x40, 0x60));
+            for (j = 0; j < SDL_arraysize(srcrects); ++j) {
+                for (k = 0; k < sizeof(pixels); ++k) {
+                    pixels[k] = SDLTest_RandomUint8();
+                }
+                _renderConvertedCopy(r, t, formats[i], pixels, &srcrects[j], &dstrect);
+                _renderConvertedCopy(rref, NULL, formats[i], pixels, &srcrects[j], &dstrect);
+            }
+            ret = SDLTest_CompareSurfaces(dst, ref, 0);
+            SDLTest_AssertCheck(ret == 0, "Validate repeated copies of %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+        }
+        if (r) {
+            SDL_DestroyRenderer(r); /* destroys the texture too */
+        }
+        if (rref) {
+            SDL_DestroyRenderer(rref);
+        }
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(ref);
+    }
+
+    return TEST_COMPLETED;
+}
+
+/**
+ * @brief Fills a YUV frame with sharp changes of brightness in a color that is the same everywhere,
+ * so where its pixels end up doesn't depend on how the chroma is sampled. Helper function.
+ */
+static int
+_fillYUVFrame(Uint32 format, int w, int h, int phase, Uint8 *yuv)
+{
+    const Uint8 u = (Uint8)(96 + phase), v = (Uint8)(160 - phase);
+    const int pitch = (format == SDL_PIXELFORMAT_YUY2) ? w * 2 : w;
+    Uint8 *uv = yuv + w * h;
+    int x, y;
+
+    for (y = 0; y < h; ++y) {
+        for (x = 0; x < w; ++x) {
+            const Uint8 luma = (Uint8)(16 + (x * 7 + y * 5 + phase) % 220);
+
+            if (format == SDL_PIXELFORMAT_YUY2) {
+                yuv[y * pitch + x * 2] = luma;
+                yuv[y * pitch + x * 2 + 1] = (x & 1) ? v : u;
+            } else {
+                yuv[y * pitch + x] = luma;
+            }
+        }
+    }
+    if (format == SDL_PIXELFORMAT_NV12) {
+        for (x = 0; x < w * h / 2; x += 2) {
+            uv[x] = u;
+            uv[x + 1] = v;
+        }
+    } else if (format == SDL_PIXELFORMAT_YV12) {
+        SDL_memset(uv, v, w * h / 4);
+        SDL_memset(uv + w * h / 4, u, w * h / 4);
+    }
+    return pitch;
+}
+
+/**
+ * @brief Tests copies of YUV textures with the software renderer, which converts shrunk copies as it scales them
+ */
+int render_testYUVCopy(void *arg)
+{
+    static const Uint32 formats[] = { SDL_PIXELFORMAT_NV12, SDL_PIXELFORMAT_YV12, SDL_PIXELFORMAT_YUY2 };
+    /* Shrunk, unscaled, magnified and clipped copies */
+    static const SDL_Rect srcrects[] = { { 0, 0, 64, 48 }, { 8, 6, 20, 16 }, { 4, 2, 16, 12 }, { 0, 0, 64, 48 } };
+    static const SDL_Rect dstrects[] = { { 3, 4, 40, 30 }, { 50, 3, 20, 16 }, { 5, 38, 36, 27 }, { 70, 50, 32, 24 } };
+    const int w = 64, h = 48;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(w * h * 2);
+    Uint8 *rgb = (Uint8 *)SDL_malloc(w * h * 4);
+    int i, j, frame, pitch, ret;
+
+    SDLTest_AssertCheck(yuv && rgb, "Check that the frames were allocated");
+    if (!yuv || !rgb) {
+        SDL_free(yuv);
+        SDL_free(rgb);
+        return TEST_ABORTED;
+    }
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, 96, 72, 32, SDL_PIXELFORMAT_XRGB8888);
+        SDL_Surface *ref = SDL_CreateRGBSurfaceWithFormat(0, 96, 72, 32, SDL_PIXELFORMAT_XRGB8888);
+        SDL_Renderer *r = dst ? SDL_CreateSoftwareRenderer(dst) : NULL;
+        SDL_Renderer *rref = ref ? SDL_CreateSoftwareRenderer(ref) : NULL;
+        SDL_Texture *t = r ? SDL_CreateTexture(r, formats[i], SDL_TEXTUREACCESS_STREAMING, w, h) : NULL;
+        SDL_Texture *tref = rref ? SDL_CreateTexture(rref, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, w, h) : NULL;
+
+        SDLTest_AssertCheck(t && tref, "Check that the renderers and the textures were created");
+        if (t && tref) {
+            SDL_SetRenderDrawColor(r, 0x20, 0x40, 0x60, 0xFF);
+            SDL_RenderClear(r);
+            SDL_SetRenderDrawColor(rref, 0x20, 0x40, 0x60, 0xFF);
+            SDL_RenderClear(rref);
+
+            /* Every copy after the first frame has to see the new pixels, whichever way it's drawn */
+            for (frame = 0; frame < 2; ++frame) {
+                pitch = _fillYUVFrame(formats[i], w, h, frame * 50, yuv);
+                ret = SDL_ConvertPixels(w, h, formats[i], yuv, pitch, SDL_PIXELFORMAT_ARGB8888, rgb, w * 4);
+                SDLTest_AssertCheck(ret == 0, "Check that a %s frame was converted, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+                SDL_UpdateTexture(t, NULL, yuv, pitch);
+                SDL_UpdateTexture(tref, NULL, rgb, w * 4);
+                for (j = frame * 2; j < SDL_arraysize(srcrects); ++j) {
+                    SDL_RenderCopy(r, t, &srcrects[j], &dstrects[j]);
+                    SDL_RenderCopy(rref, tref, &srcrects[j], &dstrects[j]);
+                }
+                SDL_RenderFlush(r);
+                SDL_RenderFlush(rref);
+            }
+
+            ret = SDLTest_CompareSurfaces(dst, ref, 0);
+            SDLTest_AssertCheck(ret == 0, "Validate copies of %s, expected: 0, got: %i", SDL_GetPixelFormatName(formats[i]), ret);
+        }
+        if (r) {
+            SDL_DestroyRenderer(r); /* destroys the texture too */
+        }
+        if (rref) {
+            SDL_DestroyRenderer(rref);
+        }
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(ref);
+    }
+
+    SDL_free(yuv);
+    SDL_free(rgb);
+    return TEST_COMPLETED;
+}
+
+/* Expected channel of a premultiplied blend, with a little room for the rounding of the drawing code */
+static SDL_bool _checkPremultiplied(Uint8 actual, Uint8 src, Uint8 src_alpha, Uint8 dst)
+{
+    const int expected = SDL_min(src + dst * (255 - src_alpha) / 255, 255);
+
+    return (SDL_abs(actual - expected) <= 1) ? SDL_TRUE : SDL_FALSE;
+}
+
+/**
+ * @brief Tests drawing and copying with the premultiplied alpha blend mode in the software renderer
+ */
+int render_testPremultipliedBlend(void *arg)
+{
+    const SDL_Rect fill = { 2, 2, 16, 16 };
+    const SDL_Rect copy = { 21, 3, 8, 8 };
+    const int line_y = 30;
+    SDL_Surface *src, *dst, *ref;
+    SDL_Renderer *r;
+    SDL_Texture *t;
+    SDL_BlendMode mode;
+    SDL_Rect dstrect = copy;
+    int ret, x, y, errors = 0;
+
+    src = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 40, 40, 32, SDL_PIXELFORMAT_ARGB8888);
+    ref = SDL_CreateRGBSurfaceWithFormat(0, 40, 40, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src && dst && ref, "Check SDL_CreateRGBSurfaceWithFormat result");
+    if (!src || !dst || !ref) {
+        SDL_FreeSurface(src);
+        SDL_FreeSurface(dst);
+        SDL_FreeSurface(ref);
+        return TEST_ABORTED;
+    }
+    for (y = 0; y < 8; ++y) {
+        for (x = 0; x < 8; ++x) {
+            const Uint8 a = (Uint8)((x + y) * 18);
+
+            ((Uint32 *)((Uint8 *)src->pixels + y * src->pitch))[x] = SDL_MapRGBA(src->format, (Uint8)(x * 32 * a / 255), (Uint8)(y * 32 * a / 255), a / 2, a);
+        }
+    }
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    /* Bright enough in places that the colors drawn below saturate */
+    for (y = 0; y < 40; ++y) {
+        for (x = 0; x < 40; ++x) {
+            ((Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch))[x] = SDL_MapRGBA(dst->format, (Uint8)(x * 6), 0x90, (Uint8)(y * 6), (Uint8)(x * 3 + y * 3));
+        }
+    }
+    SDL_SetSurfaceBlendMode(dst, SDL_BLENDMODE_NONE);
+    SDL_BlitSurface(dst, NULL, ref, NULL);
+
+    r = SDL_CreateSoftwareRenderer(dst);
+    SDLTest_AssertCheck(r != NULL, "Check SDL_CreateSoftwareRenderer result");
+    t = r ? SDL_CreateTextureFromSurface(r, src) : NULL;
+    SDLTest_AssertCheck(t != NULL, "Check SDL_CreateTextureFromSurface result");
+    if (t) {
+        ret = SDL_SetRenderDrawBlendMode(r, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetRenderDrawBlendMode, expected: 0, got: %i", ret);
+        ret = SDL_GetRenderDrawBlendMode(r, &mode);
+        SDLTest_AssertCheck(ret == 0 && mode == SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+                            "Validate SDL_GetRenderDrawBlendMode, expected: %i, got: %i", SDL_BLENDMODE_BLEND_PREMULTIPLIED, mode);
+        ret = SDL_SetTextureBlendMode(t, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        SDLTest_AssertCheck(ret == 0, "Validate result from SDL_SetTextureBlendMode, expected: 0, got: %i", ret);
+
+        SDL_SetRenderDrawColor(r, 120, 60, 200, 96);
+        SDL_RenderFillRect(r, &fill);
+        SDL_RenderDrawLine(r, 2, line_y, 37, line_y);
+        SDL_RenderCopy(r, t, NULL, &copy);
+        SDL_RenderFlush(r);
+    }
+
+    /* The draw color is taken as premultiplied, so it is added as it is */
+    for (y = 0; y < 40; ++y) {
+        for (x = 0; x < 40; ++x) {
+            const SDL_Point p = { x, y };
+            const Uint32 actual = ((const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch))[x];
+            const Uint32 before = ((const Uint32 *)((const Uint8 *)ref->pixels + y * ref->pitch))[x];
+            Uint8 ar, ag, ab, aa, br, bg, bb, ba;
+
+            if (!SDL_PointInRect(&p, &fill) && !(y == line_y && x >= 2 && x <= 37)) {
+                continue;
+            }
+            SDL_GetRGBA(actual, dst->format, &ar, &ag, &ab, &aa);
+            SDL_GetRGBA(before, ref->format, &br, &bg, &bb, &ba);
+            if (!_checkPremultiplied(ar, 120, 96, br) || !_checkPremultiplied(ag, 60, 96, bg) ||
+                !_checkPremultiplied(ab, 200, 96, bb) || !_checkPremultiplied(aa, 96, 96, ba)) {
+                ++errors;
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify premultiplied drawing, expected: 0 differing pixels, got: %d", errors);
+
+    /* The copy matches a premultiplied surface blit */
+    errors = 0;
+    SDL_BlitSurface(src, NULL, ref, &dstrect);
+    for (y = copy.y; y < copy.y + copy.h; ++y) {
+        const Uint32 *actual = (const Uint32 *)((const Uint8 *)dst->pixels + y * dst->pitch);
+        const Uint32 *expected = (const Uint32 *)((const Uint8 *)ref->pixels + y * ref->pitch);
+
+        for (x = copy.x; x < copy.x + copy.w; ++x) {
+            if (actual[x] != expected[x]) {
+                ++errors;
+            }
+        }
+    }
+    SDLTest_AssertCheck(errors == 0, "Verify premultiplied copy, expected: 0 differing pixels, got: %d", errors);
+
+    if (t) {
+        SDL_DestroyTexture(t);
+    }
+    if (r) {
+        SDL_DestroyRenderer(r);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(ref);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Render test cases */
@@ -1161,9 +2614,62 @@ static const SDLTest_TestCaseReference renderTest7 = {
     (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED
 };
 
+static const SDLTest_TestCaseReference renderTest8 = {
+    (SDLTest_TestCaseFp)render_testReorderCommands, "render_testReorderCommands", "Tests that reordering batched commands gives identical output", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest9 = {
+    (SDLTest_TestCaseFp)render_testRenderStats, "render_testRenderStats", "Tests the per frame render statistics", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest10 = {
+    (SDLTest_TestCaseFp)render_testRenderCopyBatch, "render_testRenderCopyBatch", "Tests batched texture copies", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest11 = {
+    (SDLTest_TestCaseFp)render_testVertexBuffer, "render_testVertexBuffer", "Tests the vertex buffer reservation and shrinking", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest12 = {
+    (SDLTest_TestCaseFp)render_testSoftwareTiles, "render_testSoftwareTiles", "Tests that tile-parallel software rendering matches serial rendering", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest13 = {
+    (SDLTest_TestCaseFp)render_testRotateCache, "render_testRotateCache", "Tests the cache of rotated copies in the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest14 = {
+    (SDLTest_TestCaseFp)render_testGeometryFillRule, "render_testGeometryFillRule", "Tests that triangles sharing an edge neither overlap nor leave gaps", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest15 = {
+    (SDLTest_TestCaseFp)render_testDirtyRects, "render_testDirtyRects", "Tests that the software renderer presents only the changed parts of the window", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest16 = {
+    (SDLTest_TestCaseFp)render_testScaledLinearCopy, "render_testScaledLinearCopy", "Tests linear scaled, blended copies with the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest17 = {
+    (SDLTest_TestCaseFp)render_testPremultipliedBlend, "render_testPremultipliedBlend", "Tests the premultiplied alpha blend mode with the software renderer", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest18 = {
+    (SDLTest_TestCaseFp)render_testGeometryBlendSIMD, "render_testGeometryBlendSIMD", "Tests that vector blending of textured triangles matches the scalar code", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest19 = {
+    (SDLTest_TestCaseFp)render_testScaledLinearConvertedCopy, "render_testScaledLinearConvertedCopy", "Tests repeated linear scaled copies of a texture that is converted before scaling", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference renderTest20 = {
+    (SDLTest_TestCaseFp)render_testYUVCopy, "render_testYUVCopy", "Tests copies of YUV textures with the software renderer", TEST_ENABLED
+};
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] = {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, &renderTest9, &renderTest10,
+    &renderTest11, &renderTest12, &renderTest13, &renderTest14, &renderTest15, &renderTest16, &renderTest17, &renderTest18, &renderTest19, &renderTest20, NULL
 };
 
 /* Render test suite (global) */
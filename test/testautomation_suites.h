@@ -14,6 +14,9 @@ extern SDLTest_TestSuiteReference clipboardTestSuite;
 extern SDLTest_TestSuiteReference eventsTestSuite;
 extern SDLTest_TestSuiteReference guidTestSuite;
 extern SDLTest_TestSuiteReference hintsTestSuite;
+#ifdef SDL_TEST_INTERNALS
+extern SDLTest_TestSuiteReference jobsTestSuite;
+#endif
 extern SDLTest_TestSuiteReference joystickTestSuite;
 extern SDLTest_TestSuiteReference keyboardTestSuite;
 extern SDLTest_TestSuiteReference logTestSuite;
@@ -40,6 +43,9 @@ SDLTest_TestSuiteReference *testSuites[] = {
     &eventsTestSuite,
     &guidTestSuite,
     &hintsTestSuite,
+#ifdef SDL_TEST_INTERNALS
+    &jobsTestSuite,
+#endif
     &joystickTestSuite,
     &keyboardTestSuite,
     &logTestSuite,
@@ -36,6 +36,24 @@ static SDL_Surface *testSurface = NULL;
 #define TEST_SURFACE_WIDTH  testSurface->w
 #define TEST_SURFACE_HEIGHT testSurface->h
 
+/* Pseudo-random values that repeat for a given seed, so helpers called once
+   with and once without vector code fill their surfaces the same way */
+static Uint32 _nextRandom(Uint32 seed)
+{
+    return seed * 1103515245 + 12345;
+}
+
+/* Fills 'size' bytes with pseudo-random values */
+static void _fillRandomBytes(void *pixels, size_t size, Uint32 *seed)
+{
+    size_t i;
+
+    for (i = 0; i < size; ++i) {
+        *seed = _nextRandom(*seed);
+        ((Uint8 *)pixels)[i] = (Uint8)(*seed >> 16);
+    }
+}
+
 /* Fixture */
 
 /* Create a 32-bit writable surface for blitting tests */
@@ -798,6 +816,1362 @@ int surface_testOverflow(void *arg)
     return TEST_COMPLETED;
 }
 
+/* Helper that blends a noisy surface onto another one and returns a checksum of the result */
+static Uint32 _blitAlphaChecksum(const char *features, Uint32 srcformat, Uint32 dstformat, int mode)
+{
+    SDL_Surface *src, *dst;
+    SDL_Rect srcrect, dstrect;
+    Uint32 seed = 12345;
+    Uint32 crc = 0;
+    int i;
+
+    /* The override is read when a blit is set up, so every call needs new surfaces */
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", features, 1);
+    src = SDL_CreateRGBSurfaceWithFormat(0, 61, 13, 32, srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 15, 32, dstformat);
+    if (src && dst) {
+        for (i = 0; i < src->h * src->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            /* Some fully transparent and opaque pixels, and some that match the color key */
+            if ((i / 4) % 7 == 3) {
+                *(Uint32 *)((Uint8 *)src->pixels + i) = (seed & 0x100) ? src->format->Amask : 0x12345678;
+            } else {
+                *(Uint32 *)((Uint8 *)src->pixels + i) = seed ^ (seed << 11);
+            }
+        }
+        for (i = 0; i < dst->h * dst->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            *(Uint32 *)((Uint8 *)dst->pixels + i) = seed ^ (seed >> 9);
+        }
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+        if (mode > 0) {
+            SDL_SetSurfaceAlphaMod(src, 77);
+        }
+        if (mode > 1) {
+            SDL_SetColorKey(src, SDL_TRUE, 0x12345678);
+        }
+        /* Odd sizes and offsets, so rows don't start or end on a vector boundary */
+        srcrect.x = 1;
+        srcrect.y = 1;
+        srcrect.w = 59;
+        srcrect.h = 11;
+        dstrect.x = 3;
+        dstrect.y = 2;
+        SDL_BlitSurface(src, &srcrect, dst, &dstrect);
+        crc = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return crc;
+}
+
+/**
+ * @brief Tests that the vector alpha blitters give the same results as the scalar ones
+ */
+int surface_testBlitAlphaSIMD(void *arg)
+{
+    static const Uint32 alpha_formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const Uint32 opaque_formats[] = {
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_BGRX8888
+    };
+    static const char *mode_names[] = { "per-pixel alpha", "surface alpha", "colorkey and surface alpha" };
+    int i, j, mode;
+
+    for (mode = 0; mode < 3; ++mode) {
+        for (i = 0; i < (int)SDL_arraysize(alpha_formats); ++i) {
+            /* Per-pixel alpha needs an alpha channel in the source, the others ignore it */
+            const Uint32 srcformat = (mode == 0) ? alpha_formats[i] : opaque_formats[i];
+
+            for (j = 0; j < 2; ++j) {
+                const Uint32 dstformat = j ? opaque_formats[i] : alpha_formats[i];
+                const Uint32 scalar = _blitAlphaChecksum("0", srcformat, dstformat, mode);
+                const Uint32 simd = _blitAlphaChecksum("2", srcformat, dstformat, mode);
+
+                SDLTest_AssertCheck(scalar == simd, "Verify %s blit from %s to %s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                                    mode_names[mode], SDL_GetPixelFormatName(srcformat), SDL_GetPixelFormatName(dstformat), scalar, simd);
+            }
+        }
+    }
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", "3", 1);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that runs a noisy surface through the generated blitters and returns a checksum of the result */
+static Uint32 _blitAutoChecksum(const char *features, Uint32 srcformat, Uint32 dstformat,
+                                int modulate, SDL_BlendMode blendMode, SDL_bool scale)
+{
+    SDL_Surface *src, *dst;
+    SDL_Rect dstrect;
+    Uint32 seed = 54321;
+    Uint32 crc = 0;
+    int i;
+
+    /* The override is read when a blit is set up, so every call needs new surfaces */
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", features, 1);
+    src = SDL_CreateRGBSurfaceWithFormat(0, 61, 13, 32, srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 23, 32, dstformat);
+    if (src && dst) {
+        for (i = 0; i < src->h * src->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            /* Some fully transparent and opaque pixels */
+            if ((i / 4) % 7 == 3) {
+                *(Uint32 *)((Uint8 *)src->pixels + i) = (seed & 0x100) ? 0xFFFFFFFF : 0x00000000;
+            } else {
+                *(Uint32 *)((Uint8 *)src->pixels + i) = seed ^ (seed << 11);
+            }
+        }
+        for (i = 0; i < dst->h * dst->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            *(Uint32 *)((Uint8 *)dst->pixels + i) = seed ^ (seed >> 9);
+        }
+        SDL_SetSurfaceBlendMode(src, blendMode);
+        if (modulate & 1) {
+            SDL_SetSurfaceColorMod(src, 255, 130, 17);
+        }
+        if (modulate & 2) {
+            SDL_SetSurfaceAlphaMod(src, 77);
+        }
+        /* Odd sizes and offsets, so rows don't start or end on a vector boundary */
+        dstrect.x = 3;
+        dstrect.y = 2;
+        if (scale) {
+            dstrect.w = 45;
+            dstrect.h = 19;
+            SDL_BlitScaled(src, NULL, dst, &dstrect);
+        } else {
+            SDL_BlitSurface(src, NULL, dst, &dstrect);
+        }
+        crc = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return crc;
+}
+
+/**
+ * @brief Tests that the vector versions of the generated blitters give the same results as the scalar ones
+ */
+int surface_testBlitAutoSIMD(void *arg)
+{
+    /* The formats sdlgenblit.pl creates blitters for */
+    static const Uint32 src_formats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const Uint32 dst_formats[] = {
+        SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888, SDL_PIXELFORMAT_ARGB8888
+    };
+    static const SDL_BlendMode blend_modes[] = {
+        SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD, SDL_BLENDMODE_MUL
+    };
+    int i, j, k, modulate, scale;
+
+    for (i = 0; i < (int)SDL_arraysize(src_formats); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(dst_formats); ++j) {
+            for (k = 0; k < (int)SDL_arraysize(blend_modes); ++k) {
+                for (modulate = 0; modulate < 4; ++modulate) {
+                    for (scale = 0; scale < 2; ++scale) {
+                        const Uint32 scalar = _blitAutoChecksum("0", src_formats[i], dst_formats[j], modulate, blend_modes[k], scale);
+                        const Uint32 simd = _blitAutoChecksum("65535", src_formats[i], dst_formats[j], modulate, blend_modes[k], scale);
+
+                        SDLTest_AssertCheck(scalar == simd, "Verify blit from %s to %s, blend mode %d, modulation %d%s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                                            SDL_GetPixelFormatName(src_formats[i]), SDL_GetPixelFormatName(dst_formats[j]),
+                                            blend_modes[k], modulate, scale ? ", scaled" : "", scalar, simd);
+                    }
+                }
+            }
+        }
+    }
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that runs one large operation, with or without banding, and returns a checksum of the result */
+static Uint32 _blitThreadsChecksum(const char *threads, int operation)
+{
+    /* Odd sizes, above the size where operations are split into bands */
+    const int w = 701, h = 503;
+    const int yuv_pitch = 4 * ((w + 1) / 2);
+    /* Big enough for the planar formats and YUY2 */
+    const int yuv_size = yuv_pitch * h;
+    SDL_Surface *src, *dst, *small;
+    Uint8 *yuv;
+    SDL_Rect rect;
+    Uint32 seed = 24680;
+    Uint32 crc = 0;
+    int i;
+
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, threads);
+    src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    small = SDL_CreateRGBSurfaceWithFormat(0, 123, 77, 32, SDL_PIXELFORMAT_ARGB8888);
+    yuv = (Uint8 *)SDL_malloc(yuv_size);
+    if (src && dst && small && yuv) {
+        for (i = 0; i < src->h * src->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            *(Uint32 *)((Uint8 *)src->pixels + i) = seed ^ (seed << 11);
+            *(Uint32 *)((Uint8 *)dst->pixels + i) = seed ^ (seed >> 9);
+        }
+        for (i = 0; i < small->h * small->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            *(Uint32 *)((Uint8 *)small->pixels + i) = seed;
+        }
+        _fillRandomBytes(yuv, yuv_size, &seed);
+
+        switch (operation) {
+        case 0:
+            SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+            SDL_SetSurfaceColorMod(src, 200, 100, 50);
+            SDL_BlitSurface(src, NULL, dst, NULL);
+            break;
+        case 1:
+            rect.x = 5;
+            rect.y = 3;
+            rect.w = w - 11;
+            rect.h = h - 7;
+            SDL_FillRect(dst, &rect, 0x12345678);
+            break;
+        case 2:
+            SDL_SoftStretch(small, NULL, dst, NULL);
+            break;
+        case 3:
+            SDL_SoftStretchLinear(small, NULL, dst, NULL);
+            break;
+        case 4:
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_ARGB8888, src->pixels, src->pitch,
+                              SDL_PIXELFORMAT_BGR24, dst->pixels, dst->pitch);
+            break;
+        case 5:
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_NV12, yuv, w,
+                              SDL_PIXELFORMAT_ARGB8888, dst->pixels, dst->pitch);
+            break;
+        case 6:
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_IYUV, yuv, w,
+                              SDL_PIXELFORMAT_RGB24, dst->pixels, dst->pitch);
+            break;
+        case 7:
+            SDL_ConvertPixels(w, h, SDL_PIXELFORMAT_YUY2, yuv, yuv_pitch,
+                              SDL_PIXELFORMAT_RGB565, dst->pixels, dst->pitch);
+            break;
+        }
+        crc = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(small);
+    SDL_free(yuv);
+    return crc;
+}
+
+/**
+ * @brief Tests that blits, fills, stretches and conversions split into bands give the same results as serial ones
+ */
+int surface_testBlitThreads(void *arg)
+{
+    static const char *operation_names[] = {
+        "blended blit", "fill", "nearest stretch", "linear stretch",
+        "ARGB8888 to BGR24 conversion", "NV12 to ARGB8888 conversion", "IYUV to RGB24 conversion",
+        "YUY2 to RGB565 conversion"
+    };
+    int i;
+
+    for (i = 0; i < (int)SDL_arraysize(operation_names); ++i) {
+        const Uint32 serial = _blitThreadsChecksum("0", i);
+        const Uint32 banded = _blitThreadsChecksum("1", i);
+
+        SDLTest_AssertCheck(serial == banded, "Verify %s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                            operation_names[i], serial, banded);
+    }
+    SDL_ResetHint(SDL_HINT_BLIT_THREADS);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that copies a noisy surface between two 32-bit formats and returns a checksum of the result */
+static Uint32 _blitShuffleChecksum(const char *features, Uint32 srcformat, Uint32 dstformat, int width)
+{
+    SDL_Surface *src, *dst;
+    SDL_Rect srcrect, dstrect;
+    Uint32 seed = 97531;
+    Uint32 crc = 0;
+    int i, x, y;
+
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", features, 1);
+    src = SDL_CreateRGBSurfaceWithFormat(0, 61, 13, 32, srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 23, 32, dstformat);
+    if (src && dst) {
+        for (i = 0; i < src->h * src->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            *(Uint32 *)((Uint8 *)src->pixels + i) = seed ^ (seed << 11);
+        }
+        SDL_memset(dst->pixels, 0x5A, (size_t)dst->h * dst->pitch);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+        /* Odd sizes and offsets, so rows don't start or end on a vector boundary */
+        srcrect.x = 1;
+        srcrect.y = 1;
+        srcrect.w = width;
+        srcrect.h = 11;
+        dstrect.x = 3;
+        dstrect.y = 2;
+        SDL_BlitSurface(src, &srcrect, dst, &dstrect);
+        crc = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+
+        /* The channels must survive the trip, and a missing alpha channel becomes opaque */
+        for (y = 0; y < srcrect.h; ++y) {
+            for (x = 0; x < srcrect.w; ++x) {
+                const Uint32 s = *(Uint32 *)((Uint8 *)src->pixels + (srcrect.y + y) * src->pitch + (srcrect.x + x) * 4);
+                const Uint32 d = *(Uint32 *)((Uint8 *)dst->pixels + (dstrect.y + y) * dst->pitch + (dstrect.x + x) * 4);
+                Uint8 sr, sg, sb, sa, dr, dg, db, da;
+
+                SDL_GetRGBA(s, src->format, &sr, &sg, &sb, &sa);
+                SDL_GetRGBA(d, dst->format, &dr, &dg, &db, &da);
+                if (sr != dr || sg != dg || sb != db || (dst->format->Amask && sa != da)) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Verify pixel %d,%d from %s to %s, expected: %02x%02x%02x%02x, got: %02x%02x%02x%02x",
+                                        x, y, SDL_GetPixelFormatName(srcformat), SDL_GetPixelFormatName(dstformat),
+                                        sr, sg, sb, sa, dr, dg, db, da);
+                    x = srcrect.w;
+                    y = srcrect.h;
+                }
+            }
+        }
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return crc;
+}
+
+/**
+ * @brief Tests copies between every pair of 32-bit formats with 8-bit channels
+ */
+int surface_testBlitShuffle(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888,
+        SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_RGBX8888, SDL_PIXELFORMAT_XBGR8888, SDL_PIXELFORMAT_BGRX8888
+    };
+    /* Narrower than one vector, and a few vectors with some left over */
+    static const int widths[] = { 3, 57 };
+    int i, j, k;
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(formats); ++j) {
+            for (k = 0; k < (int)SDL_arraysize(widths); ++k) {
+                const Uint32 scalar = _blitShuffleChecksum("0", formats[i], formats[j], widths[k]);
+                const Uint32 simd = _blitShuffleChecksum("65535", formats[i], formats[j], widths[k]);
+
+                SDLTest_AssertCheck(scalar == simd, "Verify %d pixel wide blit from %s to %s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                                    widths[k], SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), scalar, simd);
+            }
+        }
+    }
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that blends a noisy premultiplied surface onto another one, checks every pixel and returns a checksum of the result */
+static Uint32 _blitPremultipliedChecksum(const char *features, Uint32 srcformat, Uint32 dstformat)
+{
+    SDL_Surface *src, *dst, *expected;
+    SDL_Rect srcrect, dstrect;
+    Uint32 seed = 24680;
+    Uint32 crc = 0;
+    int i, x, y;
+
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", features, 1);
+    src = SDL_CreateRGBSurfaceWithFormat(0, 61, 13, 32, srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, 67, 15, 0, dstformat);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, 67, 15, 0, dstformat);
+    if (src && dst && expected) {
+        for (i = 0; i < src->h * src->pitch; i += 4) {
+            seed = _nextRandom(seed);
+            /* Not all of these are valid premultiplied colors, so the sums saturate */
+            *(Uint32 *)((Uint8 *)src->pixels + i) = seed ^ (seed << 11);
+        }
+        _fillRandomBytes(dst->pixels, (size_t)dst->h * dst->pitch, &seed);
+        SDL_memcpy(expected->pixels, dst->pixels, (size_t)dst->h * dst->pitch);
+        SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+        /* Odd sizes and offsets, so rows don't start or end on a vector boundary */
+        srcrect.x = 1;
+        srcrect.y = 1;
+        srcrect.w = 59;
+        srcrect.h = 11;
+        dstrect.x = 3;
+        dstrect.y = 2;
+        SDL_BlitSurface(src, &srcrect, dst, &dstrect);
+        crc = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+
+        /* dstRGBA = srcRGBA + dstRGBA * (1 - srcA) */
+        for (y = 0; y < srcrect.h; ++y) {
+            for (x = 0; x < srcrect.w; ++x) {
+                const Uint32 s = *(Uint32 *)((Uint8 *)src->pixels + (srcrect.y + y) * src->pitch + (srcrect.x + x) * 4);
+                Uint8 *e = (Uint8 *)expected->pixels + (dstrect.y + y) * expected->pitch + (dstrect.x + x) * expected->format->BytesPerPixel;
+                Uint8 *d = (Uint8 *)dst->pixels + (dstrect.y + y) * dst->pitch + (dstrect.x + x) * dst->format->BytesPerPixel;
+                Uint32 pixel = 0;
+                Uint8 sr, sg, sb, sa, er, eg, eb, ea;
+                unsigned r, g, b, a;
+
+                SDL_GetRGBA(s, src->format, &sr, &sg, &sb, &sa);
+                SDL_memcpy(&pixel, e, expected->format->BytesPerPixel);
+                SDL_GetRGBA(pixel, expected->format, &er, &eg, &eb, &ea);
+                r = SDL_min(sr + er * (255 - sa) / 255, 255);
+                g = SDL_min(sg + eg * (255 - sa) / 255, 255);
+                b = SDL_min(sb + eb * (255 - sa) / 255, 255);
+                a = sa + ea * (255 - sa) / 255;
+                pixel = SDL_MapRGBA(expected->format, (Uint8)r, (Uint8)g, (Uint8)b, (Uint8)a);
+                SDL_memcpy(e, &pixel, expected->format->BytesPerPixel);
+                if (SDL_memcmp(e, d, expected->format->BytesPerPixel) != 0) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Verify pixel %d,%d from %s to %s with features %s",
+                                        x, y, SDL_GetPixelFormatName(srcformat), SDL_GetPixelFormatName(dstformat), features);
+                    x = srcrect.w;
+                    y = srcrect.h;
+                }
+            }
+        }
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(expected);
+    return crc;
+}
+
+/**
+ * @brief Tests the premultiplied alpha blend mode and premultiplying surfaces
+ */
+int surface_testBlitPremultiplied(void *arg)
+{
+    static const Uint32 srcformats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888
+    };
+    static const Uint32 dstformats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB4444, SDL_PIXELFORMAT_RGB24
+    };
+    static const Uint32 premultiply_formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888, SDL_PIXELFORMAT_BGRA8888, SDL_PIXELFORMAT_ARGB4444
+    };
+    SDL_Surface *surface, *dst;
+    SDL_BlendMode blendMode;
+    int ret, i, j, x, y;
+
+    /* The blend mode is kept by the surface */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 4, 4, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    ret = SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_BLEND_PREMULTIPLIED);
+    SDLTest_AssertCheck(ret == 0, "Verify result from SDL_SetSurfaceBlendMode, expected: 0, got: %i", ret);
+    ret = SDL_GetSurfaceBlendMode(surface, &blendMode);
+    SDLTest_AssertCheck(ret == 0 && blendMode == SDL_BLENDMODE_BLEND_PREMULTIPLIED,
+                        "Verify SDL_GetSurfaceBlendMode, expected: %i, got: %i", SDL_BLENDMODE_BLEND_PREMULTIPLIED, blendMode);
+    SDL_FreeSurface(surface);
+
+    /* The blits match the formula, with and without the vector blitters */
+    for (i = 0; i < (int)SDL_arraysize(srcformats); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(dstformats); ++j) {
+            const Uint32 scalar = _blitPremultipliedChecksum("0", srcformats[i], dstformats[j]);
+            const Uint32 simd = _blitPremultipliedChecksum("3", srcformats[i], dstformats[j]);
+
+            SDLTest_AssertCheck(scalar == simd, "Verify premultiplied blit from %s to %s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                                SDL_GetPixelFormatName(srcformats[i]), SDL_GetPixelFormatName(dstformats[j]), scalar, simd);
+        }
+    }
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", "3", 1);
+
+    /* Premultiplying works for formats other than ARGB8888 */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 19, 5, 32, SDL_PIXELFORMAT_ABGR8888);
+    SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+    if (!surface) {
+        return TEST_ABORTED;
+    }
+    for (i = 0; i < surface->h * surface->pitch; ++i) {
+        ((Uint8 *)surface->pixels)[i] = (Uint8)(i * 37 + (i >> 3));
+    }
+    for (i = 0; i < (int)SDL_arraysize(premultiply_formats); ++i) {
+        dst = SDL_CreateRGBSurfaceWithFormat(0, surface->w, surface->h, 0, premultiply_formats[i]);
+        SDLTest_AssertCheck(dst != NULL, "Verify surface is not NULL");
+        if (!dst) {
+            continue;
+        }
+        ret = SDL_PremultiplyAlpha(surface->w, surface->h, surface->format->format, surface->pixels, surface->pitch,
+                                   dst->format->format, dst->pixels, dst->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplyAlpha to %s, expected: 0, got: %i",
+                            SDL_GetPixelFormatName(premultiply_formats[i]), ret);
+        for (y = 0; y < surface->h; ++y) {
+            for (x = 0; x < surface->w; ++x) {
+                const Uint32 s = *(Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch + x * 4);
+                Uint32 d = 0, e;
+                Uint8 r, g, b, a;
+
+                /* The channels are premultiplied before they lose any precision */
+                SDL_GetRGBA(s, surface->format, &r, &g, &b, &a);
+                e = SDL_MapRGBA(dst->format, (Uint8)(r * a / 255), (Uint8)(g * a / 255), (Uint8)(b * a / 255), a);
+                SDL_memcpy(&d, (Uint8 *)dst->pixels + y * dst->pitch + x * dst->format->BytesPerPixel, dst->format->BytesPerPixel);
+                if (d != e) {
+                    SDLTest_AssertCheck(SDL_FALSE, "Verify premultiplied pixel %d,%d in %s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                                        x, y, SDL_GetPixelFormatName(premultiply_formats[i]), e, d);
+                    x = surface->w;
+                    y = surface->h;
+                }
+            }
+        }
+        SDL_FreeSurface(dst);
+    }
+
+    /* Premultiplying a surface in place gives the same pixels */
+    dst = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ABGR8888, 0);
+    SDLTest_AssertCheck(dst != NULL, "Verify converted surface is not NULL");
+    if (dst) {
+        ret = SDL_PremultiplySurfaceAlpha(dst);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplySurfaceAlpha, expected: 0, got: %i", ret);
+        ret = SDL_PremultiplyAlpha(surface->w, surface->h, surface->format->format, surface->pixels, surface->pitch,
+                                   surface->format->format, surface->pixels, surface->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify result from SDL_PremultiplyAlpha in place, expected: 0, got: %i", ret);
+        ret = SDL_memcmp(surface->pixels, dst->pixels, (size_t)surface->h * surface->pitch);
+        SDLTest_AssertCheck(ret == 0, "Verify SDL_PremultiplySurfaceAlpha matches SDL_PremultiplyAlpha");
+        SDL_FreeSurface(dst);
+    }
+    SDL_FreeSurface(surface);
+
+    ret = SDL_PremultiplySurfaceAlpha(NULL);
+    SDLTest_AssertCheck(ret == -1, "Verify result from SDL_PremultiplySurfaceAlpha(NULL), expected: -1, got: %i", ret);
+
+    return TEST_COMPLETED;
+}
+
+/* Blits 'sprite' to 'dst', and a copy of 'sprite' that was never blitted before to a copy of 'dst' */
+static int _blitWithFreshCopy(SDL_Surface *sprite, SDL_Surface *dst)
+{
+    SDL_Surface *copy, *expected;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    int ret = -1;
+
+    copy = SDL_CreateRGBSurfaceWithFormat(0, sprite->w, sprite->h, 0, sprite->format->format);
+    expected = SDL_CreateRGBSurfaceWithFormat(0, dst->w, dst->h, 0, dst->format->format);
+    if (copy && expected) {
+        if (sprite->format->palette) {
+            SDL_SetPaletteColors(copy->format->palette, sprite->format->palette->colors, 0, sprite->format->palette->ncolors);
+        }
+        SDL_memcpy(copy->pixels, sprite->pixels, (size_t)sprite->h * sprite->pitch);
+        if (dst->format->palette) {
+            SDL_SetPaletteColors(expected->format->palette, dst->format->palette->colors, 0, dst->format->palette->ncolors);
+        }
+        SDL_memcpy(expected->pixels, dst->pixels, (size_t)dst->h * dst->pitch);
+        SDL_GetSurfaceColorMod(sprite, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(sprite, &a);
+        SDL_GetSurfaceBlendMode(sprite, &blendMode);
+        SDL_SetSurfaceColorMod(copy, r, g, b);
+        SDL_SetSurfaceAlphaMod(copy, a);
+        SDL_SetSurfaceBlendMode(copy, blendMode);
+
+        SDL_BlitSurface(copy, NULL, expected, NULL);
+        SDL_BlitSurface(sprite, NULL, dst, NULL);
+        ret = SDL_memcmp(dst->pixels, expected->pixels, (size_t)dst->h * dst->pitch);
+    }
+    SDL_FreeSurface(copy);
+    SDL_FreeSurface(expected);
+    return ret;
+}
+
+/* Blits every sprite to every destination in turn, and checks each against a fresh copy */
+static void _blitToEach(SDL_Surface **sprites, int num_sprites, SDL_Surface **dsts, int num_dsts, const char *step)
+{
+    int ret, i, j;
+
+    for (i = 0; i < num_sprites; ++i) {
+        for (j = 0; j < num_dsts; ++j) {
+            ret = _blitWithFreshCopy(sprites[i], dsts[j]);
+            SDLTest_AssertCheck(ret == 0, "Verify blit from %s to %s %s matches a new surface, expected: 0, got: %i",
+                                SDL_GetPixelFormatName(sprites[i]->format->format),
+                                SDL_GetPixelFormatName(dsts[j]->format->format), step, ret);
+        }
+    }
+}
+
+static void _setSpriteModulation(SDL_Surface **sprites, int num_sprites, Uint8 r, Uint8 g, Uint8 b, Uint8 a, SDL_BlendMode blendMode)
+{
+    int i;
+
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_SetSurfaceColorMod(sprites[i], r, g, b);
+        SDL_SetSurfaceAlphaMod(sprites[i], a);
+        SDL_SetSurfaceBlendMode(sprites[i], blendMode);
+    }
+}
+
+static void _randomizePalette(SDL_Palette *palette, Uint32 *seed)
+{
+    SDL_Color colors[256];
+    int i;
+
+    for (i = 0; i < palette->ncolors; ++i) {
+        *seed = _nextRandom(*seed);
+        colors[i].r = (Uint8)(*seed >> 24);
+        colors[i].g = (Uint8)(*seed >> 16);
+        colors[i].b = (Uint8)(*seed >> 8);
+        colors[i].a = (Uint8)*seed;
+    }
+    SDL_SetPaletteColors(palette, colors, 0, palette->ncolors);
+}
+
+/**
+ * @brief Tests that blits set up for one destination or modulation are reused correctly when switching back
+ */
+int surface_testBlitMapCache(void *arg)
+{
+    static const Uint32 spriteformats[] = {
+        SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888
+    };
+    static const Uint32 dstformats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_INDEX8
+    };
+    const int num_sprites = (int)SDL_arraysize(spriteformats);
+    const int num_dsts = (int)SDL_arraysize(dstformats);
+    SDL_Surface *sprites[SDL_arraysize(spriteformats)];
+    SDL_Surface *dsts[SDL_arraysize(dstformats)];
+    Uint32 seed = 97531;
+    int i;
+
+    for (i = 0; i < num_sprites; ++i) {
+        sprites[i] = SDL_CreateRGBSurfaceWithFormat(0, 13, 11, 0, spriteformats[i]);
+        SDLTest_AssertCheck(sprites[i] != NULL, "Verify sprite is not NULL");
+        if (!sprites[i]) {
+            return TEST_ABORTED;
+        }
+        _fillRandomBytes(sprites[i]->pixels, (size_t)sprites[i]->h * sprites[i]->pitch, &seed);
+    }
+    _randomizePalette(sprites[0]->format->palette, &seed);
+    for (i = 0; i < num_dsts; ++i) {
+        dsts[i] = SDL_CreateRGBSurfaceWithFormat(0, 17, 15, 0, dstformats[i]);
+        SDLTest_AssertCheck(dsts[i] != NULL, "Verify destination is not NULL");
+        if (!dsts[i]) {
+            return TEST_ABORTED;
+        }
+    }
+    _randomizePalette(dsts[num_dsts - 1]->format->palette, &seed);
+
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "first");
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "again");
+
+    /* The modulation changes, and then only its values */
+    _setSpriteModulation(sprites, num_sprites, 0x80, 0xFF, 0x40, 0xFF, SDL_BLENDMODE_NONE);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "with color modulation");
+    _setSpriteModulation(sprites, num_sprites, 0x40, 0xC0, 0xFF, 0xFF, SDL_BLENDMODE_NONE);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "with other color modulation");
+    _setSpriteModulation(sprites, num_sprites, 0xFF, 0xFF, 0xFF, 0x60, SDL_BLENDMODE_BLEND);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "blended");
+    _setSpriteModulation(sprites, num_sprites, 0xFF, 0xFF, 0xFF, 0xA0, SDL_BLENDMODE_BLEND);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "blended with other alpha");
+    _setSpriteModulation(sprites, num_sprites, 0xFF, 0xFF, 0xFF, 0xFF, SDL_BLENDMODE_NONE);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "without modulation");
+
+    /* The palettes change */
+    _randomizePalette(sprites[0]->format->palette, &seed);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "after changing the source palette");
+    _randomizePalette(dsts[num_dsts - 1]->format->palette, &seed);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "after changing the destination palette");
+
+    /* New destinations, which may get the formats and addresses of the old ones */
+    for (i = 0; i < num_dsts; ++i) {
+        SDL_FreeSurface(dsts[i]);
+        dsts[i] = SDL_CreateRGBSurfaceWithFormat(0, 17, 15, 0, dstformats[i]);
+        SDLTest_AssertCheck(dsts[i] != NULL, "Verify destination is not NULL");
+        if (!dsts[i]) {
+            return TEST_ABORTED;
+        }
+    }
+    _randomizePalette(dsts[num_dsts - 1]->format->palette, &seed);
+    _blitToEach(sprites, num_sprites, dsts, num_dsts, "after replacing the destinations");
+
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_FreeSurface(sprites[i]);
+    }
+    for (i = 0; i < num_dsts; ++i) {
+        SDL_FreeSurface(dsts[i]);
+    }
+    return TEST_COMPLETED;
+}
+
+/* Helper that blits a noisy surface over a whole other one and returns a checksum of the visible pixels */
+static Uint32 _blitPitchChecksum(Uint32 flags, SDL_bool simd, Uint32 srcformat, Uint32 dstformat,
+                                 SDL_BlendMode blendMode, SDL_bool modulate)
+{
+    SDL_Surface *src, *dst;
+    Uint32 seed = 24680;
+    Uint32 crc = 0;
+    int x, y;
+
+    /* The overrides are read when a blit is set up, so every call needs new surfaces */
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", simd ? "2" : "0", 1);
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", simd ? "65535" : "0", 1);
+    src = SDL_CreateRGBSurfaceWithFormat(flags, 67, 9, 32, srcformat);
+    dst = SDL_CreateRGBSurfaceWithFormat(flags, 67, 9, 32, dstformat);
+    if (src && dst) {
+        /* The same pixels whatever the pitch */
+        for (y = 0; y < src->h; ++y) {
+            for (x = 0; x < src->w; ++x) {
+                seed = _nextRandom(seed);
+                *(Uint32 *)((Uint8 *)src->pixels + y * src->pitch + x * 4) = seed ^ (seed << 11);
+                seed = _nextRandom(seed);
+                *(Uint32 *)((Uint8 *)dst->pixels + y * dst->pitch + x * 4) = seed ^ (seed >> 9);
+            }
+        }
+        SDL_SetSurfaceBlendMode(src, blendMode);
+        if (modulate) {
+            SDL_SetSurfaceColorMod(src, 255, 130, 17);
+            SDL_SetSurfaceAlphaMod(src, 77);
+        }
+        /* Whole rows, so they start where the surface rows do */
+        SDL_BlitSurface(src, NULL, dst, NULL);
+        for (y = 0; y < dst->h; ++y) {
+            crc = SDL_crc32(crc, (Uint8 *)dst->pixels + y * dst->pitch, (size_t)dst->w * 4);
+        }
+    }
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    return crc;
+}
+
+/**
+ * @brief Tests surfaces with SIMD aligned rows, and that blits between them match the scalar ones
+ */
+int surface_testSIMDPitch(void *arg)
+{
+    static const struct
+    {
+        Uint32 srcformat;
+        Uint32 dstformat;
+        SDL_BlendMode blendMode;
+        SDL_bool modulate;
+    } blits[] = {
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_BLEND, SDL_FALSE },
+        { SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_XBGR8888, SDL_BLENDMODE_BLEND, SDL_FALSE },
+        { SDL_PIXELFORMAT_XRGB8888, SDL_PIXELFORMAT_XRGB8888, SDL_BLENDMODE_BLEND, SDL_TRUE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_BLENDMODE_NONE, SDL_FALSE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_XBGR8888, SDL_BLENDMODE_BLEND, SDL_TRUE },
+        { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888, SDL_BLENDMODE_ADD, SDL_FALSE }
+    };
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_INDEX1MSB, SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888
+    };
+    const size_t alignment = SDL_SIMDGetAlignment();
+    SDL_Surface *surface, *copy;
+    int i, w;
+
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        for (w = 1; w < 100; w += 33) {
+            surface = SDL_CreateRGBSurfaceWithFormat(SDL_SIMD_PITCH, w, 3, 0, formats[i]);
+            SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+            if (!surface) {
+                return TEST_ABORTED;
+            }
+            SDLTest_AssertCheck((surface->flags & SDL_SIMD_PITCH) != 0, "Verify SDL_SIMD_PITCH is set");
+            SDLTest_AssertCheck(surface->pitch % alignment == 0 && ((uintptr_t)surface->pixels % alignment) == 0,
+                                "Verify %d pixel wide %s rows are aligned to %d bytes, got pitch %d",
+                                w, SDL_GetPixelFormatName(formats[i]), (int)alignment, surface->pitch);
+            SDLTest_AssertCheck(surface->pitch >= (w * SDL_BITSPERPIXEL(formats[i]) + 7) / 8 &&
+                                surface->pitch < (w * SDL_BITSPERPIXEL(formats[i]) + 7) / 8 + (int)alignment,
+                                "Verify the pitch is padded by less than the alignment, got %d", surface->pitch);
+
+            /* Copies keep the layout, indexed ones would need a palette first */
+            if (!SDL_ISPIXELFORMAT_INDEXED(formats[i])) {
+                copy = SDL_DuplicateSurface(surface);
+                SDLTest_AssertCheck(copy && (copy->flags & SDL_SIMD_PITCH) && copy->pitch == surface->pitch,
+                                    "Verify a duplicate has the same pitch");
+                SDL_FreeSurface(copy);
+            }
+            SDL_FreeSurface(surface);
+        }
+    }
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, 3, 3, 0, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(surface && !(surface->flags & SDL_SIMD_PITCH) && surface->pitch == 12,
+                        "Verify surfaces are still packed without SDL_SIMD_PITCH");
+    SDL_FreeSurface(surface);
+
+    for (i = 0; i < (int)SDL_arraysize(blits); ++i) {
+        const Uint32 scalar = _blitPitchChecksum(0, SDL_FALSE, blits[i].srcformat, blits[i].dstformat, blits[i].blendMode, blits[i].modulate);
+        const Uint32 simd = _blitPitchChecksum(SDL_SIMD_PITCH, SDL_TRUE, blits[i].srcformat, blits[i].dstformat, blits[i].blendMode, blits[i].modulate);
+
+        SDLTest_AssertCheck(scalar == simd, "Verify aligned blit from %s to %s, blend mode %d%s, expected: %08" SDL_PRIx32 ", got: %08" SDL_PRIx32,
+                            SDL_GetPixelFormatName(blits[i].srcformat), SDL_GetPixelFormatName(blits[i].dstformat),
+                            blits[i].blendMode, blits[i].modulate ? ", modulated" : "", scalar, simd);
+    }
+    SDL_setenv("SDL_ALPHA_BLIT_FEATURES", "3", 1);
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that stretches 'src' with bilinear filtering, or area averaging if SDL_HINT_STRETCH_AREA_AVERAGE allows it, into a new surface */
+static SDL_Surface *_stretchLinear(const char *features, SDL_Surface *src, int w, int h)
+{
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, src->format->format);
+
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", features, 1);
+    if (dst) {
+        SDL_memset(dst->pixels, 0x5A, (size_t)dst->h * dst->pitch);
+        if (SDL_SoftStretchLinear(src, NULL, dst, NULL) < 0) {
+            SDLTest_AssertCheck(SDL_FALSE, "Verify SDL_SoftStretchLinear() of %s, got: %s",
+                                SDL_GetPixelFormatName(src->format->format), SDL_GetError());
+            SDL_FreeSurface(dst);
+            dst = NULL;
+        }
+    }
+    return dst;
+}
+
+/* Helper that returns the largest difference between two surfaces of the same size, in units of the channels of 'format' or 'expanded' to 8 bits */
+static int _stretchDifference(SDL_Surface *a, SDL_Surface *b, SDL_bool expanded)
+{
+    const Uint32 masks[] = { a->format->Rmask, a->format->Gmask, a->format->Bmask, a->format->Amask };
+    int max_diff = 0;
+    int x, y, c;
+
+    for (y = 0; y < a->h; ++y) {
+        for (x = 0; x < a->w; ++x) {
+            const Uint8 *pa = (const Uint8 *)a->pixels + y * a->pitch + x * a->format->BytesPerPixel;
+            const Uint8 *pb = (const Uint8 *)b->pixels + y * b->pitch + x * b->format->BytesPerPixel;
+            const Uint32 va = a->format->BytesPerPixel == 4 ? *(const Uint32 *)pa : *(const Uint16 *)pa;
+            const Uint32 vb = b->format->BytesPerPixel == 4 ? *(const Uint32 *)pb : *(const Uint16 *)pb;
+
+            if (expanded) {
+                Uint8 ca[4], cb[4];
+
+                SDL_GetRGBA(va, a->format, &ca[0], &ca[1], &ca[2], &ca[3]);
+                SDL_GetRGBA(vb, b->format, &cb[0], &cb[1], &cb[2], &cb[3]);
+                for (c = 0; c < 4; ++c) {
+                    max_diff = SDL_max(max_diff, SDL_abs(ca[c] - cb[c]));
+                }
+            } else {
+                for (c = 0; c < 4; ++c) {
+                    max_diff = SDL_max(max_diff, SDL_abs((int)(va & masks[c]) - (int)(vb & masks[c])) / (int)((masks[c] & (~masks[c] + 1)) | !masks[c]));
+                }
+            }
+        }
+    }
+    return max_diff;
+}
+
+/**
+ * @brief Tests filtered stretches: vector against scalar, 16-bit against 32-bit, and area averaging against a box filter
+ */
+int surface_testStretchLinear(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_ARGB4444, SDL_PIXELFORMAT_ARGB1555
+    };
+    static const struct
+    {
+        int src_w, src_h, dst_w, dst_h;
+        SDL_bool area;
+    } sizes[] = {
+        { 61, 13, 97, 23, SDL_FALSE }, /* Magnified, with odd sizes so rows don't end on a vector boundary */
+        { 61, 13, 37, 9, SDL_TRUE },   /* Reduced less than twice, still bilinear with the hint */
+        { 1, 7, 5, 9, SDL_FALSE },     /* A single column, without a right neighbor to read */
+        { 97, 53, 13, 7, SDL_FALSE },  /* Reduced more than twice, bilinear by default */
+        { 97, 53, 13, 7, SDL_TRUE },   /* Reduced more than twice, averaged with the hint */
+    };
+    SDL_Surface *src, *scalar, *simd, *gradient, *gradient16;
+    Uint32 seed = 13579;
+    int i, j, x, y, c;
+
+    /* The vector filters keep more precision between the two passes than the scalar ones */
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        for (j = 0; j < (int)SDL_arraysize(sizes); ++j) {
+            const SDL_bool area = sizes[j].area && sizes[j].src_w > 2 * sizes[j].dst_w;
+            int diff;
+
+            SDL_SetHint(SDL_HINT_STRETCH_AREA_AVERAGE, sizes[j].area ? "1" : "0");
+
+            src = SDL_CreateRGBSurfaceWithFormat(0, sizes[j].src_w, sizes[j].src_h, 0, formats[i]);
+            SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+            if (!src) {
+                continue;
+            }
+            _fillRandomBytes(src->pixels, (size_t)src->h * src->pitch, &seed);
+            scalar = _stretchLinear("0", src, sizes[j].dst_w, sizes[j].dst_h);
+            simd = _stretchLinear("65535", src, sizes[j].dst_w, sizes[j].dst_h);
+            if (scalar && simd) {
+                diff = _stretchDifference(scalar, simd, SDL_FALSE);
+                SDLTest_AssertCheck(diff <= (area ? 0 : 1), "Verify %dx%d to %dx%d %s stretch, expected difference: <= %d, got: %d",
+                                    sizes[j].src_w, sizes[j].src_h, sizes[j].dst_w, sizes[j].dst_h,
+                                    SDL_GetPixelFormatName(formats[i]), area ? 0 : 1, diff);
+            }
+
+            /* Each averaged pixel is the rounded mean of the source pixels it covers, bilinear ones aren't */
+            if (sizes[j].src_w > 2 * sizes[j].dst_w && scalar && formats[i] == SDL_PIXELFORMAT_ARGB8888) {
+                int errors = 0;
+
+                for (y = 0; y < scalar->h; ++y) {
+                    const int y0 = y * src->h / scalar->h, y1 = (y + 1) * src->h / scalar->h;
+
+                    for (x = 0; x < scalar->w; ++x) {
+                        const int x0 = x * src->w / scalar->w, x1 = (x + 1) * src->w / scalar->w;
+                        const int count = (x1 - x0) * (y1 - y0);
+
+                        for (c = 0; c < 4; ++c) {
+                            int sum = count / 2, sx, sy;
+
+                            for (sy = y0; sy < y1; ++sy) {
+                                for (sx = x0; sx < x1; ++sx) {
+                                    sum += ((const Uint8 *)src->pixels)[sy * src->pitch + sx * 4 + c];
+                                }
+                            }
+                            if (((const Uint8 *)scalar->pixels)[y * scalar->pitch + x * 4 + c] != sum / count) {
+                                ++errors;
+                            }
+                        }
+                    }
+                }
+                if (area) {
+                    SDLTest_AssertCheck(errors == 0, "Verify averaged channels, expected: 0 errors, got: %d", errors);
+                } else {
+                    SDLTest_AssertCheck(errors > 0, "Verify channels aren't averaged without the hint, expected: > 0 errors, got: %d", errors);
+                }
+            }
+            SDL_FreeSurface(scalar);
+            SDL_FreeSurface(simd);
+            SDL_FreeSurface(src);
+        }
+    }
+
+    SDL_ResetHint(SDL_HINT_STRETCH_AREA_AVERAGE);
+
+    /* A 16-bit image looks the same as its 32-bit copy, give or take the precision of the channels */
+    src = SDL_CreateRGBSurfaceWithFormat(0, 40, 30, 0, SDL_PIXELFORMAT_ARGB8888);
+    SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+    if (src) {
+        for (y = 0; y < src->h; ++y) {
+            for (x = 0; x < src->w; ++x) {
+                *(Uint32 *)((Uint8 *)src->pixels + y * src->pitch + x * 4) = SDL_MapRGB(src->format, x * 6, y * 8, (x + y) * 3);
+            }
+        }
+        gradient16 = SDL_ConvertSurfaceFormat(src, SDL_PIXELFORMAT_RGB565, 0);
+        gradient = gradient16 ? SDL_ConvertSurfaceFormat(gradient16, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+        SDLTest_AssertCheck(gradient16 && gradient, "Verify gradients are not NULL");
+        if (gradient16 && gradient) {
+            static const int dst_sizes[][2] = { { 67, 51 }, { 29, 23 }, { 13, 9 } };
+
+            for (i = 0; i < (int)SDL_arraysize(dst_sizes); ++i) {
+                SDL_Surface *expected = _stretchLinear("65535", gradient, dst_sizes[i][0], dst_sizes[i][1]);
+                SDL_Surface *actual16 = _stretchLinear("65535", gradient16, dst_sizes[i][0], dst_sizes[i][1]);
+                SDL_Surface *actual = actual16 ? SDL_ConvertSurfaceFormat(actual16, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+
+                if (expected && actual) {
+                    const int diff = _stretchDifference(expected, actual, SDL_TRUE);
+
+                    SDLTest_AssertCheck(diff <= 8, "Verify RGB565 gradient stretched to %dx%d, expected difference: <= 8, got: %d",
+                                        dst_sizes[i][0], dst_sizes[i][1], diff);
+                }
+                SDL_FreeSurface(expected);
+                SDL_FreeSurface(actual16);
+                SDL_FreeSurface(actual);
+            }
+        }
+        SDL_FreeSurface(gradient);
+        SDL_FreeSurface(gradient16);
+        SDL_FreeSurface(src);
+    }
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that creates a sheet with runs of transparent, translucent and opaque pixels of random lengths */
+static SDL_Surface *_createRLESheet(Uint32 format, SDL_bool colorkey)
+{
+    SDL_Surface *sheet = SDL_CreateRGBSurfaceWithFormat(0, 97, 41, 0, format);
+    Uint32 seed = 24680;
+    int x, y, run = 0, alpha = 0;
+
+    if (!sheet) {
+        return NULL;
+    }
+    for (y = 0; y < sheet->h; ++y) {
+        for (x = 0; x < sheet->w; ++x) {
+            Uint8 *p = (Uint8 *)sheet->pixels + y * sheet->pitch + x * sheet->format->BytesPerPixel;
+            Uint32 pixel;
+
+            seed = _nextRandom(seed);
+            if (run-- <= 0) {
+                /* Mostly short runs, with a gap of a few pixels now and then */
+                static const int alphas[] = { 0, 255, 1, 128, 254 };
+                run = (seed >> 16) % 11;
+                alpha = alphas[(seed >> 24) % SDL_arraysize(alphas)];
+            }
+            if (alpha != 0 && alpha != 255) {
+                alpha = 1 + (seed >> 8) % 254;
+            }
+            if (colorkey) {
+                pixel = alpha ? SDL_MapRGB(sheet->format, (Uint8)(seed >> 9), (Uint8)(seed >> 17), (Uint8)(seed >> 25)) : SDL_MapRGB(sheet->format, 255, 0, 255);
+            } else {
+                pixel = SDL_MapRGBA(sheet->format, (Uint8)(seed >> 9), (Uint8)(seed >> 17), (Uint8)(seed >> 25), (Uint8)alpha);
+            }
+            if (sheet->format->BytesPerPixel == 2) {
+                *(Uint16 *)p = (Uint16)pixel;
+            } else {
+                *(Uint32 *)p = pixel;
+            }
+        }
+    }
+    if (colorkey) {
+        SDL_SetColorKey(sheet, SDL_TRUE, SDL_MapRGB(sheet->format, 255, 0, 255));
+    } else {
+        SDL_SetSurfaceBlendMode(sheet, SDL_BLENDMODE_BLEND);
+    }
+    return sheet;
+}
+
+/* Helper that blits a new sheet onto a noisy background, whole or as cells at the same places, clipped at every edge */
+static SDL_Surface *_blitRLESheet(Uint32 format, SDL_bool colorkey, Uint32 dst_format, SDL_bool rle, SDL_bool cells)
+{
+    static const int xs[] = { 0, 13, 50, 97 };
+    static const int ys[] = { 0, 7, 30, 41 };
+    SDL_Surface *sheet = _createRLESheet(format, colorkey);
+    SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, 80, 36, 0, dst_format);
+    Uint32 seed = 97531;
+    int i, j;
+
+    if (!sheet || !dst) {
+        SDL_FreeSurface(sheet);
+        SDL_FreeSurface(dst);
+        return NULL;
+    }
+    _fillRandomBytes(dst->pixels, (size_t)dst->h * dst->pitch, &seed);
+    SDL_SetSurfaceRLE(sheet, rle);
+    for (j = 0; j < (cells ? 3 : 1); ++j) {
+        for (i = 0; i < (cells ? 3 : 1); ++i) {
+            SDL_Rect srcrect, dstrect;
+
+            srcrect.x = cells ? xs[i] : 0;
+            srcrect.y = cells ? ys[j] : 0;
+            srcrect.w = cells ? xs[i + 1] - xs[i] : sheet->w;
+            srcrect.h = cells ? ys[j + 1] - ys[j] : sheet->h;
+            dstrect.x = srcrect.x - 5;
+            dstrect.y = srcrect.y - 3;
+            SDL_BlitSurface(sheet, &srcrect, dst, &dstrect);
+        }
+    }
+    SDLTest_AssertCheck(!rle || (sheet->flags & SDL_RLEACCEL), "Verify sheet is RLE accelerated");
+    SDL_FreeSurface(sheet);
+    return dst;
+}
+
+/* Helper that checks two blit results are the same */
+static void _compareRLEBlits(SDL_Surface *expected, SDL_Surface *actual, const char *what)
+{
+    int y, diff = 0;
+
+    if (expected && actual) {
+        for (y = 0; y < expected->h; ++y) {
+            diff |= SDL_memcmp((Uint8 *)expected->pixels + y * expected->pitch, (Uint8 *)actual->pixels + y * actual->pitch,
+                               (size_t)expected->w * expected->format->BytesPerPixel);
+        }
+    }
+    SDLTest_AssertCheck(expected && actual && !diff, "Verify %s to %s, expected: same pixels, got: %s",
+                        what, expected ? SDL_GetPixelFormatName(expected->format->format) : "?", diff ? "different" : "same");
+    SDL_FreeSurface(actual);
+}
+
+/**
+ * @brief Tests RLE blits of parts of a surface, merged runs, and vector blending against the scalar code
+ */
+int surface_testRLEBlit(void *arg)
+{
+    static const Uint32 colorkey_formats[] = { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB565 };
+    static const Uint32 dst_formats[] = { SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 };
+    SDL_Surface *expected, *sheet, *original;
+    int i, x, y, errors;
+
+    /* Colorkeyed RLE blits are the same as the plain ones */
+    for (i = 0; i < (int)SDL_arraysize(colorkey_formats); ++i) {
+        const Uint32 format = colorkey_formats[i];
+
+        expected = _blitRLESheet(format, SDL_TRUE, format, SDL_FALSE, SDL_FALSE);
+        _compareRLEBlits(expected, _blitRLESheet(format, SDL_TRUE, format, SDL_TRUE, SDL_FALSE), "colorkey RLE blit");
+        _compareRLEBlits(expected, _blitRLESheet(format, SDL_TRUE, format, SDL_TRUE, SDL_TRUE), "colorkey RLE blit of cells");
+        SDL_FreeSurface(expected);
+    }
+
+    /* Alpha RLE blits of parts look like blits of the whole, however the runs were encoded and blended */
+    for (i = 0; i < (int)SDL_arraysize(dst_formats); ++i) {
+        const Uint32 format = dst_formats[i];
+
+        expected = _blitRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, format, SDL_TRUE, SDL_FALSE);
+        _compareRLEBlits(expected, _blitRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, format, SDL_TRUE, SDL_TRUE), "alpha RLE blit of cells");
+        SDL_SetHint(SDL_HINT_RLE_MERGE_RUNS, "0");
+        _compareRLEBlits(expected, _blitRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, format, SDL_TRUE, SDL_FALSE), "alpha RLE blit of unmerged runs");
+        _compareRLEBlits(expected, _blitRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, format, SDL_TRUE, SDL_TRUE), "alpha RLE blit of cells with unmerged runs");
+        SDL_ResetHint(SDL_HINT_RLE_MERGE_RUNS);
+        SDL_setenv("SDL_BLIT_CPU_FEATURES", "0", 1);
+        _compareRLEBlits(expected, _blitRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE, format, SDL_TRUE, SDL_TRUE), "scalar alpha RLE blit of cells");
+        SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+        SDL_FreeSurface(expected);
+    }
+
+    /* Merged runs still decode to the original opaque and translucent pixels */
+    sheet = _createRLESheet(SDL_PIXELFORMAT_ARGB8888, SDL_FALSE);
+    original = sheet ? SDL_DuplicateSurface(sheet) : NULL;
+    expected = SDL_CreateRGBSurfaceWithFormat(0, 97, 41, 0, SDL_PIXELFORMAT_RGB888);
+    SDLTest_AssertCheck(sheet && original && expected, "Verify surfaces are not NULL");
+    if (sheet && original && expected) {
+        SDL_SetSurfaceRLE(sheet, SDL_TRUE);
+        SDL_BlitSurface(sheet, NULL, expected, NULL);
+        SDLTest_AssertCheck(sheet->pixels == NULL, "Verify pixels of the RLE sheet were released");
+        SDL_LockSurface(sheet);
+        errors = 0;
+        for (y = 0; y < sheet->h; ++y) {
+            for (x = 0; x < sheet->w; ++x) {
+                const Uint32 pixel = ((Uint32 *)((Uint8 *)original->pixels + y * original->pitch))[x];
+                const Uint32 decoded = ((Uint32 *)((Uint8 *)sheet->pixels + y * sheet->pitch))[x];
+
+                if ((pixel >> 24) ? (decoded != pixel) : (decoded >> 24) != 0) {
+                    ++errors;
+                }
+            }
+        }
+        SDL_UnlockSurface(sheet);
+        SDLTest_AssertCheck(errors == 0, "Verify decoded pixels, expected: 0 errors, got: %d", errors);
+    }
+    SDL_FreeSurface(expected);
+    SDL_FreeSurface(original);
+    SDL_FreeSurface(sheet);
+
+    return TEST_COMPLETED;
+}
+
+/* Helper that fills a surface, and its palette if any, with pseudo-random values */
+static void _fillRandomBMP(SDL_Surface *surface, Uint32 seed)
+{
+    int i;
+
+    _fillRandomBytes(surface->pixels, (size_t)surface->h * surface->pitch, &seed);
+    if (surface->format->palette) {
+        _randomizePalette(surface->format->palette, &seed);
+        for (i = 0; i < surface->format->palette->ncolors; ++i) {
+            surface->format->palette->colors[i].a = SDL_ALPHA_OPAQUE;
+        }
+    }
+}
+
+/* Helper that saves a surface into memory and loads it back, NULL if either fails */
+static SDL_Surface *_roundTripBMP(SDL_Surface *surface, Uint8 *buffer, size_t size, size_t *used)
+{
+    SDL_RWops *rw = SDL_RWFromMem(buffer, (int)size);
+    SDL_Surface *loaded = NULL;
+
+    if (rw && SDL_SaveBMP_RW(surface, rw, 0) == 0) {
+        *used = (size_t)SDL_RWtell(rw);
+        SDL_RWseek(rw, 0, RW_SEEK_SET);
+        loaded = SDL_LoadBMP_RW(rw, 0);
+    }
+    SDL_RWclose(rw);
+    return loaded;
+}
+
+/* Helper that checks two surfaces have the same pixels once converted to ARGB8888 */
+static void _compareBMPs(SDL_Surface *expected, SDL_Surface *actual, const char *what)
+{
+    SDL_Surface *a = expected ? SDL_ConvertSurfaceFormat(expected, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+    SDL_Surface *b = actual ? SDL_ConvertSurfaceFormat(actual, SDL_PIXELFORMAT_ARGB8888, 0) : NULL;
+    int y, diff = 0;
+
+    if (a && b && a->w == b->w && a->h == b->h) {
+        for (y = 0; y < a->h; ++y) {
+            diff |= SDL_memcmp((Uint8 *)a->pixels + y * a->pitch, (Uint8 *)b->pixels + y * b->pitch, (size_t)a->w * 4);
+        }
+    } else {
+        diff = 1;
+    }
+    SDLTest_AssertCheck(!diff, "Verify %s of %s, expected: same pixels, got: %s",
+                        what, expected ? SDL_GetPixelFormatName(expected->format->format) : "?", diff ? "different" : "same");
+    SDL_FreeSurface(a);
+    SDL_FreeSurface(b);
+}
+
+/* Helper that stores a little endian value */
+static void _putLE(Uint8 *p, Uint32 value, int bytes)
+{
+    while (bytes--) {
+        *p++ = (Uint8)value;
+        value >>= 8;
+    }
+}
+
+/* Helper that builds a bottom-up BMP of 1, 2 or 4 bits per pixel, with the index (x + 3 * y) of every pixel */
+static size_t _buildPaletteBMP(Uint8 *buffer, int bpp, int w, int h)
+{
+    const int ncolors = 1 << bpp;
+    const int pitch = (((w * bpp + 7) / 8) + 3) & ~3;
+    const int offset = 14 + 40 + 4 * ncolors;
+    const int size = offset + pitch * h;
+    int i, x, y;
+
+    SDL_memset(buffer, 0, size);
+    buffer[0] = 'B';
+    buffer[1] = 'M';
+    _putLE(buffer + 2, size, 4);
+    _putLE(buffer + 10, offset, 4);
+    _putLE(buffer + 14, 40, 4);
+    _putLE(buffer + 18, w, 4);
+    _putLE(buffer + 22, h, 4);
+    _putLE(buffer + 26, 1, 2);
+    _putLE(buffer + 28, bpp, 2);
+    _putLE(buffer + 46, ncolors, 4);
+    for (i = 0; i < ncolors; ++i) {
+        buffer[14 + 40 + 4 * i + 0] = (Uint8)(i * 7);
+        buffer[14 + 40 + 4 * i + 1] = (Uint8)(i * 11);
+        buffer[14 + 40 + 4 * i + 2] = (Uint8)(i * 13);
+    }
+    for (y = 0; y < h; ++y) {
+        Uint8 *row = buffer + offset + (h - 1 - y) * pitch;
+        for (x = 0; x < w; ++x) {
+            const int index = (x + 3 * y) % ncolors;
+            row[(x * bpp) / 8] |= (Uint8)(index << (8 - bpp - (x * bpp) % 8));
+        }
+    }
+    return size;
+}
+
+/**
+ * @brief Tests loading and saving BMP images a block of rows at a time, bottom-up and top-down, with and without vector code
+ */
+int surface_testBMPBlocks(void *arg)
+{
+    static const Uint32 formats[] = {
+        SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_RGB888,
+        SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_BGR24, SDL_PIXELFORMAT_INDEX8
+    };
+    static const int bpps[] = { 1, 2, 4 };
+    /* Tall enough for a few blocks, and with padding at the end of 24-bit rows */
+    const int w = 37, h = 1500;
+    const size_t size = (size_t)h * (w * 4 + 4) + 2048;
+    Uint8 *buffer = (Uint8 *)SDL_malloc(size);
+    Uint8 *flipped = (Uint8 *)SDL_malloc(size);
+    SDL_Surface *surface, *loaded, *topdown;
+    size_t used = 0;
+    int i, x, y, errors;
+
+    SDLTest_AssertCheck(buffer && flipped, "Verify buffers are not NULL");
+    if (!buffer || !flipped) {
+        SDL_free(buffer);
+        SDL_free(flipped);
+        return TEST_ABORTED;
+    }
+
+    /* Every format comes back as it was, whether it's written as is or converted on the way */
+    for (i = 0; i < (int)SDL_arraysize(formats); ++i) {
+        surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, formats[i]);
+        SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+        if (!surface) {
+            continue;
+        }
+        _fillRandomBMP(surface, 13579 + i);
+        loaded = _roundTripBMP(surface, buffer, size, &used);
+        SDLTest_AssertCheck(loaded != NULL, "Verify BMP of %s was saved and loaded: %s", SDL_GetPixelFormatName(formats[i]), loaded ? "yes" : SDL_GetError());
+        if (loaded && loaded->format->format != formats[i]) {
+            /* Converted like SDL_ConvertSurface() does it */
+            SDL_Surface *converted = SDL_ConvertSurfaceFormat(surface, loaded->format->format, 0);
+            _compareBMPs(converted, loaded, "saved and loaded BMP");
+            SDL_FreeSurface(converted);
+        } else {
+            _compareBMPs(surface, loaded, "saved and loaded BMP");
+        }
+
+        /* The same image stored top-down */
+        if (loaded) {
+            const Uint32 offset = buffer[10] | (buffer[11] << 8) | ((Uint32)buffer[12] << 16) | ((Uint32)buffer[13] << 24);
+            const size_t stride = (used - offset) / h;
+            SDL_RWops *rw;
+
+            SDL_memcpy(flipped, buffer, offset);
+            for (y = 0; y < h; ++y) {
+                SDL_memcpy(flipped + offset + y * stride, buffer + offset + (h - 1 - y) * stride, stride);
+            }
+            _putLE(flipped + 22, (Uint32)-h, 4);
+            rw = SDL_RWFromConstMem(flipped, (int)used);
+            topdown = SDL_LoadBMP_RW(rw, 1);
+            _compareBMPs(loaded, topdown, "top-down BMP");
+            SDL_FreeSurface(topdown);
+        }
+        SDL_FreeSurface(loaded);
+        SDL_FreeSurface(surface);
+    }
+
+    /* A 32-bit BMP without alpha in its channel is opaque, one with any alpha keeps it, with or without vector code */
+    SDL_SetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT, "1");
+    for (i = 0; i < 4; ++i) {
+        const SDL_bool simd = (i & 1) ? SDL_TRUE : SDL_FALSE;
+        const SDL_bool alpha = (i & 2) ? SDL_TRUE : SDL_FALSE;
+
+        surface = SDL_CreateRGBSurfaceWithFormat(0, w, h, 0, SDL_PIXELFORMAT_ARGB8888);
+        SDLTest_AssertCheck(surface != NULL, "Verify surface is not NULL");
+        if (!surface) {
+            continue;
+        }
+        _fillRandomBMP(surface, 24680);
+        for (y = 0; y < h; ++y) {
+            for (x = 0; x < w; ++x) {
+                ((Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch))[x] &= 0x00FFFFFF;
+            }
+        }
+        if (alpha) {
+            ((Uint32 *)((Uint8 *)surface->pixels + (h / 2) * surface->pitch))[w / 2] |= 0x80000000;
+        }
+        SDL_setenv("SDL_BLIT_CPU_FEATURES", simd ? "65535" : "0", 1);
+        loaded = _roundTripBMP(surface, buffer, size, &used);
+        SDLTest_AssertCheck(loaded != NULL, "Verify legacy 32-bit BMP was saved and loaded");
+        if (!alpha) {
+            for (y = 0; y < h; ++y) {
+                for (x = 0; x < w; ++x) {
+                    ((Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch))[x] |= 0xFF000000;
+                }
+            }
+        }
+        _compareBMPs(surface, loaded, simd ? "legacy 32-bit BMP" : "scalar legacy 32-bit BMP");
+        SDL_FreeSurface(loaded);
+        SDL_FreeSurface(surface);
+    }
+    SDL_setenv("SDL_BLIT_CPU_FEATURES", "65535", 1);
+    SDL_ResetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT);
+
+    /* Bitmaps of less than 8 bits per pixel are expanded a row at a time */
+    for (i = 0; i < (int)SDL_arraysize(bpps); ++i) {
+        SDL_RWops *rw = SDL_RWFromConstMem(buffer, (int)_buildPaletteBMP(buffer, bpps[i], w, 5));
+
+        loaded = SDL_LoadBMP_RW(rw, 1);
+        SDLTest_AssertCheck(loaded != NULL, "Verify %d-bit BMP was loaded", bpps[i]);
+        if (!loaded) {
+            continue;
+        }
+        errors = 0;
+        for (y = 0; y < loaded->h; ++y) {
+            for (x = 0; x < loaded->w; ++x) {
+                const int index = ((Uint8 *)loaded->pixels)[y * loaded->pitch + x];
+                if (index != (x + 3 * y) % (1 << bpps[i]) || loaded->format->palette->colors[index].b != (Uint8)(index * 7)) {
+                    ++errors;
+                }
+            }
+        }
+        SDLTest_AssertCheck(errors == 0, "Verify pixels of %d-bit BMP, expected: 0 errors, got: %d", bpps[i], errors);
+        SDL_FreeSurface(loaded);
+    }
+
+    SDL_free(flipped);
+    SDL_free(buffer);
+
+    return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -852,6 +2226,46 @@ static const SDLTest_TestCaseReference surfaceTest12 = {
     (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED
 };
 
+static const SDLTest_TestCaseReference surfaceTest13 = {
+    (SDLTest_TestCaseFp)surface_testBlitAlphaSIMD, "surface_testBlitAlphaSIMD", "Tests that vector alpha blitters match the scalar ones.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest14 = {
+    (SDLTest_TestCaseFp)surface_testBlitAutoSIMD, "surface_testBlitAutoSIMD", "Tests that vector generated blitters match the scalar ones.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest15 = {
+    (SDLTest_TestCaseFp)surface_testBlitThreads, "surface_testBlitThreads", "Tests that operations split into bands match serial ones.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest16 = {
+    (SDLTest_TestCaseFp)surface_testBlitShuffle, "surface_testBlitShuffle", "Tests copies between all 32-bit formats with 8-bit channels.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest17 = {
+    (SDLTest_TestCaseFp)surface_testBlitPremultiplied, "surface_testBlitPremultiplied", "Tests the premultiplied alpha blend mode.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest18 = {
+    (SDLTest_TestCaseFp)surface_testBlitMapCache, "surface_testBlitMapCache", "Tests switching blits between destinations and modulations.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest19 = {
+    (SDLTest_TestCaseFp)surface_testSIMDPitch, "surface_testSIMDPitch", "Tests SIMD aligned rows and blits between them.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest20 = {
+    (SDLTest_TestCaseFp)surface_testStretchLinear, "surface_testStretchLinear", "Tests bilinear and opt-in area averaging stretches against each other and a box filter.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest21 = {
+    (SDLTest_TestCaseFp)surface_testRLEBlit, "surface_testRLEBlit", "Tests RLE blits of parts of a surface, merged runs and vector blending.", TEST_ENABLED
+};
+
+static const SDLTest_TestCaseReference surfaceTest22 = {
+    (SDLTest_TestCaseFp)surface_testBMPBlocks, "surface_testBMPBlocks", "Tests loading and saving BMP images a block of rows at a time.", TEST_ENABLED
+};
+
 static const SDLTest_TestCaseReference surfaceTestOverflow = {
     surface_testOverflow, "surface_testOverflow", "Test overflow detection.", TEST_ENABLED
 };
@@ -860,7 +2274,8 @@ static const SDLTest_TestCaseReference surfaceTestOverflow = {
 static const SDLTest_TestCaseReference *surfaceTests[] = {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, &surfaceTestOverflow, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14, &surfaceTest15,
+    &surfaceTest16, &surfaceTest17, &surfaceTest18, &surfaceTest19, &surfaceTest20, &surfaceTest21, &surfaceTest22, &surfaceTestOverflow, NULL
 };
 
 /* Surface test suite (global) */
@@ -0,0 +1,185 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure small sprite blits that keep switching between
+   destinations and modulations, against blits that always go to the same one */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define NUM_TARGETS 2
+
+typedef struct
+{
+    const char *name;
+    Uint32 sprite_format;
+    Uint32 target_formats[NUM_TARGETS];
+    SDL_bool modulate;
+} Scenario;
+
+static int num_iterations = 100000;
+static SDL_Surface *sprite;
+static SDL_Surface *targets[NUM_TARGETS];
+
+static const Scenario scenarios[] = {
+    { "ARGB8888 to ARGB8888 and RGB565", SDL_PIXELFORMAT_ARGB8888, { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 }, SDL_FALSE },
+    { "ARGB8888 with alpha on and off", SDL_PIXELFORMAT_ARGB8888, { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ARGB8888 }, SDL_TRUE },
+    { "INDEX8 to ARGB8888 and RGB565", SDL_PIXELFORMAT_INDEX8, { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 }, SDL_FALSE },
+    { "ARGB8888 to two INDEX8 targets", SDL_PIXELFORMAT_ARGB8888, { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_INDEX8 }, SDL_FALSE },
+};
+
+static void
+FreeSurfaces(void)
+{
+    int i;
+
+    SDL_FreeSurface(sprite);
+    sprite = NULL;
+    for (i = 0; i < NUM_TARGETS; ++i) {
+        SDL_FreeSurface(targets[i]);
+        targets[i] = NULL;
+    }
+}
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    FreeSurfaces();
+    SDL_Quit();
+    exit(rc);
+}
+
+/* The same pseudo-random pixels and colors for every run */
+static void
+FillSurface(SDL_Surface *surface, Uint32 *seed)
+{
+    int i;
+
+    for (i = 0; i < surface->h * surface->pitch; ++i) {
+        *seed = *seed * 1103515245 + 12345;
+        ((Uint8 *)surface->pixels)[i] = (Uint8)(*seed >> 16);
+    }
+    if (surface->format->palette) {
+        SDL_Palette *palette = surface->format->palette;
+        SDL_Color colors[256];
+
+        for (i = 0; i < palette->ncolors; ++i) {
+            *seed = *seed * 1103515245 + 12345;
+            colors[i].r = (Uint8)(*seed >> 24);
+            colors[i].g = (Uint8)(*seed >> 16);
+            colors[i].b = (Uint8)(*seed >> 8);
+            colors[i].a = SDL_ALPHA_OPAQUE;
+        }
+        SDL_SetPaletteColors(palette, colors, 0, palette->ncolors);
+    }
+}
+
+static SDL_bool
+CreateSurfaces(const Scenario *scenario)
+{
+    Uint32 seed = 12345;
+    int i;
+
+    sprite = SDL_CreateRGBSurfaceWithFormat(0, 32, 32, 0, scenario->sprite_format);
+    if (!sprite) {
+        return SDL_FALSE;
+    }
+    FillSurface(sprite, &seed);
+    for (i = 0; i < NUM_TARGETS; ++i) {
+        targets[i] = SDL_CreateRGBSurfaceWithFormat(0, 256, 256, 0, scenario->target_formats[i]);
+        if (!targets[i]) {
+            return SDL_FALSE;
+        }
+        FillSurface(targets[i], &seed);
+    }
+    return SDL_TRUE;
+}
+
+/* Blits the sprite num_iterations times, switching between the targets or not */
+static double
+RunBlits(const Scenario *scenario, SDL_bool alternate)
+{
+    Uint64 start, elapsed;
+    SDL_Rect dstrect;
+    int i;
+
+    dstrect.w = sprite->w;
+    dstrect.h = sprite->h;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_iterations; ++i) {
+        const int which = alternate ? (i & 1) : 0;
+
+        if (scenario->modulate) {
+            SDL_SetSurfaceAlphaMod(sprite, which ? 0x80 : 0xFF);
+            SDL_SetSurfaceBlendMode(sprite, which ? SDL_BLENDMODE_BLEND : SDL_BLENDMODE_NONE);
+        }
+        dstrect.x = (i * 7) & 0xFF;
+        dstrect.y = (i * 13) & 0xFF;
+        if (SDL_BlitSurface(sprite, NULL, targets[which], &dstrect) < 0) {
+            SDL_Log("Couldn't blit: %s\n", SDL_GetError());
+            quit(2);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    return (double)elapsed * 1000000.0 / SDL_GetPerformanceFrequency() / num_iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            num_iterations = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--iterations N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_iterations <= 0) {
+        SDL_Log("The number of iterations must be positive\n");
+        return 1;
+    }
+
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("32x32 sprite, %d blits\n", num_iterations);
+    for (i = 0; i < SDL_arraysize(scenarios); ++i) {
+        const Scenario *scenario = &scenarios[i];
+        double same_us, alternate_us;
+
+        if (!CreateSurfaces(scenario)) {
+            SDL_Log("Couldn't create surfaces: %s\n", SDL_GetError());
+            quit(2);
+        }
+        same_us = RunBlits(scenario, SDL_FALSE);
+        alternate_us = RunBlits(scenario, SDL_TRUE);
+        SDL_Log("  %-32s same: %7.3f us, alternating: %7.3f us per blit\n", scenario->name, same_us, alternate_us);
+        FreeSurfaces();
+    }
+
+    quit(0);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
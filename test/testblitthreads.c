@@ -0,0 +1,241 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure how large software blits, fills, stretches and
+   pixel conversions scale with the number of threads, see SDL_HINT_BLIT_THREADS */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    void (*run)(void);
+    SDL_Surface *(*result)(void);
+} Operation;
+
+static int num_iterations = 20;
+static int width;
+static int height;
+static SDL_Surface *src;
+static SDL_Surface *dst;
+static SDL_Surface *half;
+static Uint8 *yuv;
+static int yuv_pitch;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(half);
+    SDL_free(yuv);
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_Surface *
+DestinationResult(void)
+{
+    return dst;
+}
+
+static void
+RunConvert(void)
+{
+    SDL_ConvertPixels(width, height, src->format->format, src->pixels, src->pitch,
+                      SDL_PIXELFORMAT_ABGR8888, dst->pixels, dst->pitch);
+}
+
+static void
+RunBlend(void)
+{
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_BLEND);
+    SDL_BlitSurface(src, NULL, dst, NULL);
+    SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+}
+
+static void
+RunFill(void)
+{
+    SDL_FillRect(dst, NULL, SDL_MapRGBA(dst->format, 0x20, 0x40, 0x60, 0x80));
+}
+
+static void
+RunStretch(void)
+{
+    SDL_SoftStretchLinear(half, NULL, dst, NULL);
+}
+
+static void
+RunYUV(void)
+{
+    SDL_ConvertPixels(width, height, SDL_PIXELFORMAT_NV12, yuv, yuv_pitch,
+                      SDL_PIXELFORMAT_ARGB8888, dst->pixels, dst->pitch);
+}
+
+static const Operation operations[] = {
+    { "ARGB8888 to ABGR8888", RunConvert, DestinationResult },
+    { "blended blit", RunBlend, DestinationResult },
+    { "fill", RunFill, DestinationResult },
+    { "linear stretch 2x", RunStretch, DestinationResult },
+    { "NV12 to ARGB8888", RunYUV, DestinationResult },
+};
+
+/* The same pseudo-random pixels for every run, so the results can be compared */
+static void
+FillPixels(Uint8 *pixels, int pitch, int w, int h, int bpp)
+{
+    Uint32 seed = 12345;
+    int x, y;
+
+    for (y = 0; y < h; ++y) {
+        Uint8 *row = pixels + y * pitch;
+
+        for (x = 0; x < w * bpp; ++x) {
+            seed = seed * 1103515245 + 12345;
+            row[x] = (Uint8)(seed >> 16);
+        }
+    }
+}
+
+static SDL_bool
+CreateBuffers(void)
+{
+    src = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    dst = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_ARGB8888);
+    half = SDL_CreateRGBSurfaceWithFormat(0, width / 2, height / 2, 32, SDL_PIXELFORMAT_ARGB8888);
+    yuv_pitch = width;
+    yuv = (Uint8 *)SDL_malloc((size_t)yuv_pitch * height * 3 / 2);
+    if (!src || !dst || !half || !yuv) {
+        return SDL_FALSE;
+    }
+    FillPixels((Uint8 *)src->pixels, src->pitch, src->w, src->h, 4);
+    FillPixels((Uint8 *)half->pixels, half->pitch, half->w, half->h, 4);
+    FillPixels(yuv, yuv_pitch, width, height * 3 / 2, 1);
+    return SDL_TRUE;
+}
+
+/* Runs the operation with the given number of threads, 0 for the serial path */
+static double
+RunOperation(const Operation *op, int threads, Uint32 *checksum)
+{
+    SDL_Surface *result;
+    Uint64 start, elapsed;
+    char value[16];
+    int i;
+
+    /* The worker pool is created once per SDL_Init(), and SDL_Quit() clears the hints */
+    SDL_snprintf(value, sizeof(value), "%d", SDL_max(threads, 1));
+    SDL_SetHint(SDL_HINT_JOB_THREADS, value);
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, threads ? "1" : "0");
+    if (SDL_Init(0) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s\n", SDL_GetError());
+        quit(1);
+    }
+
+    /* Start from the same destination every time, blending reads it */
+    SDL_memset(dst->pixels, 0x80, (size_t)dst->h * dst->pitch);
+    op->run();
+    result = op->result();
+    *checksum = SDL_crc32(0, result->pixels, (size_t)result->h * result->pitch);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_iterations; ++i) {
+        op->run();
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_Quit();
+
+    return (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / num_iterations;
+}
+
+static void
+RunSize(int w, int h, int max_threads)
+{
+    int i, j;
+
+    width = w;
+    height = h;
+    if (!CreateBuffers()) {
+        SDL_Log("Out of memory!\n");
+        quit(2);
+    }
+
+    SDL_Log("%dx%d, 1 to %d threads, %d iterations\n", width, height, max_threads, num_iterations);
+    for (i = 0; i < SDL_arraysize(operations); ++i) {
+        const Operation *op = &operations[i];
+        Uint32 serial_checksum;
+        const double serial_ms = RunOperation(op, 0, &serial_checksum);
+
+        SDL_Log("  %-22s serial:     %8.3f ms\n", op->name, serial_ms);
+        for (j = 1; j <= max_threads; ++j) {
+            Uint32 checksum;
+            const double ms = RunOperation(op, j, &checksum);
+
+            SDL_Log("  %-22s %2d thread%s: %8.3f ms, %.2fx%s\n", op->name, j, j == 1 ? " " : "s", ms,
+                    ms > 0.0 ? serial_ms / ms : 0.0,
+                    checksum == serial_checksum ? "" : ", OUTPUT DIFFERS FROM SERIAL");
+        }
+    }
+
+    SDL_FreeSurface(src);
+    SDL_FreeSurface(dst);
+    SDL_FreeSurface(half);
+    SDL_free(yuv);
+    src = dst = half = NULL;
+    yuv = NULL;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_threads = 0;
+    SDL_bool do_4k = SDL_TRUE;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            max_threads = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            num_iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--no-4k") == 0) {
+            do_4k = SDL_FALSE;
+        } else {
+            SDL_Log("Usage: %s [--threads N] [--iterations N] [--no-4k]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (max_threads <= 0) {
+        max_threads = SDL_GetCPUCount();
+    }
+    if (num_iterations <= 0) {
+        SDL_Log("The number of iterations must be positive\n");
+        return 1;
+    }
+
+    RunSize(1920, 1080, max_threads);
+    if (do_4k) {
+        RunSize(3840, 2160, max_threads);
+    }
+
+    quit(0);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
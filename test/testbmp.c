@@ -0,0 +1,168 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure how fast SDL_SaveBMP_RW() and SDL_LoadBMP_RW()
+   go through screenshot sized images, in memory or in a file, for a few
+   pixel formats */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    Uint32 format;
+    SDL_bool legacy;
+} Mode;
+
+static const Mode modes[] = {
+    { "ARGB8888", SDL_PIXELFORMAT_ARGB8888, SDL_FALSE },
+    { "ARGB8888 legacy", SDL_PIXELFORMAT_ARGB8888, SDL_TRUE },
+    { "RGB888", SDL_PIXELFORMAT_RGB888, SDL_FALSE },
+    { "RGB565", SDL_PIXELFORMAT_RGB565, SDL_FALSE },
+    { "BGR24", SDL_PIXELFORMAT_BGR24, SDL_FALSE },
+};
+
+static int num_iterations = 20;
+static const char *filename = NULL;
+
+/* Pseudo-random colors, opaque but for a few pixels, like a screenshot of a window with alpha */
+static void
+FillPixels(SDL_Surface *surface)
+{
+    Uint32 seed = 12345;
+    int x, y;
+
+    for (y = 0; y < surface->h; ++y) {
+        for (x = 0; x < surface->w; ++x) {
+            Uint8 *p = (Uint8 *)surface->pixels + y * surface->pitch + x * surface->format->BytesPerPixel;
+            Uint32 pixel;
+
+            seed = seed * 1103515245 + 12345;
+            pixel = SDL_MapRGBA(surface->format, (Uint8)(seed >> 8), (Uint8)(seed >> 16), (Uint8)(seed >> 24),
+                                (x == y) ? 128 : 255);
+            SDL_memcpy(p, &pixel, surface->format->BytesPerPixel);
+        }
+    }
+}
+
+/* Logs the times of one save and one load, and a checksum of the file and the loaded pixels */
+static void
+RunMode(const Mode *mode, int width, int height, Uint8 *buffer, size_t size)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, mode->format);
+    SDL_Surface *loaded = NULL;
+    SDL_RWops *rw = filename ? SDL_RWFromFile(filename, "w+b") : SDL_RWFromMem(buffer, (int)size);
+    Uint64 start, save_time = 0, load_time = 0;
+    Sint64 file_size = 0;
+    Uint32 checksum = 0;
+    int i;
+
+    if (!surface || !rw) {
+        SDL_Log("Couldn't create surface or open file: %s\n", SDL_GetError());
+        SDL_FreeSurface(surface);
+        SDL_RWclose(rw);
+        return;
+    }
+    FillPixels(surface);
+    SDL_SetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT, mode->legacy ? "1" : "0");
+
+    for (i = 0; i < num_iterations; ++i) {
+        SDL_RWseek(rw, 0, RW_SEEK_SET);
+        start = SDL_GetPerformanceCounter();
+        if (SDL_SaveBMP_RW(surface, rw, 0) < 0) {
+            SDL_Log("  %-16s couldn't save: %s\n", mode->name, SDL_GetError());
+            break;
+        }
+        save_time += SDL_GetPerformanceCounter() - start;
+        file_size = SDL_RWtell(rw);
+
+        SDL_FreeSurface(loaded);
+        SDL_RWseek(rw, 0, RW_SEEK_SET);
+        start = SDL_GetPerformanceCounter();
+        loaded = SDL_LoadBMP_RW(rw, 0);
+        if (!loaded) {
+            SDL_Log("  %-16s couldn't load: %s\n", mode->name, SDL_GetError());
+            break;
+        }
+        load_time += SDL_GetPerformanceCounter() - start;
+    }
+
+    if (i == num_iterations) {
+        SDL_RWseek(rw, 0, RW_SEEK_SET);
+        SDL_RWread(rw, buffer, 1, (size_t)file_size);
+        checksum = SDL_crc32(0, buffer, (size_t)file_size);
+        checksum = SDL_crc32(checksum, loaded->pixels, (size_t)loaded->h * loaded->pitch);
+        SDL_Log("  %-16s save %7.3f ms, load %7.3f ms, %" SDL_PRIs64 " bytes, checksum %08" SDL_PRIx32 "\n", mode->name,
+                (double)save_time * 1000.0 / SDL_GetPerformanceFrequency() / num_iterations,
+                (double)load_time * 1000.0 / SDL_GetPerformanceFrequency() / num_iterations,
+                file_size, checksum);
+    }
+    SDL_ResetHint(SDL_HINT_BMP_SAVE_LEGACY_FORMAT);
+    SDL_FreeSurface(loaded);
+    SDL_FreeSurface(surface);
+    SDL_RWclose(rw);
+}
+
+int main(int argc, char *argv[])
+{
+    int width = 1920;
+    int height = 1080;
+    Uint8 *buffer;
+    size_t size;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            num_iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+            width = SDL_atoi(argv[++i]);
+            height = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--file") == 0 && argv[i + 1]) {
+            filename = argv[++i];
+        } else {
+            SDL_Log("Usage: %s [--iterations N] [--size W H] [--file FILE]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_iterations <= 0 || width <= 0 || height <= 0) {
+        SDL_Log("The number of iterations and the size must be positive\n");
+        return 1;
+    }
+
+    /* Room for the largest file, a 32-bit image with a version 4 header */
+    size = (size_t)width * height * 4 + 1024;
+    buffer = (Uint8 *)SDL_malloc(size);
+    if (!buffer) {
+        SDL_Log("Out of memory\n");
+        return 2;
+    }
+
+    SDL_Log("%dx%d images in %s, %d iterations\n", width, height, filename ? filename : "memory", num_iterations);
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        RunMode(&modes[i], width, height, buffer, size);
+    }
+
+    SDL_free(buffer);
+    if (filename) {
+        remove(filename);
+    }
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,257 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure how tile-parallel software rendering scales with
+   the number of threads, drawing moving sprites like testsprite2 does */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define WINDOW_WIDTH  640
+#define WINDOW_HEIGHT 480
+#define SPRITE_SIZE   32
+
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static SDL_Texture *sprite;
+static SDL_Rect *positions;
+static SDL_Rect *velocities;
+static int num_sprites = 2000;
+static int num_frames = 100;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_free(positions);
+    SDL_free(velocities);
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_Texture *
+CreateSprite(void)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    /* A round sprite with soft edges, so most pixels need blending */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE, SPRITE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const int dx = 2 * x - SPRITE_SIZE + 1;
+            const int dy = 2 * y - SPRITE_SIZE + 1;
+            const int d = (dx * dx + dy * dy) * 255 / (SPRITE_SIZE * SPRITE_SIZE);
+            const Uint8 alpha = (Uint8)(d >= 255 ? 0 : 255 - d);
+
+            row[x] = SDL_MapRGBA(surface->format, (Uint8)(x * 8), (Uint8)(y * 8), 0xFF, alpha);
+        }
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+static void
+ResetSprites(void)
+{
+    int i;
+
+    /* The same pseudo-random start for every run, so the frames can be compared */
+    for (i = 0; i < num_sprites; ++i) {
+        positions[i].x = (i * 7919) % (WINDOW_WIDTH - SPRITE_SIZE);
+        positions[i].y = (i * 104729) % (WINDOW_HEIGHT - SPRITE_SIZE);
+        positions[i].w = SPRITE_SIZE;
+        positions[i].h = SPRITE_SIZE;
+        velocities[i].x = (i % 7) - 3;
+        velocities[i].y = (i % 5) - 2;
+        if (!velocities[i].x && !velocities[i].y) {
+            velocities[i].x = 1;
+        }
+    }
+}
+
+static void
+DrawFrame(void)
+{
+    SDL_Rect rect;
+    int i;
+
+    SDL_SetRenderDrawColor(renderer, 0xA0, 0xA0, 0xA0, 0xFF);
+    SDL_RenderClear(renderer);
+
+    /* Test points, lines and rects along the edges, like testsprite2 */
+    SDL_SetRenderDrawColor(renderer, 0xFF, 0x00, 0x00, 0xFF);
+    SDL_RenderDrawPoint(renderer, 0, 0);
+    SDL_RenderDrawPoint(renderer, WINDOW_WIDTH - 1, WINDOW_HEIGHT - 1);
+    SDL_RenderDrawLine(renderer, 1, 0, WINDOW_WIDTH - 2, 0);
+    SDL_RenderDrawLine(renderer, 0, 1, 0, WINDOW_HEIGHT - 2);
+    rect.x = 1;
+    rect.y = 1;
+    rect.w = 3;
+    rect.h = 3;
+    SDL_RenderFillRect(renderer, &rect);
+    rect.x = WINDOW_WIDTH - 4;
+    rect.y = WINDOW_HEIGHT - 4;
+    SDL_RenderFillRect(renderer, &rect);
+
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_Rect *position = &positions[i];
+        SDL_Rect *velocity = &velocities[i];
+
+        position->x += velocity->x;
+        if ((position->x < 0) || (position->x >= (WINDOW_WIDTH - SPRITE_SIZE))) {
+            velocity->x = -velocity->x;
+            position->x += velocity->x;
+        }
+        position->y += velocity->y;
+        if ((position->y < 0) || (position->y >= (WINDOW_HEIGHT - SPRITE_SIZE))) {
+            velocity->y = -velocity->y;
+            position->y += velocity->y;
+        }
+        SDL_RenderCopy(renderer, sprite, NULL, position);
+    }
+    SDL_RenderPresent(renderer);
+}
+
+/* Renders the frames with the given number of threads, 0 for the serial path */
+static double
+RunFrames(int threads, Uint32 *checksum)
+{
+    SDL_Surface *frame;
+    Uint64 start, elapsed;
+    char value[16];
+    int i;
+
+    /* The worker pool is created once per SDL_Init(), and SDL_Quit() clears the hints */
+    SDL_snprintf(value, sizeof(value), "%d", SDL_max(threads, 1));
+    SDL_SetHint(SDL_HINT_JOB_THREADS, value);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_TILES, threads ? "1" : "0");
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+    /* Draw off screen, this measures the renderer and not the window system */
+    SDL_SetHint(SDL_HINT_VIDEODRIVER, "offscreen");
+
+    if (SDL_Init(SDL_INIT_VIDEO) < 0) {
+        SDL_Log("Couldn't initialize SDL: %s\n", SDL_GetError());
+        quit(1);
+    }
+    window = SDL_CreateWindow("testrendertiles", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              WINDOW_WIDTH, WINDOW_HEIGHT, 0);
+    if (!window) {
+        SDL_Log("Couldn't create window: %s\n", SDL_GetError());
+        quit(2);
+    }
+    renderer = SDL_CreateRenderer(window, -1, 0);
+    if (!renderer) {
+        SDL_Log("Couldn't create renderer: %s\n", SDL_GetError());
+        quit(2);
+    }
+    sprite = CreateSprite();
+    if (!sprite) {
+        SDL_Log("Couldn't create sprite texture: %s\n", SDL_GetError());
+        quit(2);
+    }
+
+    ResetSprites();
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_frames; ++i) {
+        DrawFrame();
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    /* Checksum a last frame, to make sure every run draws the same thing */
+    *checksum = 0;
+    frame = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (frame) {
+        DrawFrame();
+        if (SDL_RenderReadPixels(renderer, NULL, frame->format->format, frame->pixels, frame->pitch) == 0) {
+            *checksum = SDL_crc32(0, frame->pixels, (size_t)frame->h * frame->pitch);
+        }
+        SDL_FreeSurface(frame);
+    }
+
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    SDL_Quit();
+
+    return (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / num_frames;
+}
+
+int main(int argc, char *argv[])
+{
+    int max_threads = 0;
+    double serial_ms;
+    Uint32 serial_checksum;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--threads") == 0 && argv[i + 1]) {
+            max_threads = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+            num_sprites = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            num_frames = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--threads N] [--sprites N] [--frames N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (max_threads <= 0) {
+        max_threads = SDL_GetCPUCount();
+    }
+    if (num_sprites <= 0 || num_frames <= 0) {
+        SDL_Log("The number of sprites and frames must be positive\n");
+        return 1;
+    }
+
+    positions = (SDL_Rect *)SDL_malloc(num_sprites * sizeof(*positions));
+    velocities = (SDL_Rect *)SDL_malloc(num_sprites * sizeof(*velocities));
+    if (!positions || !velocities) {
+        SDL_Log("Out of memory!\n");
+        quit(2);
+    }
+
+    SDL_Log("Drawing %d %dx%d sprites for %d frames at %dx%d, 1 to %d threads\n",
+            num_sprites, SPRITE_SIZE, SPRITE_SIZE, num_frames, WINDOW_WIDTH, WINDOW_HEIGHT, max_threads);
+
+    serial_ms = RunFrames(0, &serial_checksum);
+    SDL_Log("serial:      %8.3f ms/frame\n", serial_ms);
+
+    for (i = 1; i <= max_threads; ++i) {
+        Uint32 checksum;
+        const double ms = RunFrames(i, &checksum);
+
+        SDL_Log("%2d thread%s: %8.3f ms/frame, %.2fx%s\n", i, i == 1 ? " " : "s", ms,
+                ms > 0.0 ? serial_ms / ms : 0.0,
+                checksum == serial_checksum ? "" : ", OUTPUT DIFFERS FROM SERIAL");
+    }
+
+    quit(0);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,197 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure how fast sprites blit from a sprite sheet, with
+   and without RLE acceleration, for colorkeyed and alpha blended sprites */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define SPRITE_SIZE 64
+#define SHEET_COLUMNS 8
+
+typedef struct
+{
+    const char *name;
+    Uint32 sheet_format;
+    Uint32 screen_format;
+    SDL_bool colorkey;
+} Mode;
+
+static const Mode modes[] = {
+    { "colorkey 8888", SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_RGB888, SDL_TRUE },
+    { "colorkey 565", SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_RGB565, SDL_TRUE },
+    { "alpha 8888", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888, SDL_FALSE },
+    { "alpha 565", SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565, SDL_FALSE },
+};
+
+static int num_sprites = 10000;
+static int num_passes = 5;
+
+/* Round sprites of different sizes with soft edges and a translucent band,
+   so there are opaque, translucent and transparent runs on most rows */
+static SDL_Surface *
+CreateSheet(const Mode *mode)
+{
+    SDL_Surface *sheet = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE * SHEET_COLUMNS, SPRITE_SIZE * SHEET_COLUMNS, 0, mode->sheet_format);
+    const Uint32 key = sheet ? SDL_MapRGB(sheet->format, 255, 0, 255) : 0;
+    int x, y;
+
+    if (!sheet) {
+        return NULL;
+    }
+    for (y = 0; y < sheet->h; ++y) {
+        for (x = 0; x < sheet->w; ++x) {
+            const int cell = (y / SPRITE_SIZE) * SHEET_COLUMNS + x / SPRITE_SIZE;
+            const float radius = 16.0f + (cell % 16);
+            const float dx = (x % SPRITE_SIZE) - SPRITE_SIZE / 2 + 0.5f;
+            const float dy = (y % SPRITE_SIZE) - SPRITE_SIZE / 2 + 0.5f;
+            const float edge = radius - SDL_sqrtf(dx * dx + dy * dy);
+            Uint8 *p = (Uint8 *)sheet->pixels + y * sheet->pitch + x * sheet->format->BytesPerPixel;
+            Uint32 pixel;
+            int alpha;
+
+            if (edge <= 0.0f) {
+                alpha = 0;
+            } else if (edge < 2.0f) {
+                alpha = (int)(edge * 127.0f);
+            } else if (dy > -4.0f && dy < 4.0f) {
+                alpha = 128;
+            } else {
+                alpha = 255;
+            }
+            if (mode->colorkey) {
+                pixel = alpha ? SDL_MapRGB(sheet->format, (Uint8)(x * 3), (Uint8)(y * 5), (Uint8)cell) : key;
+            } else {
+                pixel = SDL_MapRGBA(sheet->format, (Uint8)(x * 3), (Uint8)(y * 5), (Uint8)cell, (Uint8)alpha);
+            }
+            if (sheet->format->BytesPerPixel == 2) {
+                *(Uint16 *)p = (Uint16)pixel;
+            } else {
+                *(Uint32 *)p = pixel;
+            }
+        }
+    }
+    if (mode->colorkey) {
+        SDL_SetColorKey(sheet, SDL_TRUE, key);
+    } else {
+        SDL_SetSurfaceBlendMode(sheet, SDL_BLENDMODE_BLEND);
+    }
+    return sheet;
+}
+
+/* Returns the time of one sprite blit in microseconds, the best of a few passes */
+static double
+RunBlits(SDL_Surface *sheet, SDL_Surface *screen, Uint32 *checksum)
+{
+    double best = 0.0;
+    int pass, i;
+
+    for (pass = 0; pass < num_passes; ++pass) {
+        Uint32 seed = 12345;
+        Uint64 start, elapsed;
+        double us;
+
+        /* The first blit of the first pass encodes the sheet */
+        SDL_FillRect(screen, NULL, SDL_MapRGB(screen->format, 32, 64, 96));
+        start = SDL_GetPerformanceCounter();
+        for (i = 0; i < num_sprites; ++i) {
+            const int cell = (seed >> 8) % (SHEET_COLUMNS * SHEET_COLUMNS);
+            SDL_Rect srcrect, dstrect;
+
+            srcrect.x = (cell % SHEET_COLUMNS) * SPRITE_SIZE;
+            srcrect.y = (cell / SHEET_COLUMNS) * SPRITE_SIZE;
+            srcrect.w = SPRITE_SIZE;
+            srcrect.h = SPRITE_SIZE;
+            seed = seed * 1103515245 + 12345;
+            dstrect.x = (int)((seed >> 8) % (screen->w + SPRITE_SIZE)) - SPRITE_SIZE;
+            seed = seed * 1103515245 + 12345;
+            dstrect.y = (int)((seed >> 8) % (screen->h + SPRITE_SIZE)) - SPRITE_SIZE;
+            seed = seed * 1103515245 + 12345;
+            SDL_BlitSurface(sheet, &srcrect, screen, &dstrect);
+        }
+        elapsed = SDL_GetPerformanceCounter() - start;
+
+        us = (double)elapsed * 1000000.0 / SDL_GetPerformanceFrequency() / num_sprites;
+        if (pass == 0 || us < best) {
+            best = us;
+        }
+    }
+    *checksum = SDL_crc32(0, screen->pixels, (size_t)screen->h * screen->pitch);
+    return best;
+}
+
+static void
+RunMode(const Mode *mode, SDL_Surface *screen, const char *name, SDL_bool rle)
+{
+    SDL_Surface *sheet = CreateSheet(mode);
+    Uint32 checksum;
+    double us;
+
+    if (!sheet) {
+        SDL_Log("Couldn't create sheet: %s\n", SDL_GetError());
+        return;
+    }
+    SDL_SetSurfaceRLE(sheet, rle);
+    us = RunBlits(sheet, screen, &checksum);
+    SDL_Log("  %-14s %-12s %7.3f us per sprite, checksum %08" SDL_PRIx32 "\n", mode->name, name, us, checksum);
+    SDL_FreeSurface(sheet);
+}
+
+int main(int argc, char *argv[])
+{
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+            num_sprites = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--passes") == 0 && argv[i + 1]) {
+            num_passes = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--sprites N] [--passes N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_sprites <= 0 || num_passes <= 0) {
+        SDL_Log("The number of sprites and passes must be positive\n");
+        return 1;
+    }
+
+    SDL_Log("%d sprites of %dx%d from a sheet, onto 1280x720, best of %d passes\n", num_sprites, SPRITE_SIZE, SPRITE_SIZE, num_passes);
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        const Mode *mode = &modes[i];
+        SDL_Surface *screen = SDL_CreateRGBSurfaceWithFormat(0, 1280, 720, 0, mode->screen_format);
+
+        if (!screen) {
+            SDL_Log("Couldn't create surface: %s\n", SDL_GetError());
+            return 2;
+        }
+        RunMode(mode, screen, "no RLE", SDL_FALSE);
+        if (!mode->colorkey) {
+            SDL_SetHint(SDL_HINT_RLE_MERGE_RUNS, "0");
+            RunMode(mode, screen, "RLE, unmerged", SDL_TRUE);
+            SDL_ResetHint(SDL_HINT_RLE_MERGE_RUNS);
+        }
+        RunMode(mode, screen, "RLE", SDL_TRUE);
+        SDL_FreeSurface(screen);
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
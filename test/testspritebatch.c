@@ -0,0 +1,226 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: compare drawing N sprites with SDL_RenderCopyF() in a loop
+   against a single SDL_RenderCopyBatchF() call */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define WINDOW_WIDTH  640
+#define WINDOW_HEIGHT 480
+#define SPRITE_SIZE   8
+#define NUM_TILES     4
+
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static SDL_Texture *sprites;
+static SDL_Rect *srcrects;
+static SDL_FRect *dstrects;
+static SDL_Color *colors;
+static int num_sprites = 10000;
+static int num_frames = 100;
+static SDL_bool use_colors = SDL_FALSE;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_free(srcrects);
+    SDL_free(dstrects);
+    SDL_free(colors);
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_Texture *
+CreateSpriteSheet(void)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int i;
+
+    /* A strip of differently colored tiles, so sprites use different source rects */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, NUM_TILES * SPRITE_SIZE, SPRITE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (i = 0; i < NUM_TILES; ++i) {
+        SDL_Rect rect;
+
+        rect.x = i * SPRITE_SIZE;
+        rect.y = 0;
+        rect.w = SPRITE_SIZE;
+        rect.h = SPRITE_SIZE;
+        SDL_FillRect(surface, &rect, SDL_MapRGBA(surface->format, (Uint8)(i * 60), 0xFF, (Uint8)(255 - i * 60), 0xC0));
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    if (texture) {
+        SDL_SetTextureBlendMode(texture, SDL_BLENDMODE_BLEND);
+    }
+    return texture;
+}
+
+static void
+MoveSprites(int frame)
+{
+    int i;
+
+    for (i = 0; i < num_sprites; ++i) {
+        const int x = (i * 37 + frame * (1 + i % 3)) % (WINDOW_WIDTH - SPRITE_SIZE);
+        const int y = (i * 17 + frame * (1 + i % 5)) % (WINDOW_HEIGHT - SPRITE_SIZE);
+
+        dstrects[i].x = (float)x;
+        dstrects[i].y = (float)y;
+    }
+}
+
+static double
+RunFrames(SDL_bool batch, SDL_RenderStats *stats)
+{
+    Uint64 start, elapsed;
+    int frame, i;
+
+    start = SDL_GetPerformanceCounter();
+    for (frame = 0; frame < num_frames; ++frame) {
+        MoveSprites(frame);
+
+        SDL_SetRenderDrawColor(renderer, 0x20, 0x20, 0x20, 0xFF);
+        SDL_RenderClear(renderer);
+        if (batch) {
+            SDL_RenderCopyBatchF(renderer, sprites, srcrects, dstrects, use_colors ? colors : NULL, num_sprites);
+        } else {
+            for (i = 0; i < num_sprites; ++i) {
+                if (use_colors) {
+                    SDL_SetTextureColorMod(sprites, colors[i].r, colors[i].g, colors[i].b);
+                    SDL_SetTextureAlphaMod(sprites, colors[i].a);
+                }
+                SDL_RenderCopyF(renderer, sprites, &srcrects[i], &dstrects[i]);
+            }
+        }
+        SDL_RenderPresent(renderer);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    SDL_RenderGetStats(renderer, stats);
+
+    return (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / num_frames;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *video_driver = "offscreen";
+    const char *render_driver = "software";
+    SDL_RenderStats stats;
+    double loop_ms, batch_ms;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--video") == 0 && argv[i + 1]) {
+            video_driver = argv[++i];
+        } else if (SDL_strcasecmp(argv[i], "--renderer") == 0 && argv[i + 1]) {
+            render_driver = argv[++i];
+        } else if (SDL_strcasecmp(argv[i], "--sprites") == 0 && argv[i + 1]) {
+            num_sprites = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            num_frames = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--colors") == 0) {
+            use_colors = SDL_TRUE;
+        } else {
+            SDL_Log("Usage: %s [--video driver] [--renderer driver] [--sprites N] [--frames N] [--colors]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_sprites <= 0 || num_frames <= 0) {
+        SDL_Log("The number of sprites and frames must be positive\n");
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, render_driver);
+    SDL_SetHint(SDL_HINT_RENDER_BATCHING, "1");
+
+    if (SDL_VideoInit(video_driver) < 0) {
+        SDL_Log("Couldn't initialize the %s video driver: %s\n", video_driver, SDL_GetError());
+        return 1;
+    }
+
+    window = SDL_CreateWindow("testspritebatch", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              WINDOW_WIDTH, WINDOW_HEIGHT, 0);
+    if (!window) {
+        SDL_Log("Couldn't create window: %s\n", SDL_GetError());
+        quit(2);
+    }
+    renderer = SDL_CreateRenderer(window, -1, 0);
+    if (!renderer) {
+        SDL_Log("Couldn't create renderer: %s\n", SDL_GetError());
+        quit(2);
+    }
+    sprites = CreateSpriteSheet();
+    if (!sprites) {
+        SDL_Log("Couldn't create sprite texture: %s\n", SDL_GetError());
+        quit(2);
+    }
+
+    srcrects = (SDL_Rect *)SDL_malloc(num_sprites * sizeof(*srcrects));
+    dstrects = (SDL_FRect *)SDL_malloc(num_sprites * sizeof(*dstrects));
+    colors = (SDL_Color *)SDL_malloc(num_sprites * sizeof(*colors));
+    if (!srcrects || !dstrects || !colors) {
+        SDL_Log("Out of memory!\n");
+        quit(2);
+    }
+    for (i = 0; i < num_sprites; ++i) {
+        srcrects[i].x = (i % NUM_TILES) * SPRITE_SIZE;
+        srcrects[i].y = 0;
+        srcrects[i].w = SPRITE_SIZE;
+        srcrects[i].h = SPRITE_SIZE;
+        dstrects[i].w = (float)SPRITE_SIZE;
+        dstrects[i].h = (float)SPRITE_SIZE;
+        colors[i].r = (Uint8)(128 + (i * 7) % 128);
+        colors[i].g = (Uint8)(128 + (i * 13) % 128);
+        colors[i].b = 0xFF;
+        colors[i].a = 0xFF;
+    }
+
+    SDL_Log("Drawing %d %dx%d sprites for %d frames, %s video, %s renderer%s\n",
+            num_sprites, SPRITE_SIZE, SPRITE_SIZE, num_frames, video_driver, render_driver,
+            use_colors ? ", per-sprite colors" : "");
+
+    loop_ms = RunFrames(SDL_FALSE, &stats);
+    SDL_Log("SDL_RenderCopyF loop:  %8.3f ms/frame, %" SDL_PRIu32 " copy commands, %" SDL_PRIu32 " geometry commands, %" SDL_PRIu32 " vertex bytes\n",
+            loop_ms, stats.copy_commands, stats.geometry_commands, stats.vertex_bytes);
+
+    /* Reset the modulation from the loop before drawing with per-sprite colors */
+    SDL_SetTextureColorMod(sprites, 0xFF, 0xFF, 0xFF);
+    SDL_SetTextureAlphaMod(sprites, 0xFF);
+
+    batch_ms = RunFrames(SDL_TRUE, &stats);
+    SDL_Log("SDL_RenderCopyBatchF:  %8.3f ms/frame, %" SDL_PRIu32 " copy commands, %" SDL_PRIu32 " geometry commands, %" SDL_PRIu32 " vertex bytes\n",
+            batch_ms, stats.copy_commands, stats.geometry_commands, stats.vertex_bytes);
+
+    if (batch_ms > 0.0) {
+        SDL_Log("Speedup: %.2fx\n", loop_ms / batch_ms);
+    }
+
+    SDL_DestroyTexture(sprites);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    quit(0);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
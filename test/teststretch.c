@@ -0,0 +1,181 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure the throughput of SDL_SoftStretch() and
+   SDL_SoftStretchLinear() for a few scale factors, pixel formats and
+   CPU feature sets, see SDL_BLIT_CPU_FEATURES */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+typedef struct
+{
+    const char *name;
+    int num;
+    int den;
+    SDL_bool linear;
+    SDL_bool area; /* SDL_HINT_STRETCH_AREA_AVERAGE */
+} Scale;
+
+typedef struct
+{
+    const char *name;
+    const char *mask;
+    SDL_bool (*available)(void);
+} Features;
+
+static const Scale scales[] = {
+    { "nearest 3/2", 3, 2, SDL_FALSE, SDL_FALSE },
+    { "linear 3/2", 3, 2, SDL_TRUE, SDL_FALSE },
+    { "linear 3/4", 3, 4, SDL_TRUE, SDL_FALSE },
+    { "linear 1/8", 1, 8, SDL_TRUE, SDL_FALSE },
+    { "area 1/8", 1, 8, SDL_TRUE, SDL_TRUE },
+};
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGB565,
+};
+
+static const Features features[] = {
+    { "scalar", "0", NULL },
+    { "SSE2", "8", SDL_HasSSE2 },
+    { "AVX2", "72", SDL_HasAVX2 },
+    { "NEON", "128", SDL_HasNEON },
+    { "all", "65535", NULL },
+};
+
+static int num_iterations = 20;
+
+/* The same pseudo-random pixels for every run, so the results can be compared */
+static void
+FillPixels(SDL_Surface *surface)
+{
+    Uint32 seed = 12345;
+    int x, y;
+
+    for (y = 0; y < surface->h; ++y) {
+        Uint8 *row = (Uint8 *)surface->pixels + y * surface->pitch;
+
+        for (x = 0; x < surface->w * surface->format->BytesPerPixel; ++x) {
+            seed = seed * 1103515245 + 12345;
+            row[x] = (Uint8)(seed >> 16);
+        }
+    }
+}
+
+/* Returns the time of one stretch in milliseconds, or a negative value if it isn't supported */
+static double
+RunStretch(SDL_Surface *src, SDL_Surface *dst, SDL_bool linear, Uint32 *checksum)
+{
+    Uint64 start, elapsed;
+    int i;
+
+    if ((linear ? SDL_SoftStretchLinear(src, NULL, dst, NULL) : SDL_SoftStretch(src, NULL, dst, NULL)) < 0) {
+        return -1.0;
+    }
+    *checksum = SDL_crc32(0, dst->pixels, (size_t)dst->h * dst->pitch);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_iterations; ++i) {
+        if (linear) {
+            SDL_SoftStretchLinear(src, NULL, dst, NULL);
+        } else {
+            SDL_SoftStretch(src, NULL, dst, NULL);
+        }
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+
+    return (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / num_iterations;
+}
+
+int main(int argc, char *argv[])
+{
+    int width = 1920;
+    int height = 1080;
+    int i, j, k;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--iterations") == 0 && argv[i + 1]) {
+            num_iterations = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1] && argv[i + 2]) {
+            width = SDL_atoi(argv[++i]);
+            height = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--iterations N] [--size W H]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_iterations <= 0 || width <= 0 || height <= 0) {
+        SDL_Log("The number of iterations and the size must be positive\n");
+        return 1;
+    }
+
+    /* Measure one thread, the bands are measured by testblitthreads */
+    SDL_SetHint(SDL_HINT_BLIT_THREADS, "0");
+
+    SDL_Log("%dx%d source, %d iterations\n", width, height, num_iterations);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, formats[i]);
+
+        if (!src) {
+            SDL_Log("Couldn't create surface: %s\n", SDL_GetError());
+            return 2;
+        }
+        FillPixels(src);
+
+        for (j = 0; j < SDL_arraysize(scales); ++j) {
+            const Scale *scale = &scales[j];
+            const int dst_w = SDL_max(width * scale->num / scale->den, 1);
+            const int dst_h = SDL_max(height * scale->num / scale->den, 1);
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, dst_w, dst_h, 0, formats[i]);
+
+            if (!dst) {
+                SDL_Log("Couldn't create surface: %s\n", SDL_GetError());
+                SDL_FreeSurface(src);
+                return 2;
+            }
+
+            for (k = 0; k < SDL_arraysize(features); ++k) {
+                Uint32 checksum = 0;
+                double ms;
+
+                if (features[k].available && !features[k].available()) {
+                    continue;
+                }
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", features[k].mask, 1);
+                SDL_SetHint(SDL_HINT_STRETCH_AREA_AVERAGE, scale->area ? "1" : "0");
+                ms = RunStretch(src, dst, scale->linear, &checksum);
+                if (ms < 0.0) {
+                    SDL_Log("  %-10s %-12s %-6s unsupported: %s\n", SDL_GetPixelFormatName(formats[i]) + 16,
+                            scale->name, features[k].name, SDL_GetError());
+                    break;
+                }
+                SDL_Log("  %-10s %-12s %-6s %8.3f ms, %7.1f Mpixels/s, checksum %08" SDL_PRIx32 "\n",
+                        SDL_GetPixelFormatName(formats[i]) + 16, scale->name, features[k].name, ms,
+                        ms > 0.0 ? (double)dst_w * dst_h / ms / 1000.0 : 0.0, checksum);
+            }
+            SDL_FreeSurface(dst);
+        }
+        SDL_FreeSurface(src);
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,221 @@
+/*
+  Copyright (C) 1997-2024 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Simple program: measure how fast the software renderer draws many small
+   triangles with SDL_RenderGeometry(), filled and textured */
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define WINDOW_WIDTH  640
+#define WINDOW_HEIGHT 480
+#define TEXTURE_SIZE  32
+
+static SDL_Window *window;
+static SDL_Renderer *renderer;
+static SDL_Texture *texture;
+static SDL_Vertex *vertices;
+static int num_triangles = 5000;
+static int num_frames = 50;
+static int triangle_size = 16;
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_free(vertices);
+    SDL_Quit();
+    exit(rc);
+}
+
+static SDL_Texture *
+CreateTexture(void)
+{
+    SDL_Surface *surface;
+    SDL_Texture *result;
+    int x, y;
+
+    /* A checkerboard with varying alpha, so every texel blends differently */
+    surface = SDL_CreateRGBSurfaceWithFormat(0, TEXTURE_SIZE, TEXTURE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < TEXTURE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *)((Uint8 *)surface->pixels + y * surface->pitch);
+
+        for (x = 0; x < TEXTURE_SIZE; ++x) {
+            const Uint8 c = ((x / 4) ^ (y / 4)) & 1 ? 0xFF : 0x40;
+
+            row[x] = SDL_MapRGBA(surface->format, c, (Uint8)(x * 8), (Uint8)(y * 8), (Uint8)(64 + x * 6));
+        }
+    }
+    result = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    return result;
+}
+
+/* The same pseudo-random triangles for every run, so the frames can be compared */
+static void
+SetupTriangles(SDL_bool colored)
+{
+    Uint32 seed = 12345;
+    int i, j;
+
+    for (i = 0; i < num_triangles; ++i) {
+        SDL_Vertex *v = &vertices[i * 3];
+        float cx, cy;
+
+        seed = seed * 1103515245 + 12345;
+        cx = (float)((seed >> 8) % WINDOW_WIDTH);
+        seed = seed * 1103515245 + 12345;
+        cy = (float)((seed >> 8) % WINDOW_HEIGHT);
+
+        for (j = 0; j < 3; ++j) {
+            seed = seed * 1103515245 + 12345;
+            v[j].position.x = cx + (float)((int)((seed >> 8) % (2 * triangle_size + 1)) - triangle_size);
+            seed = seed * 1103515245 + 12345;
+            v[j].position.y = cy + (float)((int)((seed >> 8) % (2 * triangle_size + 1)) - triangle_size);
+            v[j].tex_coord.x = (j == 1) ? 1.0f : 0.0f;
+            v[j].tex_coord.y = (j == 2) ? 1.0f : 0.0f;
+            if (colored) {
+                v[j].color.r = (Uint8)(seed >> 4);
+                v[j].color.g = (Uint8)(seed >> 12);
+                v[j].color.b = (Uint8)(seed >> 20);
+                v[j].color.a = (Uint8)(96 + (seed >> 26));
+            } else {
+                v[j].color.r = 0xFF;
+                v[j].color.g = 0xFF;
+                v[j].color.b = 0xFF;
+                v[j].color.a = 0xFF;
+            }
+        }
+    }
+}
+
+static double
+RunFrames(const char *name, SDL_Texture *tex, SDL_bool colored, SDL_BlendMode blend)
+{
+    SDL_Surface *frame;
+    Uint64 start, elapsed;
+    Uint32 checksum = 0;
+    double ms;
+    int i;
+
+    SetupTriangles(colored);
+    if (tex) {
+        SDL_SetTextureBlendMode(tex, blend);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_frames; ++i) {
+        SDL_SetRenderDrawColor(renderer, 0x30, 0x30, 0x30, 0xFF);
+        SDL_RenderClear(renderer);
+        SDL_RenderGeometry(renderer, tex, vertices, num_triangles * 3, NULL, 0);
+        SDL_RenderPresent(renderer);
+    }
+    elapsed = SDL_GetPerformanceCounter() - start;
+    ms = (double)elapsed * 1000.0 / SDL_GetPerformanceFrequency() / num_frames;
+
+    /* Checksum a last frame, so the output can be compared between builds */
+    frame = SDL_CreateRGBSurfaceWithFormat(0, WINDOW_WIDTH, WINDOW_HEIGHT, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (frame) {
+        SDL_SetRenderDrawColor(renderer, 0x30, 0x30, 0x30, 0xFF);
+        SDL_RenderClear(renderer);
+        SDL_RenderGeometry(renderer, tex, vertices, num_triangles * 3, NULL, 0);
+        if (SDL_RenderReadPixels(renderer, NULL, frame->format->format, frame->pixels, frame->pitch) == 0) {
+            checksum = SDL_crc32(0, frame->pixels, (size_t)frame->h * frame->pitch);
+        }
+        SDL_RenderPresent(renderer);
+        SDL_FreeSurface(frame);
+    }
+
+    SDL_Log("%-26s %8.3f ms/frame, %10.0f triangles/s, checksum %08" SDL_PRIx32 "\n",
+            name, ms, ms > 0.0 ? num_triangles * 1000.0 / ms : 0.0, checksum);
+    return ms;
+}
+
+int main(int argc, char *argv[])
+{
+    const char *video_driver = "offscreen";
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    for (i = 1; i < argc; ++i) {
+        if (SDL_strcasecmp(argv[i], "--video") == 0 && argv[i + 1]) {
+            video_driver = argv[++i];
+        } else if (SDL_strcasecmp(argv[i], "--triangles") == 0 && argv[i + 1]) {
+            num_triangles = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--frames") == 0 && argv[i + 1]) {
+            num_frames = SDL_atoi(argv[++i]);
+        } else if (SDL_strcasecmp(argv[i], "--size") == 0 && argv[i + 1]) {
+            triangle_size = SDL_atoi(argv[++i]);
+        } else {
+            SDL_Log("Usage: %s [--video driver] [--triangles N] [--frames N] [--size N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (num_triangles <= 0 || num_frames <= 0 || triangle_size <= 0) {
+        SDL_Log("The number of triangles, frames and the triangle size must be positive\n");
+        return 1;
+    }
+
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+
+    if (SDL_VideoInit(video_driver) < 0) {
+        SDL_Log("Couldn't initialize the %s video driver: %s\n", video_driver, SDL_GetError());
+        return 1;
+    }
+
+    window = SDL_CreateWindow("testtriangles", SDL_WINDOWPOS_UNDEFINED, SDL_WINDOWPOS_UNDEFINED,
+                              WINDOW_WIDTH, WINDOW_HEIGHT, 0);
+    if (!window) {
+        SDL_Log("Couldn't create window: %s\n", SDL_GetError());
+        quit(2);
+    }
+    renderer = SDL_CreateRenderer(window, -1, 0);
+    if (!renderer) {
+        SDL_Log("Couldn't create renderer: %s\n", SDL_GetError());
+        quit(2);
+    }
+    texture = CreateTexture();
+    if (!texture) {
+        SDL_Log("Couldn't create texture: %s\n", SDL_GetError());
+        quit(2);
+    }
+    vertices = (SDL_Vertex *)SDL_malloc(num_triangles * 3 * sizeof(*vertices));
+    if (!vertices) {
+        SDL_Log("Out of memory!\n");
+        quit(2);
+    }
+
+    SDL_Log("Drawing %d triangles up to %d pixels across for %d frames, %s video\n",
+            num_triangles, 2 * triangle_size, num_frames, video_driver);
+
+    RunFrames("solid", NULL, SDL_FALSE, SDL_BLENDMODE_NONE);
+    RunFrames("vertex colors", NULL, SDL_TRUE, SDL_BLENDMODE_NONE);
+    RunFrames("textured", texture, SDL_FALSE, SDL_BLENDMODE_NONE);
+    RunFrames("textured, blended", texture, SDL_FALSE, SDL_BLENDMODE_BLEND);
+    RunFrames("textured, blended, colors", texture, SDL_TRUE, SDL_BLENDMODE_BLEND);
+    RunFrames("textured, added, colors", texture, SDL_TRUE, SDL_BLENDMODE_ADD);
+
+    SDL_DestroyTexture(texture);
+    SDL_DestroyRenderer(renderer);
+    SDL_DestroyWindow(window);
+    quit(0);
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -211,6 +211,92 @@ done:
     return result;
 }
 
+/* Times the conversion of a frame from every YUV format to every RGB format with the fast paths,
+   and from the 32-bit ones to every YUV format, once with all CPU features, once with SSE2 only
+   and once with the C code */
+static int run_benchmark(int w, int h, Uint32 iterations)
+{
+    const Uint32 yuv_formats[] = {
+        SDL_PIXELFORMAT_YV12,
+        SDL_PIXELFORMAT_IYUV,
+        SDL_PIXELFORMAT_NV12,
+        SDL_PIXELFORMAT_NV21,
+        SDL_PIXELFORMAT_YUY2,
+        SDL_PIXELFORMAT_UYVY,
+        SDL_PIXELFORMAT_YVYU
+    };
+    const Uint32 rgb_formats[] = {
+        SDL_PIXELFORMAT_RGB565,
+        SDL_PIXELFORMAT_RGB24,
+        SDL_PIXELFORMAT_RGBA8888,
+        SDL_PIXELFORMAT_BGRA8888,
+        SDL_PIXELFORMAT_ARGB8888,
+        SDL_PIXELFORMAT_ABGR8888
+    };
+    const char *features[] = { "65535", "8", "0" };
+    const int yuv_len = MAX_YUV_SURFACE_SIZE(w, h, 0);
+    const int rgb_pitch = w * 4;
+    Uint8 *yuv = (Uint8 *)SDL_malloc(yuv_len);
+    Uint8 *rgb = (Uint8 *)SDL_malloc((size_t)rgb_pitch * h);
+    double ms[SDL_arraysize(features)];
+    Uint32 i, j, k, n;
+    Uint64 start;
+
+    if (!yuv || !rgb) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't allocate benchmark buffers");
+        SDL_free(yuv);
+        SDL_free(rgb);
+        return -1;
+    }
+    for (i = 0; i < (Uint32)yuv_len; ++i) {
+        yuv[i] = (Uint8)(i * 7 + (i >> 9));
+    }
+
+    SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "Converting %dx%d frames, %" SDL_PRIu32 " iterations, AVX2 %s, SSE2 %s, AltiVec %s\n",
+                w, h, iterations, SDL_HasAVX2() ? "yes" : "no", SDL_HasSSE2() ? "yes" : "no", SDL_HasAltiVec() ? "yes" : "no");
+    for (i = 0; i < SDL_arraysize(yuv_formats); ++i) {
+        const int yuv_pitch = CalculateYUVPitch(yuv_formats[i], w);
+
+        for (j = 0; j < SDL_arraysize(rgb_formats); ++j) {
+            for (k = 0; k < SDL_arraysize(features); ++k) {
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", features[k], 1);
+                start = SDL_GetPerformanceCounter();
+                for (n = 0; n < iterations; ++n) {
+                    SDL_ConvertPixels(w, h, yuv_formats[i], yuv, yuv_pitch, rgb_formats[j], rgb, rgb_pitch);
+                }
+                ms[k] = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+            }
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s -> %s: %.3f ms, SSE2 only %.3f ms, C %.3f ms\n",
+                        SDL_GetPixelFormatName(yuv_formats[i]), SDL_GetPixelFormatName(rgb_formats[j]), ms[0], ms[1], ms[2]);
+        }
+    }
+
+    /* And back, the way a video encoder would */
+    for (j = 0; j < SDL_arraysize(rgb_formats); ++j) {
+        if (SDL_BYTESPERPIXEL(rgb_formats[j]) != 4) {
+            continue;
+        }
+        for (i = 0; i < SDL_arraysize(yuv_formats); ++i) {
+            const int yuv_pitch = CalculateYUVPitch(yuv_formats[i], w);
+
+            for (k = 0; k < SDL_arraysize(features); ++k) {
+                SDL_setenv("SDL_BLIT_CPU_FEATURES", features[k], 1);
+                start = SDL_GetPerformanceCounter();
+                for (n = 0; n < iterations; ++n) {
+                    SDL_ConvertPixels(w, h, rgb_formats[j], rgb, rgb_pitch, yuv_formats[i], yuv, yuv_pitch);
+                }
+                ms[k] = (double)(SDL_GetPerformanceCounter() - start) * 1000.0 / SDL_GetPerformanceFrequency() / iterations;
+            }
+            SDL_LogInfo(SDL_LOG_CATEGORY_APPLICATION, "%s -> %s: %.3f ms, SSE2 only %.3f ms, C %.3f ms\n",
+                        SDL_GetPixelFormatName(rgb_formats[j]), SDL_GetPixelFormatName(yuv_formats[i]), ms[0], ms[1], ms[2]);
+        }
+    }
+
+    SDL_free(yuv);
+    SDL_free(rgb);
+    return 0;
+}
+
 int main(int argc, char **argv)
 {
     struct
@@ -260,6 +346,7 @@ int main(int argc, char **argv)
     Uint8 *raw_yuv;
     Uint32 then, now, i, iterations = 100;
     SDL_bool should_run_automated_tests = SDL_FALSE;
+    SDL_bool should_run_benchmark = SDL_FALSE;
 
     while (argv[arg] && *argv[arg] == '-') {
         if (SDL_strcmp(argv[arg], "--jpeg") == 0) {
@@ -300,8 +387,10 @@ int main(int argc, char **argv)
             rgb_format = SDL_PIXELFORMAT_BGRA8888;
         } else if (SDL_strcmp(argv[arg], "--automated") == 0) {
             should_run_automated_tests = SDL_TRUE;
+        } else if (SDL_strcmp(argv[arg], "--benchmark") == 0) {
+            should_run_benchmark = SDL_TRUE;
         } else {
-            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [image_filename]\n", argv[0]);
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Usage: %s [--jpeg|--bt601|-bt709|--auto] [--yv12|--iyuv|--yuy2|--uyvy|--yvyu|--nv12|--nv21] [--rgb555|--rgb565|--rgb24|--argb|--abgr|--rgba|--bgra] [--automated|--benchmark] [image_filename]\n", argv[0]);
             return 1;
         }
         ++arg;
@@ -321,6 +410,11 @@ int main(int argc, char **argv)
         return 0;
     }
 
+    /* Time the conversions of a 1080p frame */
+    if (should_run_benchmark) {
+        return (run_benchmark(1920, 1080, iterations) < 0) ? 2 : 0;
+    }
+
     if (argv[arg]) {
         filename = argv[arg];
     } else {